@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ApduRecorder.h"
+
+#include "SingletonHelper.h"
+
+#include <QLoggingCategory>
+#include <QMutexLocker>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+defineSingleton(ApduRecorder)
+
+
+namespace
+{
+QString getRecordingFileName()
+{
+	const auto& fileName = qEnvironmentVariable("AUSWEISAPP2_APDU_RECORDING");
+#ifdef QT_NO_DEBUG
+	if (!fileName.isEmpty())
+	{
+		qCWarning(card) << "APDU recording is not available in release builds";
+	}
+	return QString();
+
+#else
+	return fileName;
+
+#endif
+}
+
+
+} // namespace
+
+
+ApduRecorder::ApduRecorder()
+	: ApduRecorder(getRecordingFileName())
+{
+}
+
+
+ApduRecorder::ApduRecorder(const QString& pFileName)
+	: mMutex()
+	, mFile(pFileName)
+{
+	if (pFileName.isEmpty())
+	{
+		return;
+	}
+
+	if (!mFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+	{
+		qCWarning(card) << "Cannot open APDU recording:" << pFileName;
+		return;
+	}
+
+	qCWarning(card) << "Recording APDUs with personal data to" << pFileName;
+}
+
+
+bool ApduRecorder::isEnabled() const
+{
+	return mFile.isOpen();
+}
+
+
+void ApduRecorder::record(const CommandApdu& pCommand, const ResponseApduResult& pResult, qint64 pDuration)
+{
+	record({pDuration, pResult.mReturnCode, pCommand, pResult.mResponseApdu});
+}
+
+
+void ApduRecorder::record(const Record& pRecord)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	const auto& line = toLine(pRecord);
+
+	const QMutexLocker locker(&mMutex);
+	mFile.write(line);
+	mFile.flush();
+}
+
+
+QByteArray ApduRecorder::toLine(const Record& pRecord)
+{
+	QByteArray line = QByteArray::number(pRecord.mDuration) + ' ' + QByteArray(getEnumName(pRecord.mReturnCode).data()) + ' ';
+	if (pRecord.mOperation != ApduRecordOperation::TRANSMIT)
+	{
+		line += QByteArray(getEnumName(pRecord.mOperation).data()) + ':';
+	}
+	line += pRecord.mCommand.toHex();
+	if (!pRecord.mResponse.isEmpty())
+	{
+		line += ' ' + pRecord.mResponse.toHex();
+	}
+	return line + '\n';
+}
+
+
+std::optional<ApduRecorder::Record> ApduRecorder::fromLine(QByteArrayView pLine)
+{
+	const auto& fields = pLine.trimmed().toByteArray().split(' ');
+	if (fields.size() < 3 || fields.size() > 4)
+	{
+		return std::nullopt;
+	}
+
+	bool ok = false;
+	const auto duration = fields.at(0).toLongLong(&ok);
+	const auto returnCode = Enum<CardReturnCode>::fromString(fields.at(1).constData(), CardReturnCode::UNDEFINED);
+	if (!ok || duration < 0 || returnCode == CardReturnCode::UNDEFINED)
+	{
+		return std::nullopt;
+	}
+
+	auto operation = ApduRecordOperation::TRANSMIT;
+	auto command = fields.at(2);
+	if (const auto separator = command.indexOf(':'); separator >= 0)
+	{
+		// Transmits are written without an operation.
+		operation = Enum<ApduRecordOperation>::fromString(command.first(separator).constData(), ApduRecordOperation::TRANSMIT);
+		if (operation == ApduRecordOperation::TRANSMIT)
+		{
+			return std::nullopt;
+		}
+		command.remove(0, separator + 1);
+	}
+
+	return Record {duration, returnCode, QByteArray::fromHex(command), fields.size() == 4 ? QByteArray::fromHex(fields.at(3)) : QByteArray(), operation};
+}
+
+
+QList<ApduRecorder::Record> ApduRecorder::load(const QString& pFileName)
+{
+	QFile file(pFileName);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		qCWarning(card) << "Cannot open APDU recording:" << pFileName;
+		return {};
+	}
+
+	QList<Record> records;
+	int lineNumber = 0;
+	while (!file.atEnd())
+	{
+		const auto& line = file.readLine();
+		++lineNumber;
+		if (line.trimmed().isEmpty() || line.startsWith('#'))
+		{
+			continue;
+		}
+
+		const auto& record = fromLine(line);
+		if (!record)
+		{
+			qCWarning(card) << "Skipping invalid line" << lineNumber << "of APDU recording:" << pFileName;
+			continue;
+		}
+
+		records += *record;
+	}
+
+	return records;
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Records the APDUs that are exchanged with a card.
+ *
+ * If the environment variable AUSWEISAPP2_APDU_RECORDING contains a filename
+ * in a debug build, every command, response, return code and duration of a
+ * card transmit is appended to that file. The PACE channel and PIN commands
+ * of a comfort reader are recorded as well. The recording can be played back
+ * by tests to compare the timing of complete card sessions without a card.
+ *
+ * Every line has the format "<duration in µs> <CardReturnCode> [<operation>:]<command> [<response>]"
+ * with hex encoded data. The operation is omitted for transmits. Empty lines
+ * and lines starting with '#' are ignored.
+ *
+ * \warning A recording contains personal data of the card holder.
+ */
+
+#pragma once
+
+#include "EnumHelper.h"
+#include "apdu/CommandApdu.h"
+#include "apdu/ResponseApdu.h"
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFile>
+#include <QList>
+#include <QMutex>
+#include <QString>
+
+#include <optional>
+
+
+namespace governikus
+{
+
+defineEnumType(ApduRecordOperation, TRANSMIT, ESTABLISH_PACE_CHANNEL, DESTROY_PACE_CHANNEL, SET_EID_PIN)
+
+class ApduRecorder
+{
+	Q_DISABLE_COPY(ApduRecorder)
+
+	public:
+		struct Record
+		{
+			qint64 mDuration;
+			CardReturnCode mReturnCode;
+			QByteArray mCommand;
+			QByteArray mResponse;
+			ApduRecordOperation mOperation = ApduRecordOperation::TRANSMIT;
+		};
+
+	private:
+		QMutex mMutex;
+		QFile mFile;
+
+	protected:
+		ApduRecorder();
+
+	public:
+		static ApduRecorder& getInstance();
+
+		explicit ApduRecorder(const QString& pFileName);
+
+		[[nodiscard]] bool isEnabled() const;
+		void record(const CommandApdu& pCommand, const ResponseApduResult& pResult, qint64 pDuration);
+		void record(const Record& pRecord);
+
+		[[nodiscard]] static QByteArray toLine(const Record& pRecord);
+		[[nodiscard]] static std::optional<Record> fromLine(QByteArrayView pLine);
+		[[nodiscard]] static QList<Record> load(const QString& pFileName);
+};
+
+} // namespace governikus
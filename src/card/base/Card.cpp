@@ -31,6 +31,27 @@ void Card::setErrorMessage(const QString& pMessage)
 }
 
 
+bool Card::isBatchTransmitSupported() const
+{
+	return false;
+}
+
+
+QList<ResponseApduResult> Card::transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos)
+{
+	QList<ResponseApduResult> results;
+	for (const auto& inputApduInfo : pInputApduInfos)
+	{
+		results += transmit(inputApduInfo.getInputApdu());
+		if (!inputApduInfo.isContinuable(results.constLast()))
+		{
+			break;
+		}
+	}
+	return results;
+}
+
+
 EstablishPaceChannelOutput Card::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription)
 {
 	Q_UNUSED(pPasswordId)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "CardReturnCode.h"
+#include "InputAPDUInfo.h"
 #include "SmartCardDefinitions.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/ResponseApdu.h"
@@ -82,6 +83,19 @@ class Card
 		 */
 		virtual ResponseApduResult transmit(const CommandApdu& pCmd) = 0;
 
+		/*!
+		 * Is the card able to transmit a batch of command APDUs more efficiently than one by one,
+		 * e.g. by sending them with a single message to a remote reader?
+		 */
+		virtual bool isBatchTransmitSupported() const;
+
+		/*!
+		 * Performs a transmit of all command APDUs in the given order.
+		 * The batch stops after the first result that is not continuable, see \ref InputAPDUInfo::isContinuable.
+		 * Hence the returned list contains at most one result for every command APDU.
+		 */
+		virtual QList<ResponseApduResult> transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos);
+
 		/*!
 		 * Establishes a PACE channel, i.e. the corresponding reader is no basic reader.
 		 */
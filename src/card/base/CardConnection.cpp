@@ -127,5 +127,7 @@ void CardConnection::onReaderInfoChanged(const ReaderInfo& pReaderInfo)
 
 TransmitCommand* CardConnection::createTransmitCommand(const QList<InputAPDUInfo>& pInputApduInfos, const QString& pSlotHandle)
 {
-	return new TransmitCommand(mCardConnectionWorker, pInputApduInfos, pSlotHandle);
+	auto* command = new TransmitCommand(mCardConnectionWorker, pInputApduInfos, pSlotHandle);
+	connect(command, &TransmitCommand::fireOutputApdu, this, &CardConnection::fireTransmitOutputApdu);
+	return command;
 }
@@ -209,6 +209,7 @@ class CardConnection
 
 	Q_SIGNALS:
 		void fireReaderInfoChanged(const ReaderInfo& pReaderInfo);
+		void fireTransmitOutputApdu(const QByteArray& pOutputApduAsHex);
 };
 
 } // namespace governikus
@@ -4,12 +4,16 @@
 
 #include "CardConnectionWorker.h"
 
+#include "ApduRecorder.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/FileCommand.h"
 #include "apdu/PacePinStatus.h"
 #include "pace/PaceHandler.h"
+#include "pinpad/EstablishPaceChannel.h"
 
+#include <QElapsedTimer>
 #include <QLoggingCategory>
+#include <QPointer>
 #include <QThread>
 
 using namespace governikus;
@@ -37,6 +41,15 @@ CardConnectionWorker::CardConnectionWorker(Reader* pReader)
 
 CardConnectionWorker::~CardConnectionWorker()
 {
+	if (const auto* queue = getCommandQueue(); queue && queue->getMetrics().mExecuted > 0)
+	{
+		const auto& metrics = queue->getMetrics();
+		qCDebug(card) << "Command queue of" << mReader->getName() << "| executed:" << metrics.mExecuted << "| coalesced:" << metrics.mCoalesced
+					  << "| max queue depth:" << metrics.mMaxDepth
+					  << "| average wait:" << metrics.mTotalWait / metrics.mExecuted / 1000 << "µs"
+					  << "| max wait:" << metrics.mMaxWait / 1000 << "µs";
+	}
+
 	const auto card = mReader ? mReader->getCard() : nullptr;
 	if (card && card->isConnected())
 	{
@@ -48,7 +61,9 @@ CardConnectionWorker::~CardConnectionWorker()
 QSharedPointer<CardConnectionWorker> CardConnectionWorker::create(Reader* pReader)
 {
 	const auto& customDeleter = [](CardConnectionWorker* pWorker){
-				if (QThread::currentThread() == pWorker->thread())
+				// The thread of a removed reader may be gone already.
+				const auto* thread = pWorker->thread();
+				if (thread == nullptr || thread == QThread::currentThread() || thread->isFinished())
 				{
 					delete pWorker;
 				}
@@ -68,6 +83,12 @@ ReaderInfo CardConnectionWorker::getReaderInfo() const
 }
 
 
+CardCommandQueue* CardConnectionWorker::getCommandQueue() const
+{
+	return mReader ? &mReader->getCommandQueue() : nullptr;
+}
+
+
 void CardConnectionWorker::setPukInoperative()
 {
 	mReader->setPukInoperative();
@@ -147,6 +168,18 @@ void CardConnectionWorker::onKeepAliveTimeout()
 		return;
 	}
 
+	// Pending commands go first, they keep the card alive as well.
+	mReader->getCommandQueue().enqueue(CardCommandQueue::Priority::BACKGROUND, "KeepAlive", [worker = QPointer<CardConnectionWorker>(this)] {
+			if (worker)
+			{
+				worker->keepAlive();
+			}
+		});
+}
+
+
+void CardConnectionWorker::keepAlive()
+{
 	FileCommand command(FileRef::efCardAccess());
 	const auto& result = transmit(command);
 	if (result.mReturnCode == CardReturnCode::OK)
@@ -183,7 +216,14 @@ ResponseApduResult CardConnectionWorker::transmit(const CommandApdu& pCommandApd
 		}
 	}
 
+	QElapsedTimer timer;
+	timer.start();
 	ResponseApduResult result = card->transmit(commandApdu);
+	if (auto& recorder = ApduRecorder::getInstance(); recorder.isEnabled())
+	{
+		recorder.record(commandApdu, result, timer.nsecsElapsed() / 1000);
+	}
+
 	if (result.mResponseApdu.getStatusCode() == StatusCode::WRONG_LENGTH)
 	{
 		return {CardReturnCode::WRONG_LENGTH};
@@ -205,6 +245,59 @@ ResponseApduResult CardConnectionWorker::transmit(const CommandApdu& pCommandApd
 }
 
 
+QList<ResponseApduResult> CardConnectionWorker::transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos,
+		const std::function<void(const ResponseApduResult&)>& pResultHandler)
+{
+	const auto card = mReader ? mReader->getCard() : nullptr;
+	if (mSecureMessaging || !card || !card->isBatchTransmitSupported())
+	{
+		// Secure messaging needs the response of the previous command to encrypt the next one.
+		QList<ResponseApduResult> results;
+		for (const auto& inputApduInfo : pInputApduInfos)
+		{
+			results += transmit(inputApduInfo.getInputApdu());
+			if (pResultHandler)
+			{
+				pResultHandler(results.constLast());
+			}
+
+			if (!inputApduInfo.isContinuable(results.constLast()))
+			{
+				break;
+			}
+		}
+		return results;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+	auto results = card->transmitBatch(pInputApduInfos);
+	if (auto& recorder = ApduRecorder::getInstance(); recorder.isEnabled() && !results.isEmpty())
+	{
+		// The card does not report the duration of single commands of a batch.
+		const auto duration = timer.nsecsElapsed() / 1000 / results.size();
+		for (qsizetype i = 0; i < results.size(); ++i)
+		{
+			recorder.record(pInputApduInfos.at(i).getInputApdu(), results.at(i), duration);
+		}
+	}
+
+	for (auto& result : results)
+	{
+		if (result.mResponseApdu.getStatusCode() == StatusCode::WRONG_LENGTH)
+		{
+			result = {CardReturnCode::WRONG_LENGTH};
+		}
+
+		if (pResultHandler)
+		{
+			pResultHandler(result);
+		}
+	}
+	return results;
+}
+
+
 CardReturnCode CardConnectionWorker::readFile(const FileRef& pFileRef, QByteArray& pFileContent, int pLe)
 {
 	if (!mReader || !mReader->getCard())
@@ -327,7 +420,15 @@ EstablishPaceChannelOutput CardConnectionWorker::establishPaceChannel(PacePasswo
 	{
 		const bool isTransportPin = (pPasswordValue == QByteArray(5, 0));
 		Q_ASSERT(pPasswordValue.isNull() || isTransportPin);
+		QElapsedTimer timer;
+		timer.start();
 		output = card->establishPaceChannel(pPasswordId, isTransportPin ? 5 : 6, pChat, pCertificateDescription);
+
+		if (auto& recorder = ApduRecorder::getInstance(); recorder.isEnabled())
+		{
+			const EstablishPaceChannel input(pPasswordId, pChat, pCertificateDescription);
+			recorder.record({timer.nsecsElapsed() / 1000, output.getPaceReturnCode(), input.createASN1StructCcid(), output.toCcid(), ApduRecordOperation::ESTABLISH_PACE_CHANNEL});
+		}
 	}
 
 	if (output.getPaceReturnCode() == CardReturnCode::INVALID_PASSWORD)
@@ -389,7 +490,16 @@ CardReturnCode CardConnectionWorker::destroyPaceChannel()
 	}
 	else
 	{
-		return card->destroyPaceChannel();
+		QElapsedTimer timer;
+		timer.start();
+		const auto returnCode = card->destroyPaceChannel();
+
+		if (auto& recorder = ApduRecorder::getInstance(); recorder.isEnabled())
+		{
+			recorder.record({timer.nsecsElapsed() / 1000, returnCode, QByteArray(), QByteArray(), ApduRecordOperation::DESTROY_PACE_CHANNEL});
+		}
+
+		return returnCode;
 	}
 }
 
@@ -412,7 +522,14 @@ ResponseApduResult CardConnectionWorker::setEidPin(const QByteArray& pNewPin, qu
 	else
 	{
 		Q_ASSERT(pNewPin.isEmpty());
+		QElapsedTimer timer;
+		timer.start();
 		result = card->setEidPin(pTimeoutSeconds);
+
+		if (auto& recorder = ApduRecorder::getInstance(); recorder.isEnabled())
+		{
+			recorder.record({timer.nsecsElapsed() / 1000, result.mReturnCode, QByteArray(1, static_cast<char>(pTimeoutSeconds)), result.mResponseApdu, ApduRecordOperation::SET_EID_PIN});
+		}
 	}
 
 	if (result.mReturnCode == CardReturnCode::OK && result.mResponseApdu.getStatusCode() != StatusCode::SUCCESS)
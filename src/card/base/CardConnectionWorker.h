@@ -10,17 +10,20 @@
 
 #include "CardReturnCode.h"
 #include "FileRef.h"
+#include "InputAPDUInfo.h"
 #include "Reader.h"
 #include "SmartCardDefinitions.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/ResponseApdu.h"
 #include "asn1/CVCertificateChain.h"
 #include "asn1/SecurityInfos.h"
+#include "command/CardCommandQueue.h"
 #include "pace/SecureMessaging.h"
 #include "pinpad/EstablishPaceChannelOutput.h"
 
 #include <QByteArray>
 #include <QTimer>
+#include <functional>
 
 
 namespace governikus
@@ -51,6 +54,7 @@ class CardConnectionWorker
 		inline QSharedPointer<const EFCardAccess> getEfCardAccess() const;
 
 		void stopSecureMessaging();
+		void keepAlive();
 
 	private Q_SLOTS:
 		void onKeepAliveTimeout();
@@ -72,6 +76,12 @@ class CardConnectionWorker
 
 		Q_INVOKABLE ReaderInfo getReaderInfo() const;
 
+		/*!
+		 * Returns the command queue of the reader or nullptr if the reader is gone.
+		 * It has to be used in the thread of the worker, see \ref BaseCardCommand::run().
+		 */
+		[[nodiscard]] CardCommandQueue* getCommandQueue() const;
+
 		void setPukInoperative();
 
 		[[nodiscard]] bool selectApplicationRoot(const FileRef& pApplication);
@@ -82,6 +92,14 @@ class CardConnectionWorker
 
 		virtual ResponseApduResult transmit(const CommandApdu& pCommandApdu);
 
+		/*!
+		 * Transmits the command APDUs in the given order and stops after the first result that is not continuable.
+		 * If the card supports it and no local secure messaging is active, the batch is handed to the card at once.
+		 * The optional handler is called with every result as soon as it is available.
+		 */
+		QList<ResponseApduResult> transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos,
+				const std::function<void(const ResponseApduResult&)>& pResultHandler = nullptr);
+
 		/*!
 		 * Performs PACE and establishes a PACE channel for later terminal authentication.
 		 * If the Reader is a basic reader and the PACE channel is successfully established, the subsequent transmits will be secured using, secure messaging.
@@ -8,9 +8,14 @@
 #include "asn1/PaceInfo.h"
 
 #include <QDebug>
+#include <QList>
 #include <QLoggingCategory>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QtGlobal>
 
+#include <algorithm>
+
 
 Q_DECLARE_LOGGING_CATEGORY(card)
 
@@ -18,6 +23,19 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 using namespace governikus;
 
 
+namespace
+{
+struct CachedCardInfo
+{
+	QByteArray mEfCardAccess;
+	CardInfo mCardInfo;
+};
+
+QMutex cCacheMutex;
+QList<CachedCardInfo> cCache; // most recently used first
+} // namespace
+
+
 CardInfo CardInfoFactory::create(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker)
 {
 	if (pCardConnectionWorker == nullptr)
@@ -26,6 +44,19 @@ CardInfo CardInfoFactory::create(const QSharedPointer<CardConnectionWorker>& pCa
 		return CardInfo(CardType::UNKNOWN);
 	}
 
+	const auto& efCardAccessBytes = readEfCardAccess(pCardConnectionWorker);
+	if (const auto& cachedCardInfo = lookupCache(efCardAccessBytes); cachedCardInfo.has_value())
+	{
+		// EF.CardAccess is not unique per chip, so the cached application has to be present on this card.
+		if (pCardConnectionWorker->selectApplicationRoot(cachedCardInfo->getApplication()))
+		{
+			qCDebug(card) << "Card detected by EF.CardAccess:" << *cachedCardInfo;
+			return *cachedCardInfo;
+		}
+
+		qCDebug(card) << "Cached application not found, detecting card";
+	}
+
 	const auto application = CardInfoFactory::detectCard(pCardConnectionWorker);
 
 	if (application == FileRef())
@@ -34,7 +65,7 @@ CardInfo CardInfoFactory::create(const QSharedPointer<CardConnectionWorker>& pCa
 		return CardInfo(CardType::UNKNOWN);
 	}
 
-	const auto& efCardAccess = readEfCardAccess(pCardConnectionWorker);
+	const auto& efCardAccess = decodeEfCardAccess(efCardAccessBytes);
 	if (!checkEfCardAccess(efCardAccess))
 	{
 		qCWarning(card) << "EFCardAccess not found or is invalid";
@@ -43,10 +74,58 @@ CardInfo CardInfoFactory::create(const QSharedPointer<CardConnectionWorker>& pCa
 
 	const CardInfo cardInfo(efCardAccess->getMobileEIDTypeInfo() ? CardType::SMART_EID : CardType::EID_CARD, application, efCardAccess);
 	qCDebug(card) << "Card detected:" << cardInfo;
+	addToCache(efCardAccessBytes, cardInfo);
 	return cardInfo;
 }
 
 
+std::optional<CardInfo> CardInfoFactory::lookupCache(const QByteArray& pEfCardAccess)
+{
+	if (pEfCardAccess.isEmpty())
+	{
+		return std::nullopt;
+	}
+
+	const QMutexLocker locker(&cCacheMutex);
+	const auto iter = std::find_if(cCache.begin(), cCache.end(), [&pEfCardAccess](const auto& pEntry){
+			return pEntry.mEfCardAccess == pEfCardAccess;
+		});
+	if (iter == cCache.end())
+	{
+		return std::nullopt;
+	}
+
+	std::rotate(cCache.begin(), iter, iter + 1);
+	return cCache.constFirst().mCardInfo;
+}
+
+
+void CardInfoFactory::addToCache(const QByteArray& pEfCardAccess, const CardInfo& pCardInfo)
+{
+	if (pEfCardAccess.isEmpty())
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&cCacheMutex);
+	cCache.removeIf([&pEfCardAccess](const auto& pEntry){
+			return pEntry.mEfCardAccess == pEfCardAccess;
+		});
+	cCache.prepend({pEfCardAccess, pCardInfo});
+	if (cCache.size() > CACHE_SIZE)
+	{
+		cCache.removeLast();
+	}
+}
+
+
+void CardInfoFactory::clearCache()
+{
+	const QMutexLocker locker(&cCacheMutex);
+	cCache.clear();
+}
+
+
 bool CardInfoFactory::detectEid(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker, const FileRef& pRef)
 {
 	if (!pCardConnectionWorker->selectApplicationRoot(pRef))
@@ -98,16 +177,27 @@ FileRef CardInfoFactory::detectCard(const QSharedPointer<CardConnectionWorker>&
 }
 
 
-QSharedPointer<EFCardAccess> CardInfoFactory::readEfCardAccess(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker)
+QByteArray CardInfoFactory::readEfCardAccess(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker)
 {
 	QByteArray efCardAccessBytes;
 	if (pCardConnectionWorker->readFile(FileRef::efCardAccess(), efCardAccessBytes) != CardReturnCode::OK)
+	{
+		return QByteArray();
+	}
+
+	return efCardAccessBytes;
+}
+
+
+QSharedPointer<EFCardAccess> CardInfoFactory::decodeEfCardAccess(const QByteArray& pEfCardAccessBytes)
+{
+	if (pEfCardAccessBytes.isEmpty())
 	{
 		qCCritical(card) << "Error while reading EF.CardAccess: Cannot read EF.CardAccess";
 		return QSharedPointer<EFCardAccess>();
 	}
 
-	auto efCardAccess = EFCardAccess::decode(efCardAccessBytes);
+	auto efCardAccess = EFCardAccess::decode(pEfCardAccessBytes);
 	if (efCardAccess == nullptr)
 	{
 		qCCritical(card) << "Error while reading EF.CardAccess: Cannot parse EFCardAccess";
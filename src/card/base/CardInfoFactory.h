@@ -8,8 +8,11 @@
 #include "CardInfo.h"
 #include "FileRef.h"
 
+#include <QByteArray>
 #include <QSharedPointer>
 
+#include <optional>
+
 class test_CardInfoFactory;
 
 namespace governikus
@@ -30,6 +33,16 @@ class CardInfoFactory final
 		static CardInfo create(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker);
 
 	private:
+		static constexpr int CACHE_SIZE = 8;
+
+		/*!
+		 * Known cards are cached by the content of EF.CardAccess. As it is shared by all
+		 * chips of a card generation, the cached application still has to be selected.
+		 */
+		static std::optional<CardInfo> lookupCache(const QByteArray& pEfCardAccess);
+		static void addToCache(const QByteArray& pEfCardAccess, const CardInfo& pCardInfo);
+		static void clearCache();
+
 		/*!
 		 * Checks, if the smart card is a german eID card (i.e. a NPA or an EAT) or a passport.
 		 */
@@ -39,7 +52,8 @@ class CardInfoFactory final
 		/*!
 		 * Reads the EF.CardAccess
 		 */
-		static QSharedPointer<EFCardAccess> readEfCardAccess(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker);
+		static QByteArray readEfCardAccess(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker);
+		static QSharedPointer<EFCardAccess> decodeEfCardAccess(const QByteArray& pEfCardAccessBytes);
 
 		/*!
 		 * According to TR-03105 we have to perform some checks on EF.CardAccess the first time we read it.
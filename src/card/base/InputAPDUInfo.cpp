@@ -4,10 +4,38 @@
 
 #include "InputAPDUInfo.h"
 
+#include <algorithm>
+
+
 using namespace governikus;
 
+
 InputAPDUInfo::InputAPDUInfo(const QByteArray& pInputApdu)
 	: mInputApdu(pInputApdu)
 	, mAcceptableStatusCodes()
 {
 }
+
+
+bool InputAPDUInfo::isAcceptable(const ResponseApdu& pResponse) const
+{
+	if (mAcceptableStatusCodes.isEmpty())
+	{
+		return true;
+	}
+
+	const auto& responseBytes = pResponse.getStatusBytes().toHex();
+	return std::any_of(mAcceptableStatusCodes.constBegin(), mAcceptableStatusCodes.constEnd(),
+			[&responseBytes](const auto& pCode)
+			{
+				return responseBytes.startsWith(pCode);
+			});
+}
+
+
+bool InputAPDUInfo::isContinuable(const ResponseApduResult& pResult) const
+{
+	return pResult.mReturnCode == CardReturnCode::OK
+		   && !pResult.mResponseApdu.isEmpty()
+		   && isAcceptable(pResult.mResponseApdu);
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "apdu/CommandApdu.h"
+#include "apdu/ResponseApdu.h"
 
 #include <QByteArrayList>
 
@@ -50,6 +51,18 @@ class InputAPDUInfo
 			mAcceptableStatusCodes += pStatusCodeAsHex;
 		}
 
+
+		/*!
+		 * Checks the status bytes of the response against the acceptable status codes
+		 * according to TR-03112-6 chapter 3.2.5. An empty list accepts every response.
+		 */
+		[[nodiscard]] bool isAcceptable(const ResponseApdu& pResponse) const;
+
+		/*!
+		 * Returns true if a batch of commands can continue after this command received pResult.
+		 */
+		[[nodiscard]] bool isContinuable(const ResponseApduResult& pResult) const;
+
 	private:
 		QByteArray mInputApdu;
 		QByteArrayList mAcceptableStatusCodes;
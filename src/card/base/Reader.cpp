@@ -25,6 +25,7 @@ Reader::Reader(ReaderManagerPluginType pPluginType, const QString& pReaderName)
 	: QObject()
 	, mReaderInfo(pReaderName, pPluginType)
 	, mTimerId(0)
+	, mCommandQueue(this)
 {
 }
 
@@ -6,6 +6,7 @@
 
 #include "Card.h"
 #include "ReaderInfo.h"
+#include "command/CardCommandQueue.h"
 
 #include <QObject>
 #include <QSharedPointer>
@@ -37,6 +38,7 @@ class Reader
 	private:
 		ReaderInfo mReaderInfo;
 		int mTimerId;
+		CardCommandQueue mCommandQueue;
 
 		struct RetryCounterResult
 		{
@@ -77,6 +79,23 @@ class Reader
 		}
 
 
+		/*!
+		 * \brief Returns the queue of the card commands and background jobs of this reader.
+		 *
+		 * It has to be used in the thread of the reader only.
+		 */
+		[[nodiscard]] CardCommandQueue& getCommandQueue()
+		{
+			return mCommandQueue;
+		}
+
+
+		[[nodiscard]] const CardCommandQueue& getCommandQueue() const
+		{
+			return mCommandQueue;
+		}
+
+
 		virtual void insertCard(const QVariant& pData = QVariant());
 
 		void shelveCard();
@@ -12,19 +12,62 @@ ReaderManagerPlugin::ReaderManagerPlugin(ReaderManagerPluginType pPluginType,
 		bool pAvailable,
 		bool pPluginEnabled)
 	: mInfo(pPluginType, pPluginEnabled, pAvailable)
+	, mReaderThreads(false)
 {
 }
 
 
+void ReaderManagerPlugin::moveToReaderThread(Reader* pReader) const
+{
+	Q_ASSERT(pReader->thread() == QThread::currentThread());
+
+	auto* thread = new QThread();
+	thread->setObjectName(QStringLiteral("ReaderThread-%1").arg(pReader->getName()));
+	pReader->moveToThread(thread);
+	thread->start();
+}
+
+
+void ReaderManagerPlugin::deleteReader(Reader* pReader) const
+{
+	auto* thread = pReader->thread();
+	if (thread == QThread::currentThread())
+	{
+		delete pReader;
+		return;
+	}
+
+	// Deferred deletions are done when the thread finishes, so the reader is deleted in its thread.
+	pReader->deleteLater();
+	thread->quit();
+	thread->wait();
+	delete thread;
+}
+
+
+void ReaderManagerPlugin::runOnThread(QObject* pContext, const std::function<void()>& pFunc)
+{
+	if (pContext->thread() == QThread::currentThread())
+	{
+		pFunc();
+		return;
+	}
+
+	QMetaObject::invokeMethod(pContext, pFunc, Qt::BlockingQueuedConnection);
+}
+
+
 void ReaderManagerPlugin::shelve() const
 {
 	const auto& readers = getReaders();
 	for (const auto& reader : readers)
 	{
-		if (reader->getReaderInfo().wasShelved())
-		{
-			reader->shelveCard();
-		}
+		runOnThread(reader, [reader] {
+				if (reader->getReaderInfo().wasShelved())
+				{
+					reader->shelveCard();
+				}
+			});
 	}
 }
 
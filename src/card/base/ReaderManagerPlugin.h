@@ -16,6 +16,8 @@
 #include <QObject>
 #include <QThread>
 
+#include <functional>
+
 namespace governikus
 {
 
@@ -27,6 +29,7 @@ class ReaderManagerPlugin
 
 	private:
 		ReaderManagerPluginInfo mInfo;
+		bool mReaderThreads;
 
 	protected:
 		void setPluginEnabled(bool pEnabled)
@@ -51,6 +54,26 @@ class ReaderManagerPlugin
 			mInfo.setValue(pKey, pValue);
 		}
 
+
+		[[nodiscard]] bool hasReaderThreads() const
+		{
+			return mReaderThreads;
+		}
+
+
+		/*!
+		 * \brief Moves the reader and its card to an own thread, so a slow card does not block the other readers.
+		 *
+		 * Every call to the reader has to use runOnThread(). Signals of the plugin that belong
+		 * to the reader have to be emitted from the thread of the reader to keep their order.
+		 */
+		void moveToReaderThread(Reader* pReader) const;
+
+		/*!
+		 * \brief Deletes the reader and its card in their thread and stops the thread of moveToReaderThread().
+		 */
+		void deleteReader(Reader* pReader) const;
+
 	public:
 		ReaderManagerPlugin(ReaderManagerPluginType pPluginType,
 				bool pAvailable = false,
@@ -63,9 +86,24 @@ class ReaderManagerPlugin
 		}
 
 
+		/*!
+		 * \brief Requests a thread per reader from plugins that support it, see moveToReaderThread().
+		 */
+		void setReaderThreads(bool pEnabled)
+		{
+			mReaderThreads = pEnabled;
+		}
+
+
 		[[nodiscard]] virtual QList<Reader*> getReaders() const = 0;
 
 
+		/*!
+		 * \brief Runs the function in the thread of the context and blocks until it is done.
+		 */
+		static void runOnThread(QObject* pContext, const std::function<void()>& pFunc);
+
+
 		virtual void init()
 		{
 			Q_ASSERT(QObject::thread() == QThread::currentThread());
@@ -4,6 +4,7 @@
 
 #include "ReaderManagerWorker.h"
 
+#include "ApduRecorder.h"
 #include "Initializer.h"
 #include "Reader.h"
 
@@ -25,6 +26,8 @@ INIT_FUNCTION([] {
 ReaderManagerWorker::ReaderManagerWorker()
 	: QObject()
 	, mPlugins()
+	, mPluginThreads()
+	, mReaderPlugins()
 {
 }
 
@@ -41,22 +44,42 @@ void ReaderManagerWorker::shutdown()
 	qCDebug(card) << "Shutdown ReaderManagerWorker";
 	for (auto& plugin : std::as_const(mPlugins))
 	{
-		plugin->stopScan();
+		runOnPluginThread(plugin, [plugin] {
+				plugin->stopScan();
 
-		qCDebug(card) << "Shutdown plugin:" << plugin->metaObject()->className();
-		plugin->shutdown();
+				qCDebug(card) << "Shutdown plugin:" << plugin->metaObject()->className();
+				plugin->shutdown();
+			});
 
 		// Plugins and therefore their members are not auto destructed due to a bug in Qt.
 		// https://bugreports.qt.io/browse/QTBUG-17458
 		plugin->deleteLater();
 	}
 	mPlugins.clear();
+	mReaderPlugins.clear();
+
+	for (auto* thread : std::as_const(mPluginThreads))
+	{
+		// The deferred deletion of the plugin is done when the thread finishes.
+		thread->quit();
+		if (!thread->wait(5000))
+		{
+			// Deleting a running thread aborts the application, so it is left behind.
+			qCWarning(card).noquote() << thread->objectName() << "did not stop";
+			continue;
+		}
+
+		qCDebug(card).noquote() << thread->objectName() << "stopped";
+		delete thread;
+	}
+	mPluginThreads.clear();
 }
 
 
 void ReaderManagerWorker::onReaderRemoved(ReaderInfo pInfo)
 {
 	qCDebug(card) << "fireReaderRemoved:" << pInfo.getName();
+	mReaderPlugins.remove(pInfo.getName());
 	pInfo.invalidate();
 	Q_EMIT fireReaderRemoved(pInfo);
 }
@@ -67,6 +90,10 @@ void ReaderManagerWorker::onThreadStarted()
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
 
 	qCDebug(card) << "Thread started";
+
+	// Create the recorder before any card is connected to log its warning on startup.
+	ApduRecorder::getInstance();
+
 	registerPlugins();
 
 	Q_EMIT fireInitialized();
@@ -90,9 +117,14 @@ void ReaderManagerWorker::registerPlugins()
 			else
 			{
 				registerPlugin(pluginInstance);
-				pluginInstance->init();
 
-				Q_EMIT firePluginAdded(pluginInstance->getInfo());
+				ReaderManagerPluginInfo info;
+				runOnPluginThread(pluginInstance, [pluginInstance, &info] {
+						pluginInstance->init();
+						info = pluginInstance->getInfo();
+					});
+
+				Q_EMIT firePluginAdded(info);
 			}
 		}
 	}
@@ -105,6 +137,34 @@ bool ReaderManagerWorker::isPlugin(const QJsonObject& pJson)
 }
 
 
+QList<ReaderManagerPluginType> ReaderManagerWorker::getThreadedPluginTypes()
+{
+	QList<ReaderManagerPluginType> types;
+
+	const auto& names = qEnvironmentVariable("AUSWEISAPP2_READER_THREADS").split(QLatin1Char(','), Qt::SkipEmptyParts);
+	for (const auto& name : names)
+	{
+		const auto type = Enum<ReaderManagerPluginType>::fromString(name.trimmed(), ReaderManagerPluginType::UNKNOWN);
+		if (type == ReaderManagerPluginType::UNKNOWN)
+		{
+			qCWarning(card) << "Ignoring unknown plugin of AUSWEISAPP2_READER_THREADS:" << name;
+			continue;
+		}
+
+		// The SmartManager is bound to the thread of the ReaderManager.
+		if (type == ReaderManagerPluginType::SMART)
+		{
+			qCWarning(card) << "Plugin needs the ReaderManager thread:" << type;
+			continue;
+		}
+
+		types += type;
+	}
+
+	return types;
+}
+
+
 void ReaderManagerWorker::registerPlugin(ReaderManagerPlugin* pPlugin)
 {
 	Q_ASSERT(pPlugin != nullptr);
@@ -112,7 +172,16 @@ void ReaderManagerWorker::registerPlugin(ReaderManagerPlugin* pPlugin)
 
 	mPlugins << pPlugin;
 
-	connect(pPlugin, &ReaderManagerPlugin::fireReaderAdded, this, &ReaderManagerWorker::fireReaderAdded);
+	static const auto threadedPluginTypes = getThreadedPluginTypes();
+	if (const auto type = pPlugin->getInfo().getPluginType(); threadedPluginTypes.contains(type))
+	{
+		moveToPluginThread(pPlugin, type);
+	}
+
+	connect(pPlugin, &ReaderManagerPlugin::fireReaderAdded, this, [this, pPlugin](const ReaderInfo& pInfo){
+			mReaderPlugins.insert(pInfo.getName(), pPlugin);
+			Q_EMIT fireReaderAdded(pInfo);
+		});
 	connect(pPlugin, &ReaderManagerPlugin::fireReaderRemoved, this, &ReaderManagerWorker::onReaderRemoved);
 	connect(pPlugin, &ReaderManagerPlugin::fireReaderPropertiesUpdated, this, &ReaderManagerWorker::fireReaderPropertiesUpdated);
 	connect(pPlugin, &ReaderManagerPlugin::fireStatusChanged, this, &ReaderManagerWorker::fireStatusChanged);
@@ -122,19 +191,86 @@ void ReaderManagerWorker::registerPlugin(ReaderManagerPlugin* pPlugin)
 }
 
 
+void ReaderManagerWorker::moveToPluginThread(ReaderManagerPlugin* pPlugin, ReaderManagerPluginType pType)
+{
+	auto* thread = new QThread();
+	thread->setObjectName(QStringLiteral("ReaderManagerThread-%1").arg(getEnumName(pType)));
+	pPlugin->setReaderThreads(true);
+	pPlugin->moveToThread(thread);
+	thread->start();
+	mPluginThreads << thread;
+
+	qCDebug(card).noquote() << "Moved" << pPlugin->metaObject()->className() << "to" << thread->objectName();
+}
+
+
+void ReaderManagerWorker::runOnPluginThread(ReaderManagerPlugin* pPlugin, const std::function<void()>& pFunc)
+{
+	if (pPlugin->thread() == QThread::currentThread())
+	{
+		pFunc();
+		return;
+	}
+
+	QMetaObject::invokeMethod(pPlugin, pFunc, Qt::BlockingQueuedConnection);
+}
+
+
 void ReaderManagerWorker::callOnPlugin(ReaderManagerPluginType pType, const std::function<void(ReaderManagerPlugin*)>& pFunc, const char* pLog)
 {
 	for (auto& plugin : std::as_const(mPlugins))
 	{
-		if (plugin->getInfo().getPluginType() == pType)
+		// The type of a plugin does not change, so it is read without its thread.
+		if (plugin->getInfo().getPluginType() != pType)
 		{
-			qCDebug(card).nospace() << pLog << ": " << plugin->metaObject()->className();
-			pFunc(plugin);
+			continue;
 		}
+
+		runOnPluginThread(plugin, [plugin, &pFunc, pLog] {
+				qCDebug(card).nospace() << pLog << ": " << plugin->metaObject()->className();
+				pFunc(plugin);
+			});
 	}
 }
 
 
+bool ReaderManagerWorker::callOnReader(const QString& pReaderName, const std::function<void(Reader*)>& pFunc) const
+{
+	Q_ASSERT(QObject::thread() == QThread::currentThread());
+
+	bool found = false;
+	if (auto* plugin = mReaderPlugins.value(pReaderName))
+	{
+		runOnPluginThread(plugin, [plugin, &pReaderName, &pFunc, &found] {
+				const auto& readerList = plugin->getReaders();
+				for (Reader* reader : readerList)
+				{
+					if (reader->getName() == pReaderName)
+					{
+						found = true;
+						ReaderManagerPlugin::runOnThread(reader, [reader, &pFunc] {
+								pFunc(reader);
+							});
+						return;
+					}
+				}
+			});
+	}
+
+	if (!found)
+	{
+		qCWarning(card) << "Requested reader does not exist:" << pReaderName;
+	}
+	return found;
+}
+
+
+bool ReaderManagerWorker::hasReaders(const ReaderManagerPlugin* pPlugin) const
+{
+	return std::find(mReaderPlugins.cbegin(), mReaderPlugins.cend(), pPlugin) != mReaderPlugins.cend();
+}
+
+
 void ReaderManagerWorker::reset(ReaderManagerPluginType pType)
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
@@ -161,9 +297,15 @@ void ReaderManagerWorker::shelve()
 
 	for (const auto& plugin : std::as_const(mPlugins))
 	{
-		callOnPlugin(plugin->getInfo().getPluginType(), [](ReaderManagerPlugin* pPlugin){
-				pPlugin->shelve();
-			}, "Shelve");
+		if (!hasReaders(plugin))
+		{
+			continue;
+		}
+
+		runOnPluginThread(plugin, [plugin] {
+				qCDebug(card) << "Shelve:" << plugin->metaObject()->className();
+				plugin->shelve();
+			});
 	}
 }
 
@@ -202,11 +344,20 @@ QList<ReaderInfo> ReaderManagerWorker::getReaderInfos() const
 	QList<ReaderInfo> list;
 	for (const auto& plugin : std::as_const(mPlugins))
 	{
-		const auto& readerList = plugin->getReaders();
-		for (const Reader* const reader : readerList)
+		if (!hasReaders(plugin))
 		{
-			list += reader->getReaderInfo();
+			continue;
 		}
+
+		runOnPluginThread(plugin, [plugin, &list] {
+				const auto& readerList = plugin->getReaders();
+				for (Reader* const reader : readerList)
+				{
+					ReaderManagerPlugin::runOnThread(reader, [reader, &list] {
+							list += reader->getReaderInfo();
+						});
+				}
+			});
 	}
 	return list;
 }
@@ -216,34 +367,9 @@ void ReaderManagerWorker::updateReaderInfo(const QString& pReaderName)
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
 
-	Reader* reader = getReader(pReaderName);
-	if (reader == nullptr)
-	{
-		qCWarning(card) << "Requested reader does not exist:" << pReaderName;
-		return;
-	}
-	reader->updateCard();
-}
-
-
-Reader* ReaderManagerWorker::getReader(const QString& pReaderName) const
-{
-	Q_ASSERT(QObject::thread() == QThread::currentThread());
-
-	for (auto& plugin : std::as_const(mPlugins))
-	{
-		const auto& readerList = plugin->getReaders();
-		for (Reader* reader : readerList)
-		{
-			if (reader->getName() == pReaderName)
-			{
-				return reader;
-			}
-		}
-	}
-
-	qCWarning(card) << "Requested reader does not exist:" << pReaderName;
-	return nullptr;
+	callOnReader(pReaderName, [](Reader* pReader){
+			pReader->updateCard();
+		});
 }
 
 
@@ -251,14 +377,14 @@ void ReaderManagerWorker::createCardConnectionWorker(const QString& pReaderName,
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
 
+	// The CardConnectionWorker lives in the thread of the reader.
 	QSharedPointer<CardConnectionWorker> worker;
-	if (auto reader = getReader(pReaderName))
-	{
-		worker = reader->createCardConnectionWorker();
-		if (pInitWorker)
-		{
-			worker = pInitWorker(worker);
-		}
-	}
+	callOnReader(pReaderName, [&worker, &pInitWorker](Reader* pReader){
+			worker = pReader->createCardConnectionWorker();
+			if (pInitWorker)
+			{
+				worker = pInitWorker(worker);
+			}
+		});
 	Q_EMIT fireCardConnectionWorkerCreated(worker);
 }
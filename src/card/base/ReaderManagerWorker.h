@@ -4,6 +4,11 @@
 
 /*!
  * \brief Worker implementation of ReaderManger thread
+ *
+ * The plugins listed in the environment variable AUSWEISAPP2_READER_THREADS,
+ * e.g. "PCSC,SIMULATOR", are moved to their own thread and may move their
+ * readers to a thread per reader. A call to a reader blocks only until it is
+ * done in the thread of its plugin and reader.
  */
 
 #pragma once
@@ -13,7 +18,12 @@
 #include "ReaderManagerPlugin.h"
 #include "ReaderManagerPluginInfo.h"
 
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QThread>
+
+class test_ReaderManagerWorker;
 
 namespace governikus
 {
@@ -21,15 +31,22 @@ class ReaderManagerWorker
 	: public QObject
 {
 	Q_OBJECT
+	friend class ::test_ReaderManagerWorker;
 
 	private:
 		QList<ReaderManagerPlugin*> mPlugins;
+		QList<QThread*> mPluginThreads;
+		QHash<QString, ReaderManagerPlugin*> mReaderPlugins;
 
+		static void runOnPluginThread(ReaderManagerPlugin* pPlugin, const std::function<void()>& pFunc);
 		void callOnPlugin(ReaderManagerPluginType pType, const std::function<void(ReaderManagerPlugin* pPlugin)>& pFunc, const char* pLog);
+		bool callOnReader(const QString& pReaderName, const std::function<void(Reader* pReader)>& pFunc) const;
+		[[nodiscard]] bool hasReaders(const ReaderManagerPlugin* pPlugin) const;
 		void registerPlugins();
 		[[nodiscard]] static bool isPlugin(const QJsonObject& pJson);
+		[[nodiscard]] static QList<ReaderManagerPluginType> getThreadedPluginTypes();
 		void registerPlugin(ReaderManagerPlugin* pPlugin);
-		[[nodiscard]] Reader* getReader(const QString& pReaderName) const;
+		void moveToPluginThread(ReaderManagerPlugin* pPlugin, ReaderManagerPluginType pType);
 
 	public:
 		ReaderManagerWorker();
@@ -19,15 +19,27 @@ bool CVCertificateChainBuilder::isChild(const QSharedPointer<const CVCertificate
 }
 
 
+QByteArray CVCertificateChainBuilder::getCar(const QSharedPointer<const CVCertificate>& pCvc)
+{
+	return pCvc->getBody().getCertificationAuthorityReference();
+}
+
+
+QByteArray CVCertificateChainBuilder::getChr(const QSharedPointer<const CVCertificate>& pCvc)
+{
+	return pCvc->getBody().getCertificateHolderReference();
+}
+
+
 CVCertificateChainBuilder::CVCertificateChainBuilder(bool pProductive)
-	: ChainBuilder(QList<QSharedPointer<const CVCertificate>>(), &CVCertificateChainBuilder::isChild)
+	: ChainBuilder(QList<QSharedPointer<const CVCertificate>>(), &CVCertificateChainBuilder::isChild, &CVCertificateChainBuilder::getCar, &CVCertificateChainBuilder::getChr)
 	, mProductive(pProductive)
 {
 }
 
 
 CVCertificateChainBuilder::CVCertificateChainBuilder(const QList<QSharedPointer<const CVCertificate>>& pCvcPool, bool pProductive)
-	: ChainBuilder(pCvcPool, &CVCertificateChainBuilder::isChild)
+	: ChainBuilder(pCvcPool, &CVCertificateChainBuilder::isChild, &CVCertificateChainBuilder::getCar, &CVCertificateChainBuilder::getChr)
 	, mProductive(pProductive)
 {
 	removeInvalidChains();
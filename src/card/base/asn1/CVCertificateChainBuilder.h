@@ -24,6 +24,8 @@ class CVCertificateChainBuilder
 		bool mProductive;
 
 		static bool isChild(const QSharedPointer<const CVCertificate>& pChild, const QSharedPointer<const CVCertificate>& pParent);
+		static QByteArray getCar(const QSharedPointer<const CVCertificate>& pCvc);
+		static QByteArray getChr(const QSharedPointer<const CVCertificate>& pCvc);
 
 		void removeInvalidChains();
 
@@ -7,12 +7,21 @@
  * The ChainBuilder is initialized with a pool of objects and a (pointer to a) function
  * that decides if two objects have a parent child relation. Duplicates are filtered out.
  *
+ * The objects are indexed by the keys of their issuer and subject, so only objects with
+ * a matching key are passed to the function. The chains are built by a walk from every
+ * root to the leafs of the resulting graph, the chains below an object are built once.
+ *
  * All found chains are returned by the function /ref ChainBuilder::getChains().
  */
 
 #pragma once
 
+#include <QByteArray>
+#include <QHash>
 #include <QList>
+#include <QMultiHash>
+#include <QSet>
+
 #include <algorithm>
 #include <functional>
 
@@ -23,50 +32,72 @@ namespace governikus
 template<typename T>
 class ChainBuilder
 {
+	public:
+		using IsChildFunc = std::function<bool (const T& pChild, const T& pParent)>;
+		using KeyFunc = std::function<QByteArray(const T& pElement)>;
+
 	private:
 		QList<QList<T>> mChains;
-		std::function<bool(const T& pChild, const T& pParent)> mIsChildFunc;
+		QList<T> mElements;
+		QList<QByteArray> mSubjectKeys;
+		QMultiHash<QByteArray, qsizetype> mChildren;
+		IsChildFunc mIsChildFunc;
 
-		void buildChain(const QList<T>& pAllElements, const QList<T>& pChain)
-		{
-			bool chainComplete = true;
+		QHash<qsizetype, QList<QList<T>>> mChainsFrom;
+		QSet<qsizetype> mInProgress;
 
-			for (const auto& elem : pAllElements)
+		[[nodiscard]] QList<qsizetype> getChildren(qsizetype pParent) const
+		{
+			QList<qsizetype> children;
+			const auto& parent = mElements.at(pParent);
+			const auto& candidates = mChildren.values(mSubjectKeys.at(pParent));
+			for (const auto candidate : candidates)
 			{
-				if (pChain.contains(elem))
+				if (candidate != pParent && mIsChildFunc(mElements.at(candidate), parent))
 				{
-					continue;
+					children += candidate;
 				}
+			}
+
+			std::sort(children.begin(), children.end());
+			return children;
+		}
+
+
+		QList<QList<T>> buildChains(qsizetype pElement)
+		{
+			if (const auto iter = mChainsFrom.constFind(pElement); iter != mChainsFrom.constEnd())
+			{
+				return *iter;
+			}
 
-				if (mIsChildFunc(elem, pChain.last()))
+			mInProgress += pElement;
+			QList<QList<T>> chains;
+			for (const auto child : getChildren(pElement))
+			{
+				if (mInProgress.contains(child))
 				{
-					QList<T> extendedChain(pChain);
-					extendedChain += elem;
-					buildChain(pAllElements, extendedChain);
-					chainComplete = false;
+					// Ignore cyclic relations, the chain ends here.
+					continue;
 				}
-				else if (mIsChildFunc(pChain.first(), elem))
+
+				for (const auto& chain : buildChains(child))
 				{
-					QList<T> extendedChain({elem});
-					extendedChain += pChain;
-					buildChain(pAllElements, extendedChain);
-					chainComplete = false;
+					QList<T> extendedChain;
+					extendedChain.reserve(chain.size() + 1);
+					extendedChain += mElements.at(pElement);
+					extendedChain += chain;
+					chains += extendedChain;
 				}
 			}
+			mInProgress -= pElement;
 
-			if (chainComplete && !isSubChain(pChain))
+			if (chains.isEmpty())
 			{
-				mChains += pChain;
+				chains += QList<T>({mElements.at(pElement)});
 			}
-		}
-
-
-		bool isSubChain(const QList<T>& pSubChain)
-		{
-			return std::any_of(mChains.constBegin(), mChains.constEnd(), [&pSubChain] (const QList<T>& pChain) {
-					return std::search(pChain.constBegin(), pChain.constEnd(), pSubChain.constBegin(), pSubChain.constEnd())
-						   != pChain.constEnd();
-				});
+			mChainsFrom.insert(pElement, chains);
+			return chains;
 		}
 
 	protected:
@@ -76,18 +107,60 @@ class ChainBuilder
 		}
 
 	public:
-		ChainBuilder(const QList<T>& pAllElements, const std::function<bool(const T& pChild, const T& pParent)>& pIsChildFunc)
+		ChainBuilder(const QList<T>& pAllElements, const IsChildFunc& pIsChildFunc, const KeyFunc& pGetIssuerKey, const KeyFunc& pGetSubjectKey)
 			: mChains()
+			, mElements()
+			, mSubjectKeys()
+			, mChildren()
 			, mIsChildFunc(pIsChildFunc)
+			, mChainsFrom()
+			, mInProgress()
 		{
+			QSet<T> uniqueElements;
+			QMultiHash<QByteArray, qsizetype> parents;
 			for (const auto& elem : pAllElements)
 			{
-				const QList<T> chain({elem});
-				if (!isSubChain(chain))
+				if (uniqueElements.contains(elem))
+				{
+					continue;
+				}
+				uniqueElements += elem;
+
+				const auto index = mElements.size();
+				mElements += elem;
+				mSubjectKeys += pGetSubjectKey(elem);
+				mChildren.insert(pGetIssuerKey(elem), index);
+				parents.insert(mSubjectKeys.last(), index);
+			}
+
+			QList<qsizetype> roots;
+			for (qsizetype i = 0; i < mElements.size(); ++i)
+			{
+				const auto& candidates = parents.values(pGetIssuerKey(mElements.at(i)));
+				const bool hasParent = std::any_of(candidates.constBegin(), candidates.constEnd(), [this, i](qsizetype pCandidate) {
+						return pCandidate != i && mIsChildFunc(mElements.at(i), mElements.at(pCandidate));
+					});
+				if (!hasParent)
 				{
-					buildChain(pAllElements, chain);
+					roots += i;
 				}
 			}
+
+			for (const auto root : std::as_const(roots))
+			{
+				mChains += buildChains(root);
+			}
+
+			// Elements of a cycle have no root, start with the first one that is not part of a chain.
+			for (qsizetype i = 0; i < mElements.size(); ++i)
+			{
+				if (!mChainsFrom.contains(i))
+				{
+					mChains += buildChains(i);
+				}
+			}
+
+			mChainsFrom.clear();
 		}
 
 
@@ -7,7 +7,11 @@
 #include "ASN1TemplateUtil.h"
 #include "pace/ec/EcUtil.h"
 
+#include <QCache>
+#include <QCryptographicHash>
 #include <QLoggingCategory>
+#include <QMutex>
+#include <QMutexLocker>
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
@@ -18,8 +22,17 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 
 
-SignatureChecker::SignatureChecker(const QList<QSharedPointer<const CVCertificate>>& pCertificateChain)
+namespace
+{
+const qsizetype cCacheSize = 128;
+QMutex cCacheMutex;
+QCache<QByteArray, QDate> cVerifiedSignatures(cCacheSize); // expiration date of the verified certificate
+} // namespace
+
+
+SignatureChecker::SignatureChecker(const QList<QSharedPointer<const CVCertificate>>& pCertificateChain, const QDateTime& pValidationDateTime)
 	: mCertificateChain(pCertificateChain)
+	, mValidationDateTime(pValidationDateTime)
 {
 }
 
@@ -33,8 +46,8 @@ bool SignatureChecker::check() const
 	}
 
 	auto signingCert = mCertificateChain.at(0);
-	const EcdsaPublicKey* parentKey = &signingCert->getBody().getPublicKey();
-	if (!parentKey->isComplete())
+	auto keyCert = signingCert;
+	if (!keyCert->getBody().getPublicKey().isComplete())
 	{
 		qCCritical(card) << "No elliptic curve parameters";
 		return false;
@@ -42,15 +55,15 @@ bool SignatureChecker::check() const
 
 	for (const auto& cert : mCertificateChain)
 	{
-		if (!checkSignature(cert, signingCert, parentKey))
+		if (!checkSignature(cert, signingCert, keyCert))
 		{
 			qCCritical(card) << "Certificate verification failed:" << cert->getBody().getCertificateHolderReference();
 			return false;
 		}
 
-		if (const auto& certKey = cert->getBody().getPublicKey(); certKey.isComplete())
+		if (cert->getBody().getPublicKey().isComplete())
 		{
-			parentKey = &certKey;
+			keyCert = cert;
 		}
 		signingCert = cert;
 	}
@@ -59,12 +72,19 @@ bool SignatureChecker::check() const
 }
 
 
-bool SignatureChecker::checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const EcdsaPublicKey* pKey) const
+bool SignatureChecker::checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const QSharedPointer<const CVCertificate>& pKeyCert) const
 {
+	const auto& cacheKey = getCacheKey(pCert, pSigningCert, pKeyCert);
+	if (isVerified(cacheKey))
+	{
+		qCDebug(card) << "Signature already verified:" << pCert->getBody().getCertificateHolderReference();
+		return true;
+	}
+
 	ERR_clear_error();
 
 	// Some keys are "incomplete": So we need to use the parameters of the parent key and current public point.
-	const QSharedPointer<EVP_PKEY> signingKey = pKey->createKey(pSigningCert->getBody().getPublicKey().getUncompressedPublicPoint());
+	const QSharedPointer<EVP_PKEY> signingKey = pKeyCert->getBody().getPublicKey().createKey(pSigningCert->getBody().getPublicKey().getUncompressedPublicPoint());
 	if (signingKey.isNull())
 	{
 		qCCritical(card) << "Cannot fetch signing key";
@@ -91,5 +111,68 @@ bool SignatureChecker::checkSignature(const QSharedPointer<const CVCertificate>&
 		qCCritical(card) << "Signature verification failed, an error occurred:" << getOpenSslError();
 	}
 
+	if (result == 1)
+	{
+		setVerified(cacheKey, pCert);
+	}
 	return result == 1;
 }
+
+
+QByteArray SignatureChecker::getCacheKey(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const QSharedPointer<const CVCertificate>& pKeyCert)
+{
+	QCryptographicHash issuerHash(QCryptographicHash::Sha256);
+	issuerHash.addData(pKeyCert->getRawBody());
+	issuerHash.addData(pSigningCert->getRawBody());
+
+	QCryptographicHash certHash(QCryptographicHash::Sha256);
+	certHash.addData(pCert->getRawBody());
+	certHash.addData(pCert->getDerSignature());
+
+	return issuerHash.result() + certHash.result();
+}
+
+
+bool SignatureChecker::isVerified(const QByteArray& pCacheKey) const
+{
+	const QMutexLocker locker(&cCacheMutex);
+	const auto* expirationDate = cVerifiedSignatures.object(pCacheKey);
+	if (expirationDate == nullptr)
+	{
+		return false;
+	}
+
+	if (*expirationDate < mValidationDateTime.toUTC().date())
+	{
+		cVerifiedSignatures.remove(pCacheKey);
+		return false;
+	}
+
+	return true;
+}
+
+
+void SignatureChecker::setVerified(const QByteArray& pCacheKey, const QSharedPointer<const CVCertificate>& pCert) const
+{
+	if (!pCert->isValidOn(mValidationDateTime))
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&cCacheMutex);
+	cVerifiedSignatures.insert(pCacheKey, new QDate(pCert->getBody().getCertificateExpirationDate()));
+}
+
+
+int SignatureChecker::getCacheCount()
+{
+	const QMutexLocker locker(&cCacheMutex);
+	return static_cast<int>(cVerifiedSignatures.count());
+}
+
+
+void SignatureChecker::clearCache()
+{
+	const QMutexLocker locker(&cCacheMutex);
+	cVerifiedSignatures.clear();
+}
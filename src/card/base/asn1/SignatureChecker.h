@@ -6,20 +6,39 @@
 
 #include "asn1/CVCertificate.h"
 
+#include <QByteArray>
+#include <QDateTime>
 #include <QList>
 
+
+class test_SignatureChecker;
+
+
 namespace governikus
 {
 
 class SignatureChecker
 {
+	friend class ::test_SignatureChecker;
+
 	private:
 		const QList<QSharedPointer<const CVCertificate>> mCertificateChain;
+		const QDateTime mValidationDateTime;
+
+		bool checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const QSharedPointer<const CVCertificate>& pKeyCert) const;
 
-		bool checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const EcdsaPublicKey* pKey) const;
+		/*!
+		 * Signatures of certificates that are valid on the validation date are remembered
+		 * process-wide until the certificate expires, so they are not verified again by later workflows.
+		 */
+		[[nodiscard]] static QByteArray getCacheKey(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const QSharedPointer<const CVCertificate>& pKeyCert);
+		[[nodiscard]] bool isVerified(const QByteArray& pCacheKey) const;
+		void setVerified(const QByteArray& pCacheKey, const QSharedPointer<const CVCertificate>& pCert) const;
+		static int getCacheCount();
+		static void clearCache();
 
 	public:
-		explicit SignatureChecker(const QList<QSharedPointer<const CVCertificate>>& pCertificateChain);
+		explicit SignatureChecker(const QList<QSharedPointer<const CVCertificate>>& pCertificateChain, const QDateTime& pValidationDateTime = QDateTime::currentDateTime());
 		~SignatureChecker() = default;
 
 		[[nodiscard]] bool check() const;
@@ -29,7 +29,20 @@ BaseCardCommand::BaseCardCommand(QSharedPointer<CardConnectionWorker> pCardConne
 
 void BaseCardCommand::run()
 {
-	QMetaObject::invokeMethod(this, &BaseCardCommand::execute, Qt::QueuedConnection);
+	QMetaObject::invokeMethod(this, &BaseCardCommand::enqueue, Qt::QueuedConnection);
+}
+
+
+void BaseCardCommand::enqueue()
+{
+	if (auto* queue = mCardConnectionWorker->getCommandQueue())
+	{
+		queue->enqueue(this);
+		return;
+	}
+
+	// Without a reader the command fails immediately.
+	execute();
 }
 
 
@@ -39,7 +52,22 @@ void BaseCardCommand::execute()
 
 	internalExecute();
 	qCDebug(card) << metaObject()->className() << "| ReturnCode of internal execute:" << mReturnCode;
+	done();
+}
+
 
+void BaseCardCommand::finish(CardReturnCode pReturnCode)
+{
+	Q_ASSERT(QObject::thread() == QThread::currentThread());
+
+	mReturnCode = pReturnCode;
+	qCDebug(card) << metaObject()->className() << "| ReturnCode without execution:" << mReturnCode;
+	done();
+}
+
+
+void BaseCardCommand::done()
+{
 	// A "Command" is created by CardConnection::call() in Main-Thread and moved to ReaderManager-Thread.
 	// The internal execution of a command will be self-sufficient until it has finished. After the
 	// command is finished it is a data container only. It will fires a signal with itself wrapped into a
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "CardConnectionWorker.h"
+#include "CardCommandQueue.h"
 #include "CardReturnCode.h"
 
 #include <QSharedPointer>
@@ -23,9 +24,16 @@ class BaseCardCommand
 {
 	Q_OBJECT
 	friend class ::test_CardConnection;
+	friend class CardCommandQueue;
+
+	public:
+		using Priority = CardCommandQueue::Priority;
 
 	private:
-		Q_INVOKABLE void execute();
+		Q_INVOKABLE void enqueue();
+		void execute();
+		void finish(CardReturnCode pReturnCode);
+		void done();
 		QSharedPointer<CardConnectionWorker> mCardConnectionWorker;
 		CardReturnCode mReturnCode;
 
@@ -50,6 +58,22 @@ class BaseCardCommand
 	public:
 		void run();
 
+		[[nodiscard]] virtual Priority getPriority() const
+		{
+			return Priority::INTERACTIVE;
+		}
+
+
+		/*!
+		 * A coalescable command is answered by a pending command of the same
+		 * type on the same reader. So its result must be contained in the return code.
+		 */
+		[[nodiscard]] virtual bool isCoalescable() const
+		{
+			return false;
+		}
+
+
 		[[nodiscard]] CardReturnCode getReturnCode() const
 		{
 			return mReturnCode;
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "CardCommandQueue.h"
+
+#include "BaseCardCommand.h"
+
+#include <QLoggingCategory>
+#include <QThread>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+CardCommandQueue::CardCommandQueue(QObject* pContext)
+	: mContext(pContext)
+	, mEntries()
+	, mDispatchPending(false)
+	, mMetrics()
+{
+	Q_ASSERT(mContext);
+}
+
+
+CardCommandQueue::~CardCommandQueue()
+{
+	for (const auto& entry : std::as_const(mEntries))
+	{
+		if (entry.mCommand)
+		{
+			entry.mCommand->finish(CardReturnCode::CARD_NOT_FOUND);
+		}
+		for (auto* command : entry.mCoalesced)
+		{
+			command->finish(CardReturnCode::CARD_NOT_FOUND);
+		}
+	}
+}
+
+
+bool CardCommandQueue::coalesce(const QByteArray& pKey, BaseCardCommand* pCommand)
+{
+	if (pKey.isEmpty())
+	{
+		return false;
+	}
+
+	for (auto& entry : mEntries)
+	{
+		if (entry.mKey == pKey)
+		{
+			qCDebug(card) << "Coalescing" << pKey << "with pending entry";
+			if (pCommand)
+			{
+				entry.mCoalesced += pCommand;
+			}
+			++mMetrics.mCoalesced;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+void CardCommandQueue::insert(Entry pEntry)
+{
+	const auto priority = pEntry.mPriority;
+	const auto position = std::find_if(mEntries.cbegin(), mEntries.cend(), [priority](const Entry& pPending){
+				return pPending.mPriority < priority;
+			});
+
+	pEntry.mWaiting.start();
+	mEntries.insert(position, pEntry);
+	mMetrics.mMaxDepth = std::max(mMetrics.mMaxDepth, mEntries.size());
+
+	scheduleDispatch();
+}
+
+
+void CardCommandQueue::enqueue(BaseCardCommand* pCommand)
+{
+	Q_ASSERT(mContext->thread() == QThread::currentThread());
+
+	const QByteArray key = pCommand->isCoalescable() ? QByteArray(pCommand->metaObject()->className()) : QByteArray();
+	if (coalesce(key, pCommand))
+	{
+		return;
+	}
+
+	insert({pCommand->getPriority(), key, pCommand, {}, {}, QElapsedTimer()});
+}
+
+
+void CardCommandQueue::enqueue(Priority pPriority, const QByteArray& pKey, const std::function<void()>& pJob)
+{
+	Q_ASSERT(mContext->thread() == QThread::currentThread());
+
+	if (coalesce(pKey, nullptr))
+	{
+		return;
+	}
+
+	insert({pPriority, pKey, nullptr, pJob, {}, QElapsedTimer()});
+}
+
+
+void CardCommandQueue::scheduleDispatch()
+{
+	if (mDispatchPending)
+	{
+		return;
+	}
+
+	mDispatchPending = true;
+	QMetaObject::invokeMethod(mContext, [this] {
+			dispatch();
+		}, Qt::QueuedConnection);
+}
+
+
+void CardCommandQueue::dispatch()
+{
+	mDispatchPending = false;
+	if (mEntries.isEmpty())
+	{
+		return;
+	}
+
+	const auto entry = mEntries.takeFirst();
+	const auto waited = entry.mWaiting.nsecsElapsed();
+	++mMetrics.mExecuted;
+	mMetrics.mTotalWait += waited;
+	mMetrics.mMaxWait = std::max(mMetrics.mMaxWait, waited);
+
+	if (entry.mCommand)
+	{
+		qCDebug(card) << entry.mCommand->metaObject()->className() << "waited" << waited / 1000 << "µs with" << mEntries.size() << "further entries pending";
+
+		// The commands are deleted later, so they are still valid after they are done.
+		entry.mCommand->execute();
+		for (auto* command : entry.mCoalesced)
+		{
+			command->finish(entry.mCommand->getReturnCode());
+		}
+	}
+	else
+	{
+		qCDebug(card) << entry.mKey << "waited" << waited / 1000 << "µs with" << mEntries.size() << "further entries pending";
+		entry.mJob();
+	}
+
+	if (!mEntries.isEmpty())
+	{
+		scheduleDispatch();
+	}
+}
+
+
+bool CardCommandQueue::isEmpty() const
+{
+	return mEntries.isEmpty();
+}
+
+
+qsizetype CardCommandQueue::size() const
+{
+	return mEntries.size();
+}
+
+
+const CardCommandQueue::Metrics& CardCommandQueue::getMetrics() const
+{
+	return mMetrics;
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Queue of the card commands and background jobs of one \ref Reader
+ *
+ * Entries are executed one at a time by their priority and in the order of
+ * arrival within a priority. Other events of the reader thread can be handled
+ * between two entries. An entry with a key is not executed if an entry with
+ * the same key is already pending. A coalesced command gets the result of the
+ * pending command.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+
+#include <functional>
+
+
+namespace governikus
+{
+
+class BaseCardCommand;
+
+class CardCommandQueue
+{
+	Q_DISABLE_COPY(CardCommandQueue)
+
+	public:
+		enum class Priority
+		{
+			BACKGROUND,
+			INTERACTIVE
+		};
+
+		struct Metrics
+		{
+			qsizetype mMaxDepth = 0;
+			int mExecuted = 0;
+			int mCoalesced = 0;
+			qint64 mTotalWait = 0;
+			qint64 mMaxWait = 0;
+		};
+
+	private:
+		struct Entry
+		{
+			Priority mPriority;
+			QByteArray mKey;
+			BaseCardCommand* mCommand;
+			std::function<void()> mJob;
+			QList<BaseCardCommand*> mCoalesced;
+			QElapsedTimer mWaiting;
+		};
+
+		QObject* mContext;
+		QList<Entry> mEntries;
+		bool mDispatchPending;
+		Metrics mMetrics;
+
+		bool coalesce(const QByteArray& pKey, BaseCardCommand* pCommand);
+		void insert(Entry pEntry);
+		void scheduleDispatch();
+		void dispatch();
+
+	public:
+		explicit CardCommandQueue(QObject* pContext);
+
+		/*!
+		 * Pending commands are finished with CardReturnCode::CARD_NOT_FOUND,
+		 * pending jobs are dropped.
+		 */
+		~CardCommandQueue();
+
+		/*!
+		 * Has to be called in the thread of the context.
+		 */
+		void enqueue(BaseCardCommand* pCommand);
+
+		/*!
+		 * Has to be called in the thread of the context. The job is dropped if
+		 * a job with the same key is already pending.
+		 */
+		void enqueue(Priority pPriority, const QByteArray& pKey, const std::function<void()>& pJob);
+
+		[[nodiscard]] bool isEmpty() const;
+		[[nodiscard]] qsizetype size() const;
+
+		/*!
+		 * \brief Returns the maximum depth, the number of executed and coalesced
+		 * entries and the waiting times in nanoseconds.
+		 */
+		[[nodiscard]] const Metrics& getMetrics() const;
+};
+
+} // namespace governikus
@@ -10,8 +10,6 @@
 
 #include <QLoggingCategory>
 
-#include <algorithm>
-
 
 Q_DECLARE_LOGGING_CATEGORY(card)
 
@@ -36,19 +34,7 @@ TransmitCommand::TransmitCommand(QSharedPointer<CardConnectionWorker> pCardConne
 
 bool TransmitCommand::isAcceptable(const InputAPDUInfo& pInputApduInfo, const ResponseApdu& pResponse)
 {
-	const auto& acceptableStatusCodes = pInputApduInfo.getAcceptableStatusCodes();
-
-	if (acceptableStatusCodes.isEmpty())
-	{
-		return true;
-	}
-
-	const auto& responseBytes = pResponse.getStatusBytes().toHex();
-	return std::any_of(acceptableStatusCodes.constBegin(), acceptableStatusCodes.constEnd(),
-			[&responseBytes](const auto& pCode)
-			{
-				return responseBytes.startsWith(pCode); // according to TR-03112-6 chapter 3.2.5
-			});
+	return pInputApduInfo.isAcceptable(pResponse);
 }
 
 
@@ -57,9 +43,20 @@ void TransmitCommand::internalExecute()
 	Q_ASSERT(!mInputApduInfos.isEmpty());
 	Q_ASSERT(mOutputApduAsHex.isEmpty());
 
-	for (const auto& inputApduInfo : mInputApduInfos)
+	bool failed = false;
+	const auto& results = getCardConnectionWorker()->transmitBatch(mInputApduInfos, [this, &failed](const ResponseApduResult& pResult){
+			// Hand out every response early, so the PAOS response is assembled while the card is still busy.
+			failed |= pResult.mReturnCode != CardReturnCode::OK || pResult.mResponseApdu.isEmpty();
+			if (!failed)
+			{
+				Q_EMIT fireOutputApdu(QByteArray(pResult.mResponseApdu).toHex());
+			}
+		});
+	Q_ASSERT(results.size() <= mInputApduInfos.size());
+	for (qsizetype i = 0; i < results.size(); ++i)
 	{
-		auto [returnCode, response] = getCardConnectionWorker()->transmit(inputApduInfo.getInputApdu());
+		const auto& inputApduInfo = mInputApduInfos.at(i);
+		const auto& [returnCode, response] = results.at(i);
 		setReturnCode(returnCode);
 		if (getReturnCode() != CardReturnCode::OK)
 		{
@@ -85,6 +82,14 @@ void TransmitCommand::internalExecute()
 		setReturnCode(CardReturnCode::UNEXPECTED_TRANSMIT_STATUS);
 		return;
 	}
+
+	if (results.size() < mInputApduInfos.size())
+	{
+		qCWarning(card) << "Transmit unsuccessful. Received" << results.size() << "of" << mInputApduInfos.size() << "responses.";
+		setReturnCode(CardReturnCode::COMMAND_FAILED);
+		return;
+	}
+
 	qCDebug(card) << "transmit end";
 	setReturnCode(CardReturnCode::OK);
 }
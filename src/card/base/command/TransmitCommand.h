@@ -38,6 +38,12 @@ class TransmitCommand
 
 		static bool isAcceptable(const InputAPDUInfo& pInputApduInfo, const ResponseApdu& pResponse);
 
+		[[nodiscard]] const QList<InputAPDUInfo>& getInputApduInfos() const
+		{
+			return mInputApduInfos;
+		}
+
+
 		[[nodiscard]] const QByteArrayList& getOutputApduAsHex() const
 		{
 			return mOutputApduAsHex;
@@ -55,7 +61,11 @@ class TransmitCommand
 			return mSecureMessagingStopped;
 		}
 
-
+	Q_SIGNALS:
+		/*!
+		 * \brief Emitted in the thread of the worker for every response before the command is done.
+		 */
+		void fireOutputApdu(const QByteArray& pOutputApduAsHex);
 };
 
 } // namespace governikus
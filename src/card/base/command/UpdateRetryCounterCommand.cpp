@@ -17,3 +17,15 @@ void UpdateRetryCounterCommand::internalExecute()
 {
 	setReturnCode(getCardConnectionWorker()->updateRetryCounter());
 }
+
+
+BaseCardCommand::Priority UpdateRetryCounterCommand::getPriority() const
+{
+	return Priority::BACKGROUND;
+}
+
+
+bool UpdateRetryCounterCommand::isCoalescable() const
+{
+	return true;
+}
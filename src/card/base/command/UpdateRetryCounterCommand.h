@@ -28,6 +28,8 @@ class UpdateRetryCounterCommand
 	public:
 		explicit UpdateRetryCounterCommand(QSharedPointer<CardConnectionWorker> pCardConnectionWorker);
 
+		[[nodiscard]] Priority getPriority() const override;
+		[[nodiscard]] bool isCoalescable() const override;
 };
 
 } // namespace governikus
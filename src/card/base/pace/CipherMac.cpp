@@ -7,6 +7,8 @@
 #include <QLoggingCategory>
 #include <QScopeGuard>
 
+#include <algorithm>
+
 using namespace governikus;
 
 
@@ -16,6 +18,7 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 CipherMac::CipherMac(const SecurityProtocol& pSecurityProtocol, const QByteArray& pKeyBytes)
 #if OPENSSL_VERSION_NUMBER < 0x30000000L
 	: mKey(nullptr)
+	, mCtx(nullptr)
 #else
 	: mMac(nullptr)
 	, mCtx(nullptr)
@@ -39,6 +42,7 @@ CipherMac::CipherMac(const SecurityProtocol& pSecurityProtocol, const QByteArray
 	}
 
 	mKey = EVP_PKEY_new_CMAC_key(nullptr, reinterpret_cast<const uchar*>(pKeyBytes.constData()), static_cast<size_t>(pKeyBytes.size()), cipher);
+	mCtx = EVP_MD_CTX_create();
 
 #else
 
@@ -83,6 +87,7 @@ CipherMac::CipherMac(const SecurityProtocol& pSecurityProtocol, const QByteArray
 CipherMac::~CipherMac()
 {
 #if OPENSSL_VERSION_NUMBER < 0x30000000L
+	EVP_MD_CTX_destroy(mCtx);
 	EVP_PKEY_free(mKey);
 #else
 	EVP_MAC_CTX_free(mCtx);
@@ -94,7 +99,7 @@ CipherMac::~CipherMac()
 bool CipherMac::isInitialized() const
 {
 #if OPENSSL_VERSION_NUMBER < 0x30000000L
-	return mKey != nullptr;
+	return mKey != nullptr && mCtx != nullptr;
 
 #else
 	return mMac != nullptr && mCtx != nullptr;
@@ -104,68 +109,75 @@ bool CipherMac::isInitialized() const
 
 
 QByteArray CipherMac::generate(const QByteArray& pMessage)
+{
+	QByteArray value(MAC_SIZE, Qt::Uninitialized);
+	if (!generate({pMessage}, value.data()))
+	{
+		return QByteArray();
+	}
+
+	return value;
+}
+
+
+bool CipherMac::generate(std::initializer_list<QByteArrayView> pParts, char* pMac)
 {
 	if (!isInitialized())
 	{
 		qCCritical(card) << "CipherMac not successfully initialized";
-		return QByteArray();
+		return false;
 	}
 
 #if OPENSSL_VERSION_NUMBER < 0x30000000L
-	QSharedPointer<EVP_MD_CTX> ctx(EVP_MD_CTX_create(), [](EVP_MD_CTX* pCtx)
-		{
-			EVP_MD_CTX_destroy(pCtx);
-		});
-
-	if (ctx.isNull() || !EVP_DigestSignInit(ctx.data(), nullptr, nullptr, nullptr, mKey))
+	if (!EVP_MD_CTX_reset(mCtx) || !EVP_DigestSignInit(mCtx, nullptr, nullptr, nullptr, mKey))
 	{
 		qCCritical(card) << "Cannot init ctx";
-		return QByteArray();
+		return false;
 	}
 
-	if (!EVP_DigestSignUpdate(ctx.data(), pMessage.constData(), static_cast<size_t>(pMessage.size())))
+	for (const auto& part : pParts)
 	{
-		qCCritical(card) << "Cannot update cmac";
-		return QByteArray();
+		if (!EVP_DigestSignUpdate(mCtx, part.data(), static_cast<size_t>(part.size())))
+		{
+			qCCritical(card) << "Cannot update cmac";
+			return false;
+		}
 	}
 
-	QByteArray value(EVP_MAX_MD_SIZE, '\0');
-	if (auto ret = static_cast<size_t>(value.size());
-			!EVP_DigestSignFinal(ctx.data(), reinterpret_cast<uchar*>(value.data()), &ret))
+	uchar value[EVP_MAX_MD_SIZE];
+	if (size_t ret = sizeof(value); !EVP_DigestSignFinal(mCtx, value, &ret))
 	{
 		qCCritical(card) << "Cannot finalize cmac";
-		return QByteArray();
+		return false;
 	}
 
 #else
-	auto* ctx = EVP_MAC_CTX_dup(mCtx);
-	const auto guard = qScopeGuard([ctx] {
-			EVP_MAC_CTX_free(ctx);
-		});
-
-	if (!EVP_MAC_init(ctx, nullptr, 0, nullptr))
+	// Passing no key restarts the computation with the key that is already set up
+	if (!EVP_MAC_init(mCtx, nullptr, 0, nullptr))
 	{
 		qCCritical(card) << "Cannot init ctx";
-		return QByteArray();
+		return false;
 	}
 
-	if (!EVP_MAC_update(ctx, reinterpret_cast<const uchar*>(pMessage.constData()), static_cast<size_t>(pMessage.size())))
+	for (const auto& part : pParts)
 	{
-		qCCritical(card) << "Cannot update cmac";
-		return QByteArray();
+		if (!EVP_MAC_update(mCtx, reinterpret_cast<const uchar*>(part.data()), static_cast<size_t>(part.size())))
+		{
+			qCCritical(card) << "Cannot update cmac";
+			return false;
+		}
 	}
 
-	QByteArray value(static_cast<int>(EVP_MAC_CTX_get_mac_size(ctx)), '\0');
+	uchar value[EVP_MAX_BLOCK_LENGTH];
 	size_t writtenBytes;
-	if (!EVP_MAC_final(ctx, reinterpret_cast<uchar*>(value.data()), &writtenBytes, static_cast<size_t>(value.size())))
+	if (!EVP_MAC_final(mCtx, value, &writtenBytes, sizeof(value)))
 	{
 		qCCritical(card) << "Cannot finalize cmac";
-		return QByteArray();
+		return false;
 	}
 
 #endif
 
-	// Use only 8 bytes, according to TR 03110 Part 3, A.2.4.2, E.2.2.2
-	value.resize(8);
-	return value;
+	std::copy_n(value, MAC_SIZE, reinterpret_cast<uchar*>(pMac));
+	return true;
 }
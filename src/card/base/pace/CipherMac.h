@@ -11,8 +11,11 @@
 #include "SecurityProtocol.h"
 
 #include <QByteArray>
+#include <QByteArrayView>
 #include <openssl/evp.h>
 
+#include <initializer_list>
+
 namespace governikus
 {
 
@@ -23,6 +26,7 @@ class CipherMac final
 	private:
 #if OPENSSL_VERSION_NUMBER < 0x30000000L
 		EVP_PKEY * mKey;
+		EVP_MD_CTX* mCtx;
 
 #else
 		EVP_MAC* mMac;
@@ -30,6 +34,9 @@ class CipherMac final
 #endif
 
 	public:
+		// Use only 8 bytes, according to TR 03110 Part 3, A.2.4.2, E.2.2.2
+		static constexpr int MAC_SIZE = 8;
+
 		/*!
 		 * \brief Creates a new instance with cipher algorithm determined by parameter and specified MAC key.
 		 * \param pSecurityProtocol will determine the cipher algorithm to use. E.g. a PACE protocol
@@ -50,6 +57,16 @@ class CipherMac final
 		 * \return the MAC of the message
 		 */
 		QByteArray generate(const QByteArray& pMessage);
+
+		/*!
+		 * \brief Generates the MAC of a message that is given in several parts.
+		 *
+		 * The keyed context is reused, so no key setup or allocation takes place.
+		 * \param pParts the parts of the message. They are processed as if concatenated.
+		 * \param pMac buffer of at least MAC_SIZE bytes that receives the MAC.
+		 * \return true on success
+		 */
+		bool generate(std::initializer_list<QByteArrayView> pParts, char* pMac);
 };
 
 } // namespace governikus
@@ -4,12 +4,13 @@
 
 #include "apdu/SecureMessagingCommand.h"
 #include "apdu/SecureMessagingResponse.h"
-#include "asn1/ASN1Util.h"
 #include "pace/SecureMessaging.h"
 
 #include <QLoggingCategory>
 #include <QtEndian>
 
+#include <algorithm>
+
 
 using namespace governikus;
 
@@ -19,7 +20,50 @@ Q_DECLARE_LOGGING_CATEGORY(secure)
 
 
 const char ISO_LEADING_PAD_BYTE = static_cast<char>(0x80);
-const char ISO_PAD_BYTE = 0x00;
+const char PADDING_CONTENT_INDICATOR = 0x01;
+const char SM_TAG_ENCRYPTED_DATA = static_cast<char>(0x87);
+const char SM_TAG_PROTECTED_LE = static_cast<char>(0x97);
+const char SM_TAG_PROCESSING_STATUS = static_cast<char>(0x99);
+const char SM_TAG_CHECKSUM = static_cast<char>(0x8E);
+
+// ISO padding block, the remaining bytes are initialized with ISO_PAD_BYTE (0x00)
+const char ISO_PADDING[EVP_MAX_BLOCK_LENGTH] = {ISO_LEADING_PAD_BYTE};
+const char ZERO_BLOCK[EVP_MAX_BLOCK_LENGTH] = {};
+
+
+namespace
+{
+[[nodiscard]] qsizetype getTlvSize(qsizetype pValueSize)
+{
+	if (pValueSize < 0x80)
+	{
+		return 2 + pValueSize;
+	}
+
+	return (pValueSize <= 0xFF ? 3 : 4) + pValueSize;
+}
+
+
+char* writeTlvHeader(char* pOutput, char pTag, qsizetype pValueSize)
+{
+	Q_ASSERT(pValueSize <= 0xFFFF);
+
+	*pOutput++ = pTag;
+	if (pValueSize > 0xFF)
+	{
+		*pOutput++ = static_cast<char>(0x82);
+		*pOutput++ = static_cast<char>(pValueSize >> 8 & 0xFF);
+	}
+	else if (pValueSize >= 0x80)
+	{
+		*pOutput++ = static_cast<char>(0x81);
+	}
+	*pOutput++ = static_cast<char>(pValueSize & 0xFF);
+	return pOutput;
+}
+
+
+} // namespace
 
 
 SecureMessaging::SecureMessaging(const SecurityProtocol& pSecurityProtocol, const QByteArray& pEncKey, const QByteArray& pMacKey)
@@ -38,22 +82,19 @@ bool SecureMessaging::isInitialized() const
 }
 
 
-QByteArray SecureMessaging::padToCipherBlockSize(const QByteArray& pData) const
+qsizetype SecureMessaging::getPaddingSize(qsizetype pDataSize) const
 {
-	Q_ASSERT(!pData.isEmpty());
+	return mCipher.getBlockSize() - pDataSize % mCipher.getBlockSize();
+}
 
-	const auto remainder = pData.size() % mCipher.getBlockSize();
-	const auto paddingSize = (remainder == 0) ? mCipher.getBlockSize() : mCipher.getBlockSize() - remainder;
 
-	QByteArray paddedData;
-	paddedData += pData;
-	paddedData += ISO_LEADING_PAD_BYTE;
-	paddedData += QByteArray(paddingSize - 1, ISO_PAD_BYTE);
-	return paddedData;
+QByteArrayView SecureMessaging::getPadding(qsizetype pDataSize) const
+{
+	return QByteArrayView(ISO_PADDING, getPaddingSize(pDataSize));
 }
 
 
-QByteArray SecureMessaging::unpadFromCipherBlockSize(const QByteArray& pData) const
+QByteArray SecureMessaging::unpadFromCipherBlockSize(QByteArray pData) const
 {
 	Q_ASSERT(!pData.isEmpty());
 
@@ -70,7 +111,58 @@ QByteArray SecureMessaging::unpadFromCipherBlockSize(const QByteArray& pData) co
 		return QByteArray();
 	}
 
-	return pData.mid(0, position);
+	pData.truncate(position);
+	return pData;
+}
+
+
+void SecureMessaging::writeSendSequenceCounter(char* pBuffer) const
+{
+	const auto counterOffset = mCipher.getBlockSize() - static_cast<int>(sizeof(mSendSequenceCounter));
+	std::fill_n(pBuffer, counterOffset, '\0');
+	qToBigEndian(mSendSequenceCounter, pBuffer + counterOffset);
+}
+
+
+bool SecureMessaging::setEncryptedIv(const char* pSendSequenceCounter)
+{
+	const auto blockSize = mCipher.getBlockSize();
+
+	char iv[EVP_MAX_BLOCK_LENGTH];
+	return mCipher.setIv(QByteArrayView(ZERO_BLOCK, blockSize))
+		   && mCipher.encrypt(QByteArrayView(pSendSequenceCounter, blockSize), iv)
+		   && mCipher.setIv(QByteArrayView(iv, blockSize));
+}
+
+
+bool SecureMessaging::encryptInto(const QByteArray& pData, const char* pSendSequenceCounter, char* pOutput)
+{
+	Q_ASSERT(!pData.isEmpty());
+
+	const auto paddingSize = getPaddingSize(pData.size());
+	std::copy(pData.cbegin(), pData.cend(), pOutput);
+	std::copy_n(ISO_PADDING, paddingSize, pOutput + pData.size());
+
+	return setEncryptedIv(pSendSequenceCounter)
+		   && mCipher.encrypt(QByteArrayView(pOutput, pData.size() + paddingSize), pOutput);
+}
+
+
+QByteArray SecureMessaging::decryptFrom(const QByteArray& pEncryptedData, const char* pSendSequenceCounter)
+{
+	if (!setEncryptedIv(pSendSequenceCounter))
+	{
+		return QByteArray();
+	}
+
+	QByteArray paddedDecryptedData = mCipher.decrypt(pEncryptedData);
+	if (paddedDecryptedData.isEmpty())
+	{
+		qCCritical(card) << "Cannot decrypt data";
+		return QByteArray();
+	}
+
+	return unpadFromCipherBlockSize(std::move(paddedDecryptedData));
 }
 
 
@@ -92,30 +184,57 @@ CommandApdu SecureMessaging::encrypt(const CommandApdu& pCommandApdu)
 
 	qCDebug(secure) << "Plain CommandApdu:" << pCommandApdu;
 
-	QByteArray formattedEncryptedData;
-	if (!pCommandApdu.getData().isEmpty())
+	const QByteArray& data = pCommandApdu.getData();
+	const qsizetype encryptedDataSize = data.isEmpty() ? 0 : data.size() + getPaddingSize(data.size());
+	const qsizetype encryptedDataObjectSize = data.isEmpty() ? 0 : getTlvSize(encryptedDataSize + 1);
+
+	const int le = pCommandApdu.getLe();
+	const qsizetype leSize = le > CommandApdu::NO_LE ? (pCommandApdu.isExtendedLength() ? 2 : 1) : 0;
+	const qsizetype protectedLeObjectSize = leSize > 0 ? getTlvSize(leSize) : 0;
+
+	// All data objects are written into one buffer: DO87 | DO97 | DO8E
+	QByteArray securedData(encryptedDataObjectSize + protectedLeObjectSize + getTlvSize(CipherMac::MAC_SIZE), Qt::Uninitialized);
+	char* output = securedData.data();
+
+	char sendSequenceCounter[EVP_MAX_BLOCK_LENGTH];
+	writeSendSequenceCounter(sendSequenceCounter);
+
+	if (!data.isEmpty())
 	{
-		QByteArray paddedASN1Struct = padToCipherBlockSize(pCommandApdu.getData());
-		mCipher.setIv(getEncryptedIv());
-		QByteArray encryptedData = mCipher.encrypt(paddedASN1Struct).prepend(0x01);
+		output = writeTlvHeader(output, SM_TAG_ENCRYPTED_DATA, encryptedDataSize + 1);
+		*output++ = PADDING_CONTENT_INDICATOR;
+		if (!encryptInto(data, sendSequenceCounter, output))
+		{
+			return CommandApdu();
+		}
+		output += encryptedDataSize;
+	}
 
-		auto encryptedDataObject = newObject<SM_ENCRYPTED_DATA>();
-		Asn1OctetStringUtil::setValue(encryptedData, encryptedDataObject.data());
-		formattedEncryptedData = encodeObject(encryptedDataObject.data());
+	if (leSize > 0)
+	{
+		output = writeTlvHeader(output, SM_TAG_PROTECTED_LE, leSize);
+		if (leSize == 2)
+		{
+			*output++ = static_cast<char>(le >> 8 & 0xFF);
+		}
+		*output++ = static_cast<char>(le & 0xFF);
 	}
 
-	QByteArray securedHeader = createSecuredHeader(pCommandApdu);
-	QByteArray securedLe;
-	if (pCommandApdu.getLe() > CommandApdu::NO_LE)
+	const QByteArray securedHeader = createSecuredHeader(pCommandApdu);
+	const QByteArrayView dataObjects(securedData.constData(), output - securedData.constData());
+	char* mac = writeTlvHeader(output, SM_TAG_CHECKSUM, CipherMac::MAC_SIZE);
+	if (!mCipherMac.generate({
+				QByteArrayView(sendSequenceCounter, mCipher.getBlockSize()),
+				securedHeader,
+				getPadding(securedHeader.size()),
+				dataObjects,
+				dataObjects.isEmpty() ? QByteArrayView() : getPadding(dataObjects.size())
+			}, mac))
 	{
-		auto protectedLeObject = newObject<SM_PROTECTED_LE>();
-		Asn1OctetStringUtil::setValue(pCommandApdu.generateLengthField(pCommandApdu.getLe()), protectedLeObject.data());
-		securedLe = encodeObject(protectedLeObject.data());
+		return CommandApdu();
 	}
-	QByteArray mac = createMac(securedHeader, formattedEncryptedData, securedLe);
-	QByteArray securedData = formattedEncryptedData + securedLe + mac;
-	int newLe = createNewLe(securedData, pCommandApdu.getLe());
 
+	const int newLe = createNewLe(securedData, le);
 	return CommandApdu(securedHeader, securedData, newLe);
 }
 
@@ -137,18 +256,32 @@ CommandApdu SecureMessaging::decrypt(const CommandApdu& pEncryptedCommandApdu)
 		return CommandApdu();
 	}
 
-	if (createMac(pEncryptedCommandApdu.getHeaderBytes(), secureCommand.getEncryptedDataObjectEncoded(), secureCommand.getExpectedLengthObjectEncoded()).mid(2) != secureCommand.getMac())
+	char sendSequenceCounter[EVP_MAX_BLOCK_LENGTH];
+	writeSendSequenceCounter(sendSequenceCounter);
+
+	const QByteArray header = pEncryptedCommandApdu.getHeaderBytes();
+	const QByteArray encryptedDataObject = secureCommand.getEncryptedDataObjectEncoded();
+	const QByteArray expectedLengthObject = secureCommand.getExpectedLengthObjectEncoded();
+	const auto dataObjectsSize = encryptedDataObject.size() + expectedLengthObject.size();
+
+	char mac[CipherMac::MAC_SIZE];
+	if (!mCipherMac.generate({
+				QByteArrayView(sendSequenceCounter, mCipher.getBlockSize()),
+				header,
+				getPadding(header.size()),
+				encryptedDataObject,
+				expectedLengthObject,
+				dataObjectsSize == 0 ? QByteArrayView() : getPadding(dataObjectsSize)
+			}, mac) || QByteArray::fromRawData(mac, CipherMac::MAC_SIZE) != secureCommand.getMac())
 	{
 		qCCritical(card) << "MAC on secured CommandApdu does not match";
 		return CommandApdu();
 	}
 
 	QByteArray decryptedData;
-	if (!secureCommand.getEncryptedData().isEmpty())
+	if (const auto& encryptedData = secureCommand.getEncryptedData(); !encryptedData.isEmpty())
 	{
-		mCipher.setIv(getEncryptedIv());
-		QByteArray paddedDecryptedData = mCipher.decrypt(secureCommand.getEncryptedData());
-		decryptedData = unpadFromCipherBlockSize(paddedDecryptedData);
+		decryptedData = decryptFrom(encryptedData, sendSequenceCounter);
 	}
 
 	CommandApdu encrypted(pEncryptedCommandApdu.getHeaderBytes(), decryptedData, secureCommand.getExpectedLength());
@@ -170,27 +303,6 @@ QByteArray SecureMessaging::createSecuredHeader(const CommandApdu& pCommandApdu)
 }
 
 
-QByteArray SecureMessaging::createMac(const QByteArray& pSecuredHeader,
-		const QByteArray& pFormattedEncryptedData,
-		const QByteArray& pSecuredLe)
-{
-	QByteArray dataToMac(pSecuredHeader);
-	dataToMac = padToCipherBlockSize(dataToMac);
-	dataToMac += pFormattedEncryptedData;
-	dataToMac += pSecuredLe;
-	if (!pFormattedEncryptedData.isNull() || !pSecuredLe.isNull())
-	{
-		dataToMac = padToCipherBlockSize(dataToMac);
-	}
-	dataToMac.prepend(getSendSequenceCounter());
-
-	QByteArray mac = mCipherMac.generate(dataToMac);
-	auto macObject = newObject<SM_CHECKSUM>();
-	Asn1OctetStringUtil::setValue(mac, macObject.data());
-	return encodeObject(macObject.data());
-}
-
-
 int SecureMessaging::createNewLe(const QByteArray& pSecuredData, int pOldLe) const
 {
 	if (CommandApdu::isExtendedLength(pSecuredData, pOldLe))
@@ -201,21 +313,6 @@ int SecureMessaging::createNewLe(const QByteArray& pSecuredData, int pOldLe) con
 }
 
 
-QByteArray SecureMessaging::getSendSequenceCounter() const
-{
-	QByteArray converted(sizeof(mSendSequenceCounter), '\0');
-	qToBigEndian(mSendSequenceCounter, converted.data());
-	return QByteArray(mCipher.getBlockSize() - converted.size(), 0x00) + converted;
-}
-
-
-QByteArray SecureMessaging::getEncryptedIv()
-{
-	mCipher.setIv(QByteArray().fill(0x00, mCipher.getBlockSize()));
-	return mCipher.encrypt(getSendSequenceCounter());
-}
-
-
 ResponseApdu SecureMessaging::encrypt(const ResponseApdu& pResponseApdu)
 {
 	if (!isInitialized())
@@ -226,28 +323,45 @@ ResponseApdu SecureMessaging::encrypt(const ResponseApdu& pResponseApdu)
 
 	++mSendSequenceCounter;
 
-	QByteArray formattedEncryptedData;
-	if (!pResponseApdu.getData().isEmpty())
-	{
-		QByteArray paddedResponseData = padToCipherBlockSize(pResponseApdu.getData());
-		mCipher.setIv(getEncryptedIv());
-		QByteArray encryptedData = mCipher.encrypt(paddedResponseData).prepend(0x01);
+	const QByteArray& data = pResponseApdu.getData();
+	const QByteArray status = pResponseApdu.getStatusBytes();
+	const qsizetype encryptedDataSize = data.isEmpty() ? 0 : data.size() + getPaddingSize(data.size());
+	const qsizetype encryptedDataObjectSize = data.isEmpty() ? 0 : getTlvSize(encryptedDataSize + 1);
+
+	// All data objects are written into one buffer: DO87 | DO99 | DO8E | SW1SW2
+	QByteArray response(encryptedDataObjectSize + getTlvSize(status.size()) + getTlvSize(CipherMac::MAC_SIZE) + status.size(), Qt::Uninitialized);
+	char* output = response.data();
 
-		auto encryptedDataObject = newObject<SM_ENCRYPTED_DATA>();
-		Asn1OctetStringUtil::setValue(encryptedData, encryptedDataObject.data());
-		formattedEncryptedData = encodeObject(encryptedDataObject.data());
+	char sendSequenceCounter[EVP_MAX_BLOCK_LENGTH];
+	writeSendSequenceCounter(sendSequenceCounter);
+
+	if (!data.isEmpty())
+	{
+		output = writeTlvHeader(output, SM_TAG_ENCRYPTED_DATA, encryptedDataSize + 1);
+		*output++ = PADDING_CONTENT_INDICATOR;
+		if (!encryptInto(data, sendSequenceCounter, output))
+		{
+			return ResponseApdu();
+		}
+		output += encryptedDataSize;
 	}
 
-	const QByteArray status = pResponseApdu.getStatusBytes();
-	auto formattedStatus = newObject<SM_PROCESSING_STATUS>();
-	Asn1OctetStringUtil::setValue(status, formattedStatus.data());
-	formattedEncryptedData += encodeObject(formattedStatus.data());
+	output = writeTlvHeader(output, SM_TAG_PROCESSING_STATUS, status.size());
+	output = std::copy(status.cbegin(), status.cend(), output);
 
-	QByteArray mac = mCipherMac.generate(getSendSequenceCounter() + padToCipherBlockSize(formattedEncryptedData));
-	auto macObject = newObject<SM_CHECKSUM>();
-	Asn1OctetStringUtil::setValue(mac, macObject.data());
+	const QByteArrayView dataObjects(response.constData(), output - response.constData());
+	char* mac = writeTlvHeader(output, SM_TAG_CHECKSUM, CipherMac::MAC_SIZE);
+	if (!mCipherMac.generate({
+				QByteArrayView(sendSequenceCounter, mCipher.getBlockSize()),
+				dataObjects,
+				getPadding(dataObjects.size())
+			}, mac))
+	{
+		return ResponseApdu();
+	}
+	std::copy(status.cbegin(), status.cend(), mac + CipherMac::MAC_SIZE);
 
-	return ResponseApdu(formattedEncryptedData + encodeObject(macObject.data()) + status);
+	return ResponseApdu(response);
 }
 
 
@@ -273,29 +387,33 @@ ResponseApdu SecureMessaging::decrypt(const ResponseApdu& pEncryptedResponseApdu
 		return ResponseApdu();
 	}
 
-	QByteArray dataToMac;
-	if (!secureResponse.getEncryptedData().isEmpty())
-	{
-		dataToMac += secureResponse.getEncryptedDataObjectEncoded();
-	}
-	dataToMac += secureResponse.getSecuredStatusCodeObjectEncoded();
-	dataToMac = padToCipherBlockSize(dataToMac);
-	dataToMac.prepend(getSendSequenceCounter());
-	if (mCipherMac.generate(dataToMac) != secureResponse.getMac())
+	char sendSequenceCounter[EVP_MAX_BLOCK_LENGTH];
+	writeSendSequenceCounter(sendSequenceCounter);
+
+	const QByteArray encryptedData = secureResponse.getEncryptedData();
+	const QByteArray encryptedDataObject = encryptedData.isEmpty() ? QByteArray() : secureResponse.getEncryptedDataObjectEncoded();
+	const QByteArray statusObject = secureResponse.getSecuredStatusCodeObjectEncoded();
+
+	char mac[CipherMac::MAC_SIZE];
+	if (!mCipherMac.generate({
+				QByteArrayView(sendSequenceCounter, mCipher.getBlockSize()),
+				encryptedDataObject,
+				statusObject,
+				getPadding(encryptedDataObject.size() + statusObject.size())
+			}, mac) || QByteArray::fromRawData(mac, CipherMac::MAC_SIZE) != secureResponse.getMac())
 	{
 		qCCritical(card) << "MAC on secured ResponseApdu does not match";
 		return ResponseApdu();
 	}
 
 	QByteArray decryptedData;
-	if (!secureResponse.getEncryptedData().isEmpty())
+	if (!encryptedData.isEmpty())
 	{
-		mCipher.setIv(getEncryptedIv());
-		QByteArray paddedDecryptedData = mCipher.decrypt(secureResponse.getEncryptedData());
-		decryptedData = unpadFromCipherBlockSize(paddedDecryptedData);
+		decryptedData = decryptFrom(encryptedData, sendSequenceCounter);
 	}
+	decryptedData += secureResponse.getSecuredStatusCodeBytes();
 
-	const ResponseApdu response(decryptedData + secureResponse.getSecuredStatusCodeBytes());
+	const ResponseApdu response(decryptedData);
 	qCDebug(secure) << "Plain ResponseApdu:" << response;
 	return response;
 }
@@ -15,6 +15,7 @@
 #include "pace/SymmetricCipher.h"
 
 #include <QByteArray>
+#include <QByteArrayView>
 
 
 namespace governikus
@@ -27,13 +28,15 @@ class SecureMessaging final
 		CipherMac mCipherMac;
 		quint32 mSendSequenceCounter;
 
-		[[nodiscard]] QByteArray padToCipherBlockSize(const QByteArray& pData) const;
-		[[nodiscard]] QByteArray unpadFromCipherBlockSize(const QByteArray& pData) const;
+		[[nodiscard]] qsizetype getPaddingSize(qsizetype pDataSize) const;
+		[[nodiscard]] QByteArrayView getPadding(qsizetype pDataSize) const;
+		[[nodiscard]] QByteArray unpadFromCipherBlockSize(QByteArray pData) const;
 		[[nodiscard]] QByteArray createSecuredHeader(const CommandApdu& pCommandApdu) const;
-		QByteArray createMac(const QByteArray& pSecuredHeader, const QByteArray& pFormattedEncryptedData, const QByteArray& pSecuredLe);
 		[[nodiscard]] int createNewLe(const QByteArray& pSecuredData, int pOldLe) const;
-		[[nodiscard]] QByteArray getSendSequenceCounter() const;
-		QByteArray getEncryptedIv();
+		void writeSendSequenceCounter(char* pBuffer) const;
+		bool setEncryptedIv(const char* pSendSequenceCounter);
+		bool encryptInto(const QByteArray& pData, const char* pSendSequenceCounter, char* pOutput);
+		QByteArray decryptFrom(const QByteArray& pEncryptedData, const char* pSendSequenceCounter);
 
 	public:
 		SecureMessaging(const SecurityProtocol& pSecurityProtocol, const QByteArray& pEncKey, const QByteArray& pMacKey);
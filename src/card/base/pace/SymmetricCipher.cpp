@@ -7,6 +7,8 @@
 #include <QLoggingCategory>
 #include <openssl/evp.h>
 
+#include <algorithm>
+
 
 using namespace governikus;
 
@@ -15,10 +17,10 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 SymmetricCipher::SymmetricCipher(const SecurityProtocol& pSecurityProtocol, const QByteArray& pKeyBytes)
-	: mCtx(nullptr)
+	: mEncryptCtx(nullptr)
+	, mDecryptCtx(nullptr)
 	, mCipher(pSecurityProtocol.getCipher())
 	, mIv()
-	, mKeyBytes(pKeyBytes)
 {
 	if (!mCipher)
 	{
@@ -28,134 +30,134 @@ SymmetricCipher::SymmetricCipher(const SecurityProtocol& pSecurityProtocol, cons
 
 	mIv.fill(0, EVP_CIPHER_iv_length(mCipher));
 
-	if (mKeyBytes.size() != EVP_CIPHER_key_length(mCipher))
+	if (pKeyBytes.size() != EVP_CIPHER_key_length(mCipher))
 	{
 		qCCritical(card) << "Error cipher key has wrong length";
 		return;
 	}
 
-	mCtx = EVP_CIPHER_CTX_new();
-	EVP_CIPHER_CTX_reset(mCtx);
+	const auto* key = reinterpret_cast<const uchar*>(pKeyBytes.constData());
+	mEncryptCtx = EVP_CIPHER_CTX_new();
+	mDecryptCtx = EVP_CIPHER_CTX_new();
+	if (mEncryptCtx == nullptr || mDecryptCtx == nullptr
+			|| !EVP_EncryptInit_ex(mEncryptCtx, mCipher, nullptr, key, nullptr)
+			|| !EVP_DecryptInit_ex(mDecryptCtx, mCipher, nullptr, key, nullptr))
+	{
+		qCCritical(card) << "Cannot initialize cipher context";
+		EVP_CIPHER_CTX_free(mEncryptCtx);
+		EVP_CIPHER_CTX_free(mDecryptCtx);
+		mEncryptCtx = nullptr;
+		mDecryptCtx = nullptr;
+	}
 }
 
 
 SymmetricCipher::~SymmetricCipher()
 {
-	EVP_CIPHER_CTX_reset(mCtx);
-	EVP_CIPHER_CTX_free(mCtx);
+	EVP_CIPHER_CTX_free(mEncryptCtx);
+	EVP_CIPHER_CTX_free(mDecryptCtx);
 }
 
 
 bool SymmetricCipher::isInitialized() const
 {
-	return mCtx != nullptr && mCipher != nullptr;
+	return mEncryptCtx != nullptr && mDecryptCtx != nullptr && mCipher != nullptr;
 }
 
 
-QByteArray SymmetricCipher::encrypt(const QByteArray& pPlainData)
+bool SymmetricCipher::process(EVP_CIPHER_CTX* pCtx, QByteArrayView pInput, char* pOutput)
 {
 	if (!isInitialized())
 	{
 		qCCritical(card) << "SymmetricCipher not successfully initialized";
-		return QByteArray();
+		return false;
 	}
 
-	if (!EVP_EncryptInit_ex(mCtx, mCipher, nullptr, reinterpret_cast<const uchar*>(mKeyBytes.constData()), reinterpret_cast<const uchar*>(mIv.constData())))
+	if (pInput.size() % getBlockSize() != 0)
 	{
-		qCCritical(card) << "Error on EVP_EncryptInit_ex";
-		return QByteArray();
+		qCCritical(card) << "Data length is not a multiple of the block size";
+		return false;
 	}
-	EVP_CIPHER_CTX_set_padding(mCtx, 0);
 
-#if OPENSSL_VERSION_NUMBER < 0x30000000L
-	#define EVP_CIPHER_CTX_get0_cipher(x) EVP_CIPHER_CTX_cipher(x)
-#endif
-	if (pPlainData.size() % EVP_CIPHER_block_size(EVP_CIPHER_CTX_get0_cipher(mCtx)) != 0)
+	// The key schedule is kept in the context, so only the IV is exchanged here.
+	if (!EVP_CipherInit_ex(pCtx, nullptr, nullptr, nullptr, reinterpret_cast<const uchar*>(mIv.constData()), -1))
 	{
-		qCCritical(card) << "Plain data length is not a multiple of the block size";
-		return QByteArray();
+		qCCritical(card) << "Error on EVP_CipherInit_ex";
+		return false;
 	}
+	EVP_CIPHER_CTX_set_padding(pCtx, 0);
 
-	QList<uchar> cryptogram(pPlainData.size());
+	auto* output = reinterpret_cast<uchar*>(pOutput);
 	int update_len = 0;
-	if (!EVP_EncryptUpdate(mCtx, cryptogram.data(), &update_len, reinterpret_cast<const uchar*>(pPlainData.constData()), static_cast<int>(pPlainData.size())))
+	if (!EVP_CipherUpdate(pCtx, output, &update_len, reinterpret_cast<const uchar*>(pInput.data()), static_cast<int>(pInput.size())))
 	{
-		qCCritical(card) << "Error on EVP_EncryptUpdate";
-		return QByteArray();
+		qCCritical(card) << "Error on EVP_CipherUpdate";
+		return false;
 	}
 	int final_len = 0;
-	if (!EVP_EncryptFinal_ex(mCtx, cryptogram.data() + update_len, &final_len))
+	if (!EVP_CipherFinal_ex(pCtx, output + update_len, &final_len))
 	{
-		qCCritical(card) << "Error on EVP_EncryptFinal_ex";
-		return QByteArray();
+		qCCritical(card) << "Error on EVP_CipherFinal_ex";
+		return false;
 	}
-	QByteArray encryptedData;
-	encryptedData.append(reinterpret_cast<const char*>(cryptogram.data()), update_len + final_len);
 
-	return encryptedData;
+	Q_ASSERT(update_len + final_len == pInput.size());
+	return true;
 }
 
 
-bool SymmetricCipher::setIv(const QByteArray& pIv)
+QByteArray SymmetricCipher::encrypt(const QByteArray& pPlainData)
 {
-	Q_ASSERT(mCipher != nullptr);
-
-	if (pIv.size() != EVP_CIPHER_iv_length(mCipher))
+	QByteArray encryptedData(pPlainData.size(), Qt::Uninitialized);
+	if (!encrypt(pPlainData, encryptedData.data()))
 	{
-		qCCritical(card) << "IV has bad size";
-		return false;
+		return QByteArray();
 	}
-	mIv = pIv;
-	return true;
+
+	return encryptedData;
 }
 
 
-int SymmetricCipher::getBlockSize() const
+bool SymmetricCipher::encrypt(QByteArrayView pPlainData, char* pOutput)
 {
-	Q_ASSERT(mCipher != nullptr);
-	return EVP_CIPHER_block_size(mCipher);
+	return process(mEncryptCtx, pPlainData, pOutput);
 }
 
 
 QByteArray SymmetricCipher::decrypt(const QByteArray& pEncryptedData)
 {
-	if (!isInitialized())
+	QByteArray decryptedData(pEncryptedData.size(), Qt::Uninitialized);
+	if (!decrypt(pEncryptedData, decryptedData.data()))
 	{
-		qCCritical(card) << "SymmetricCipher not successfully initialized";
 		return QByteArray();
 	}
 
-	if (!EVP_DecryptInit_ex(mCtx, mCipher, nullptr, reinterpret_cast<const uchar*>(mKeyBytes.constData()), reinterpret_cast<const uchar*>(mIv.constData())))
-	{
-		qCCritical(card) << "Error on EVP_DecryptInit_ex";
-		return QByteArray();
-	}
-	EVP_CIPHER_CTX_set_padding(mCtx, 0);
+	return decryptedData;
+}
 
-#if OPENSSL_VERSION_NUMBER < 0x30000000L
-	#define EVP_CIPHER_CTX_get0_cipher(x) EVP_CIPHER_CTX_cipher(x)
-#endif
-	if (pEncryptedData.size() % EVP_CIPHER_block_size(EVP_CIPHER_CTX_get0_cipher(mCtx)) != 0)
-	{
-		qCCritical(card) << "Encrypted data length is not a multiple of the block size";
-		return QByteArray();
-	}
 
-	QList<uchar> plaintext(pEncryptedData.size());
-	int update_len = 0;
-	if (!EVP_DecryptUpdate(mCtx, plaintext.data(), &update_len, reinterpret_cast<const uchar*>(pEncryptedData.constData()), static_cast<int>(pEncryptedData.size())))
-	{
-		qCCritical(card) << "Error on EVP_DecryptUpdate";
-		return QByteArray();
-	}
-	int final_len = 0;
-	if (!EVP_DecryptFinal_ex(mCtx, plaintext.data() + update_len, &final_len))
+bool SymmetricCipher::decrypt(QByteArrayView pEncryptedData, char* pOutput)
+{
+	return process(mDecryptCtx, pEncryptedData, pOutput);
+}
+
+
+bool SymmetricCipher::setIv(QByteArrayView pIv)
+{
+	Q_ASSERT(mCipher != nullptr);
+
+	if (pIv.size() != EVP_CIPHER_iv_length(mCipher))
 	{
-		qCCritical(card) << "Error on EVP_DecryptFinal_ex";
-		return QByteArray();
+		qCCritical(card) << "IV has bad size";
+		return false;
 	}
-	QByteArray decryptedData;
-	decryptedData.append(reinterpret_cast<const char*>(plaintext.data()), update_len + final_len);
+	std::copy(pIv.begin(), pIv.end(), mIv.begin());
+	return true;
+}
 
-	return decryptedData;
+
+int SymmetricCipher::getBlockSize() const
+{
+	Q_ASSERT(mCipher != nullptr);
+	return EVP_CIPHER_block_size(mCipher);
 }
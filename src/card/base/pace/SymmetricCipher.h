@@ -11,6 +11,7 @@
 #include "SecurityProtocol.h"
 
 #include <QByteArray>
+#include <QByteArrayView>
 #include <openssl/evp.h>
 
 namespace governikus
@@ -21,14 +22,19 @@ class SymmetricCipher final
 	Q_DISABLE_COPY(SymmetricCipher)
 
 	private:
-		EVP_CIPHER_CTX* mCtx;
+		EVP_CIPHER_CTX* mEncryptCtx;
+		EVP_CIPHER_CTX* mDecryptCtx;
 		const EVP_CIPHER* mCipher;
 		QByteArray mIv;
-		QByteArray mKeyBytes;
+
+		bool process(EVP_CIPHER_CTX* pCtx, QByteArrayView pInput, char* pOutput);
 
 	public:
 		/*!
 		 * \brief Creates a new instance with cipher algorithm determined by parameter and specified cipher key.
+		 *
+		 * The key schedule is set up once for both directions and kept alive until
+		 * the instance is destroyed. Subsequent operations only exchange the IV.
 		 * \param pSecurityProtocol will determine the cipher algorithm to use. E.g. a PACE protocol
 		 *        of id_PACE::DH::GM_AES_CBC_CMAC_128 will result in AES to be used.
 		 * \param pKeyBytes the bytes of the key
@@ -48,6 +54,14 @@ class SymmetricCipher final
 		 */
 		QByteArray encrypt(const QByteArray& pPlainData);
 
+		/*!
+		 * \brief Encrypts the message into a preallocated buffer.
+		 * \param pPlainData the message to encrypt. The size must be a multiple of the block size.
+		 * \param pOutput buffer with at least the size of pPlainData. It may be equal to pPlainData.data().
+		 * \return true on success
+		 */
+		bool encrypt(QByteArrayView pPlainData, char* pOutput);
+
 		/*!
 		 * \brief Decrypts the message.
 		 * \param pEncryptedData the message to decrypt.
@@ -55,12 +69,20 @@ class SymmetricCipher final
 		 */
 		QByteArray decrypt(const QByteArray& pEncryptedData);
 
+		/*!
+		 * \brief Decrypts the message into a preallocated buffer.
+		 * \param pEncryptedData the message to decrypt. The size must be a multiple of the block size.
+		 * \param pOutput buffer with at least the size of pEncryptedData. It may be equal to pEncryptedData.data().
+		 * \return true on success
+		 */
+		bool decrypt(QByteArrayView pEncryptedData, char* pOutput);
+
 		/*!
 		 * \brief Sets the initialization vector
 		 * \param pIv the initialization vector
 		 * \return if initialization vector has wrong size, false is returned. Otherwise true.
 		 */
-		bool setIv(const QByteArray& pIv);
+		bool setIv(QByteArrayView pIv);
 
 		[[nodiscard]] int getBlockSize() const;
 };
@@ -62,7 +62,7 @@ PcscCard::PcscCard(PcscReader* pPcscReader)
 	qCDebug(card_pcsc) << "SCardEstablishContext for" << mReader->getName() << ':' << pcsc::toString(returnCode);
 
 	mTimer.setInterval(4000);
-	connect(&mTimer, &QTimer::timeout, this, &PcscCard::sendSCardStatus);
+	connect(&mTimer, &QTimer::timeout, this, &PcscCard::onStatusTimeout);
 }
 
 
@@ -80,6 +80,23 @@ PcscCard::~PcscCard()
 }
 
 
+void PcscCard::onStatusTimeout()
+{
+	if (!mReader)
+	{
+		return;
+	}
+
+	// Pending commands go first, every transmit resets the timeout of the transaction as well.
+	mReader->getCommandQueue().enqueue(CardCommandQueue::Priority::BACKGROUND, "SCardStatus", [card = QPointer<PcscCard>(this)] {
+			if (card && card->isConnected())
+			{
+				card->sendSCardStatus();
+			}
+		});
+}
+
+
 void PcscCard::sendSCardStatus()
 {
 	/*
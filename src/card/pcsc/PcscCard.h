@@ -44,9 +44,11 @@ class PcscCard
 		CardResult transmit(const QByteArray& pSendBuffer, const SCARD_IO_REQUEST* pSendPci);
 		CardResult control(PCSC_INT pCntrCode, const QByteArray& pCntrInput);
 
-	private Q_SLOTS:
 		void sendSCardStatus();
 
+	private Q_SLOTS:
+		void onStatusTimeout();
+
 	public:
 		explicit PcscCard(PcscReader* pPcscReader);
 		~PcscCard() override;
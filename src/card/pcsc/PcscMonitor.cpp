@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PcscMonitor.h"
+
+#include <QLoggingCategory>
+#include <QMap>
+
+#include <string>
+#include <vector>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_pcsc)
+
+
+namespace
+{
+#if defined(Q_OS_WIN) && defined(UNICODE)
+using ReaderName = std::wstring;
+const ReaderName cPnpNotification = L"\\\\?PnP?\\Notification";
+
+
+ReaderName toReaderName(const QString& pReaderName)
+{
+	return pReaderName.toStdWString();
+}
+
+
+#else
+using ReaderName = std::string;
+const ReaderName cPnpNotification = "\\\\?PnP?\\Notification";
+
+
+ReaderName toReaderName(const QString& pReaderName)
+{
+	return pReaderName.toStdString();
+}
+
+
+#endif
+} // namespace
+
+
+PcscMonitor::PcscMonitor()
+	: QThread()
+	, mContextHandle(0)
+{
+	setObjectName(QStringLiteral("PcscMonitor"));
+}
+
+
+PcscMonitor::~PcscMonitor()
+{
+	stopMonitoring();
+}
+
+
+PCSC_RETURNCODE PcscMonitor::startMonitoring()
+{
+	Q_ASSERT(!isRunning());
+
+	PCSC_RETURNCODE returnCode = SCardEstablishContext(SCARD_SCOPE_USER, nullptr, nullptr, &mContextHandle);
+	qCDebug(card_pcsc) << "SCardEstablishContext:" << pcsc::toString(returnCode);
+	if (returnCode != pcsc::Scard_S_Success)
+	{
+		mContextHandle = 0;
+		return returnCode;
+	}
+
+	start();
+	return pcsc::Scard_S_Success;
+}
+
+
+void PcscMonitor::stopMonitoring()
+{
+	if (mContextHandle == 0)
+	{
+		return;
+	}
+
+	requestInterruption();
+
+	// SCardCancel only affects a running call of SCardGetStatusChange. The thread may
+	// enter the call right after the cancellation, so we repeat it until the thread is gone.
+	do
+	{
+		SCardCancel(mContextHandle);
+	}
+	while (!wait(50));
+
+	PCSC_RETURNCODE returnCode = SCardReleaseContext(mContextHandle);
+	qCDebug(card_pcsc) << "SCardReleaseContext:" << pcsc::toString(returnCode);
+	mContextHandle = 0;
+}
+
+
+bool PcscMonitor::isPnpSupported() const
+{
+	SCARD_READERSTATE state;
+	memset(&state, 0, sizeof(SCARD_READERSTATE));
+	state.szReader = cPnpNotification.c_str();
+	state.dwCurrentState = SCARD_STATE_UNAWARE;
+
+	const PCSC_RETURNCODE returnCode = SCardGetStatusChange(mContextHandle, 0, &state, 1);
+	if (returnCode != pcsc::Scard_S_Success && returnCode != pcsc::Scard_E_Timeout)
+	{
+		return false;
+	}
+
+	return (state.dwEventState & SCARD_STATE_UNKNOWN) == 0;
+}
+
+
+void PcscMonitor::waitForRetry() const
+{
+	for (int i = 0; i < FALLBACK_TIMEOUT / 50 && !isInterruptionRequested(); ++i)
+	{
+		msleep(50);
+	}
+}
+
+
+void PcscMonitor::run()
+{
+	// Without PnP notifications the list of readers is polled after every timeout.
+	const bool pnpSupported = isPnpSupported();
+	const auto timeout = static_cast<PCSC_INT>(pnpSupported ? INFINITE : FALLBACK_TIMEOUT);
+	const qsizetype readerOffset = pnpSupported ? 1 : 0;
+	qCDebug(card_pcsc) << "PnP notification supported:" << pnpSupported;
+
+	QStringList readerNames;
+	std::vector<ReaderName> names;
+	std::vector<SCARD_READERSTATE> states;
+	bool readersKnown = false;
+	bool updateReaderList = true;
+
+	while (!isInterruptionRequested())
+	{
+		if (updateReaderList)
+		{
+			updateReaderList = false;
+
+			QStringList currentReaderNames;
+			const PCSC_RETURNCODE returnCode = pcsc::readReaderNames(mContextHandle, currentReaderNames);
+			if (returnCode != pcsc::Scard_S_Success && returnCode != pcsc::Scard_E_No_Readers_Available)
+			{
+				// Let the plugin handle the error, it restarts the monitor if required.
+				Q_EMIT fireReadersChanged();
+				waitForRetry();
+				updateReaderList = true;
+				continue;
+			}
+
+			if (!readersKnown || currentReaderNames != readerNames)
+			{
+				QMap<QString, PCSC_INT> knownStates;
+				for (qsizetype i = 0; i < readerNames.size(); ++i)
+				{
+					knownStates.insert(readerNames.at(i), states.at(static_cast<size_t>(i + readerOffset)).dwCurrentState);
+				}
+				const PCSC_INT pnpState = pnpSupported && !states.empty() ? states.front().dwCurrentState : SCARD_STATE_UNAWARE;
+
+				readerNames = currentReaderNames;
+				names.clear();
+				if (pnpSupported)
+				{
+					names.push_back(cPnpNotification);
+				}
+				for (const auto& readerName : std::as_const(readerNames))
+				{
+					names.push_back(toReaderName(readerName));
+				}
+
+				states.assign(names.size(), SCARD_READERSTATE());
+				for (size_t i = 0; i < names.size(); ++i)
+				{
+					states[i].szReader = names[i].c_str();
+					states[i].dwCurrentState = i < static_cast<size_t>(readerOffset)
+							? pnpState
+							: knownStates.value(readerNames.at(static_cast<qsizetype>(i) - readerOffset), SCARD_STATE_UNAWARE);
+				}
+
+				readersKnown = true;
+				qCDebug(card_pcsc) << "Monitoring readers:" << readerNames;
+				Q_EMIT fireReadersChanged();
+			}
+		}
+
+		if (states.empty())
+		{
+			waitForRetry();
+			updateReaderList = true;
+			continue;
+		}
+
+		const PCSC_RETURNCODE returnCode = SCardGetStatusChange(mContextHandle, timeout, states.data(), static_cast<PCSC_INT>(states.size()));
+		switch (returnCode)
+		{
+			case pcsc::Scard_S_Success:
+				for (size_t i = 0; i < states.size(); ++i)
+				{
+					auto& state = states[i];
+					if ((state.dwEventState & SCARD_STATE_CHANGED) == 0)
+					{
+						continue;
+					}
+
+					state.dwCurrentState = state.dwEventState & ~static_cast<PCSC_INT>(SCARD_STATE_CHANGED);
+					if (i < static_cast<size_t>(readerOffset) || (state.dwEventState & (SCARD_STATE_UNKNOWN | SCARD_STATE_IGNORE)))
+					{
+						updateReaderList = true;
+						continue;
+					}
+
+					Q_EMIT fireReaderStateChanged(readerNames.at(static_cast<qsizetype>(i) - readerOffset));
+				}
+				break;
+
+			case pcsc::Scard_E_Timeout:
+				updateReaderList = !pnpSupported;
+				break;
+
+			case pcsc::Scard_E_Cancelled:
+				break;
+
+			case pcsc::Scard_E_Unknown_Reader:
+				updateReaderList = true;
+				break;
+
+			default:
+				qCWarning(card_pcsc) << "SCardGetStatusChange:" << pcsc::toString(returnCode);
+				Q_EMIT fireReadersChanged();
+				waitForRetry();
+				updateReaderList = true;
+				break;
+		}
+	}
+
+	qCDebug(card_pcsc) << "Monitoring stopped";
+}
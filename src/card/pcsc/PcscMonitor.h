@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Thread that blocks on SCardGetStatusChange and reports changes of the readers and cards.
+ */
+
+#pragma once
+
+#include "PcscUtils.h"
+
+#include <QString>
+#include <QThread>
+
+
+namespace governikus
+{
+
+class PcscMonitor
+	: public QThread
+{
+	Q_OBJECT
+
+	private:
+		SCARDCONTEXT mContextHandle;
+
+		[[nodiscard]] bool isPnpSupported() const;
+		void waitForRetry() const;
+
+		void run() override;
+
+	public:
+		static constexpr int FALLBACK_TIMEOUT = 500;
+
+		PcscMonitor();
+		~PcscMonitor() override;
+
+		[[nodiscard]] PCSC_RETURNCODE startMonitoring();
+		void stopMonitoring();
+
+	Q_SIGNALS:
+		void fireReadersChanged();
+		void fireReaderStateChanged(const QString& pReaderName);
+};
+
+} // namespace governikus
@@ -65,8 +65,8 @@ PCSC_RETURNCODE PcscReader::init()
 
 	setInfoBasicReader(!hasFeature(FeatureID::EXECUTE_PACE));
 
+	// Further updates are triggered by the PcscMonitor of the PcscReaderManagerPlugin
 	PcscReader::updateCard();
-	setTimerId(startTimer(500));
 	return pcsc::Scard_S_Success;
 }
 
@@ -326,11 +326,6 @@ bool PcscReader::readCardStatus()
 		case pcsc::Scard_E_Unknown_Reader:
 			qCWarning(card_pcsc) << "SCardGetStatusChange:" << pcsc::toString(returnCode);
 			qCWarning(card_pcsc) << "Reader unknown, stop updating reader information";
-			if (getTimerId() != 0)
-			{
-				killTimer(getTimerId());
-				setTimerId(0);
-			}
 			break;
 
 		default:
@@ -18,11 +18,12 @@ Q_DECLARE_LOGGING_CATEGORY(card_pcsc)
 PcscReaderManagerPlugin::PcscReaderManagerPlugin()
 	: ReaderManagerPlugin(ReaderManagerPluginType::PCSC, true)
 	, mContextHandle(0)
-	, mTimer()
+	, mMonitor()
 	, mReaders()
 {
 	setObjectName(QStringLiteral("PcscReaderManager"));
-	connect(&mTimer, &QTimer::timeout, this, &PcscReaderManagerPlugin::updateReaders);
+	connect(&mMonitor, &PcscMonitor::fireReadersChanged, this, &PcscReaderManagerPlugin::updateReaders);
+	connect(&mMonitor, &PcscMonitor::fireReaderStateChanged, this, &PcscReaderManagerPlugin::updateReader);
 
 #ifdef PCSCLITE_VERSION_NUMBER
 	setPluginValue(ReaderManagerPluginInfo::Key::PCSC_LITE_VERSION, QStringLiteral(PCSCLITE_VERSION_NUMBER));
@@ -32,7 +33,7 @@ PcscReaderManagerPlugin::PcscReaderManagerPlugin()
 
 PcscReaderManagerPlugin::~PcscReaderManagerPlugin()
 {
-	Q_ASSERT(!mTimer.isActive());
+	Q_ASSERT(!mMonitor.isRunning());
 	Q_ASSERT(mContextHandle == 0);
 
 	while (!mReaders.isEmpty())
@@ -60,14 +61,19 @@ void PcscReaderManagerPlugin::startScan(bool pAutoConnect)
 		return;
 	}
 
-	mTimer.start(500);
+	returnCode = mMonitor.startMonitoring();
+	if (returnCode != pcsc::Scard_S_Success)
+	{
+		qCWarning(card_pcsc) << "Cannot start monitoring of readers:" << pcsc::toString(returnCode);
+		setInitialScanState(ReaderManagerPluginInfo::InitialScan::FAILED);
+	}
 	ReaderManagerPlugin::startScan(pAutoConnect);
 }
 
 
 void PcscReaderManagerPlugin::stopScan(const QString& pError)
 {
-	mTimer.stop();
+	mMonitor.stopMonitoring();
 
 	if (mContextHandle)
 	{
@@ -86,14 +92,20 @@ void PcscReaderManagerPlugin::stopScan(const QString& pError)
 
 void PcscReaderManagerPlugin::updateReaders()
 {
+	if (mContextHandle == 0)
+	{
+		// Notification of the monitor was queued before the scan stopped
+		return;
+	}
+
 	QStringList readersToAdd;
-	PCSC_RETURNCODE returnCode = readReaderNames(readersToAdd);
+	PCSC_RETURNCODE returnCode = pcsc::readReaderNames(mContextHandle, readersToAdd);
 	if (returnCode != pcsc::Scard_S_Success && returnCode != pcsc::Scard_E_No_Readers_Available)
 	{
 		qCWarning(card_pcsc) << "Cannot update readers, returnCode:" << returnCode;
 		setInitialScanState(ReaderManagerPluginInfo::InitialScan::FAILED);
 
-		if (returnCode == pcsc::Scard_E_No_Service && mTimer.isActive())
+		if (returnCode == pcsc::Scard_E_No_Service && mMonitor.isRunning())
 		{
 			// Work around for an issue on Linux: Sometimes when unplugging a reader
 			// the library seems to get confused and any further calls with existing
@@ -103,7 +115,7 @@ void PcscReaderManagerPlugin::updateReaders()
 			stopScan();
 			startScan(true);
 		}
-		else if (returnCode == pcsc::Scard_E_Service_Stopped && mTimer.isActive())
+		else if (returnCode == pcsc::Scard_E_Service_Stopped && mMonitor.isRunning())
 		{
 			// Work around for an issue on Windows 8.1: Sometimes when unplugging a reader
 			// the library seems to get confused and any further calls with existing
@@ -113,7 +125,7 @@ void PcscReaderManagerPlugin::updateReaders()
 			stopScan();
 			startScan(true);
 		}
-		else if (returnCode == pcsc::Scard_E_Invalid_Handle && mTimer.isActive())
+		else if (returnCode == pcsc::Scard_E_Invalid_Handle && mMonitor.isRunning())
 		{
 			// If the pc/sc daemon terminates on Linux, the handle is invalidated. We try
 			// to restart the manager in this case.
@@ -140,15 +152,15 @@ void PcscReaderManagerPlugin::updateReaders()
 }
 
 
-QString PcscReaderManagerPlugin::extractReaderName(const PCSC_CHAR_PTR pReaderPointer) const
+void PcscReaderManagerPlugin::updateReader(const QString& pReaderName)
 {
-#if defined(Q_OS_WIN) && defined(UNICODE)
-	return QString::fromWCharArray(pReaderPointer);
-
-#else
-	return QString::fromUtf8(pReaderPointer);
-
-#endif
+	if (auto* reader = mReaders.value(pReaderName))
+	{
+		// Does not wait for a reader that is busy in its own thread.
+		QMetaObject::invokeMethod(reader, [reader] {
+				reader->updateCard();
+			});
+	}
 }
 
 
@@ -156,22 +168,35 @@ void PcscReaderManagerPlugin::addReaders(const QStringList& pReaderNames)
 {
 	for (const auto& readerName : pReaderNames)
 	{
-		auto pcscReader = std::make_unique<PcscReader>(readerName);
-		if (pcscReader->init() != pcsc::Scard_S_Success)
+		auto* reader = new PcscReader(readerName);
+		if (hasReaderThreads())
+		{
+			// The card is created by init(), so it lives in the thread of the reader as well.
+			moveToReaderThread(reader);
+		}
+
+		PCSC_RETURNCODE returnCode = pcsc::Scard_S_Success;
+		runOnThread(reader, [reader, &returnCode] {
+				returnCode = reader->init();
+			});
+		if (returnCode != pcsc::Scard_S_Success)
 		{
 			qCDebug(card_pcsc) << "Initialization of" << readerName << "failed";
+			deleteReader(reader);
 			continue;
 		}
 
-		Reader* reader = pcscReader.release();
 		mReaders.insert(readerName, reader);
 
-		connect(reader, &Reader::fireCardInserted, this, &PcscReaderManagerPlugin::fireCardInserted);
-		connect(reader, &Reader::fireCardRemoved, this, &PcscReaderManagerPlugin::fireCardRemoved);
-		connect(reader, &Reader::fireCardInfoChanged, this, &PcscReaderManagerPlugin::fireCardInfoChanged);
+		// The signals are emitted from the thread of the reader to keep their order.
+		connect(reader, &Reader::fireCardInserted, this, &PcscReaderManagerPlugin::fireCardInserted, Qt::DirectConnection);
+		connect(reader, &Reader::fireCardRemoved, this, &PcscReaderManagerPlugin::fireCardRemoved, Qt::DirectConnection);
+		connect(reader, &Reader::fireCardInfoChanged, this, &PcscReaderManagerPlugin::fireCardInfoChanged, Qt::DirectConnection);
 
 		qCDebug(card_pcsc) << "fireReaderAdded:" << readerName << "(" << mReaders.size() << "reader in total )";
-		Q_EMIT fireReaderAdded(reader->getReaderInfo());
+		runOnThread(reader, [this, reader] {
+				Q_EMIT fireReaderAdded(reader->getReaderInfo());
+			});
 	}
 }
 
@@ -185,8 +210,13 @@ void PcscReaderManagerPlugin::removeReader(const QString& pReaderName)
 	}
 
 	auto* reader = mReaders.take(pReaderName);
-	auto info = reader->getReaderInfo();
-	delete reader;
+	ReaderInfo info;
+	runOnThread(reader, [reader, &info] {
+			info = reader->getReaderInfo();
+		});
+
+	// The thread of the reader is finished afterwards, so all of its signals are emitted before.
+	deleteReader(reader);
 
 	Q_EMIT fireReaderRemoved(info);
 }
@@ -199,37 +229,3 @@ void PcscReaderManagerPlugin::removeReaders(const QStringList& pReaderNames)
 		removeReader(readerName);
 	}
 }
-
-
-PCSC_RETURNCODE PcscReaderManagerPlugin::readReaderNames(QStringList& pReaderNames) const
-{
-	if (mContextHandle == 0)
-	{
-		return pcsc::Scard_E_Invalid_Handle;
-	}
-
-	QVarLengthArray<PCSC_CHAR, 8192> readers;
-	auto maxReadersSize = static_cast<PCSC_INT>(readers.capacity());
-	PCSC_RETURNCODE returnCode = SCardListReaders(mContextHandle, nullptr, readers.data(), &maxReadersSize);
-	if (returnCode != pcsc::Scard_S_Success)
-	{
-		if (returnCode != pcsc::Scard_E_No_Readers_Available)
-		{
-			qCWarning(card_pcsc) << "SCardListReaders:" << pcsc::toString(returnCode);
-			qCWarning(card_pcsc) << "Cannot read reader names";
-		}
-		return returnCode;
-	}
-
-	PCSC_CHAR_PTR pReader = readers.data();
-	const PCSC_CHAR_PTR end = pReader + maxReadersSize - 1;
-	while (pReader < end)
-	{
-		QString readerName = extractReaderName(pReader);
-		pReaderNames += readerName;
-		// Advance to the next value.
-		pReader += readerName.size() + 1;
-	}
-
-	return returnCode;
-}
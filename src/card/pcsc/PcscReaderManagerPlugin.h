@@ -8,13 +8,13 @@
 
 #pragma once
 
+#include "PcscMonitor.h"
 #include "PcscUtils.h"
 #include "Reader.h"
 #include "ReaderManagerPlugin.h"
 
 #include <QMap>
 #include <QStringList>
-#include <QTimer>
 
 
 class test_PcscReaderManagerPlugin;
@@ -33,13 +33,12 @@ class PcscReaderManagerPlugin
 
 	private:
 		SCARDCONTEXT mContextHandle;
-		QTimer mTimer;
+		PcscMonitor mMonitor;
 		QMap<QString, Reader*> mReaders;
 
 	private:
-		PCSC_RETURNCODE readReaderNames(QStringList& pReaderNames) const;
 		void updateReaders();
-		inline QString extractReaderName(const PCSC_CHAR_PTR pReaderPointer) const;
+		void updateReader(const QString& pReaderName);
 		void addReaders(const QStringList& pReaderNames);
 		void removeReader(const QString& pReaderName);
 		void removeReaders(const QStringList& pReaderNames);
@@ -4,9 +4,16 @@
 
 #include "PcscUtils.h"
 
+#include <QLoggingCategory>
+#include <QVarLengthArray>
+
+
 using namespace governikus;
 
 
+Q_DECLARE_LOGGING_CATEGORY(card_pcsc)
+
+
 QString pcsc::toString(PCSC_RETURNCODE pCode)
 {
 	const auto& metaEnum = QMetaEnum::fromType<PcscReturnCode>();
@@ -20,6 +27,44 @@ QString pcsc::toString(PCSC_RETURNCODE pCode)
 }
 
 
+PCSC_RETURNCODE pcsc::readReaderNames(SCARDCONTEXT pContextHandle, QStringList& pReaderNames)
+{
+	if (pContextHandle == 0)
+	{
+		return pcsc::Scard_E_Invalid_Handle;
+	}
+
+	QVarLengthArray<PCSC_CHAR, 8192> readers;
+	auto maxReadersSize = static_cast<PCSC_INT>(readers.capacity());
+	PCSC_RETURNCODE returnCode = SCardListReaders(pContextHandle, nullptr, readers.data(), &maxReadersSize);
+	if (returnCode != pcsc::Scard_S_Success)
+	{
+		if (returnCode != pcsc::Scard_E_No_Readers_Available)
+		{
+			qCWarning(card_pcsc) << "SCardListReaders:" << pcsc::toString(returnCode);
+			qCWarning(card_pcsc) << "Cannot read reader names";
+		}
+		return returnCode;
+	}
+
+	PCSC_CHAR_PTR pReader = readers.data();
+	const PCSC_CHAR_PTR end = pReader + maxReadersSize - 1;
+	while (pReader < end)
+	{
+#if defined(Q_OS_WIN) && defined(UNICODE)
+		const auto& readerName = QString::fromWCharArray(pReader);
+#else
+		const auto& readerName = QString::fromUtf8(pReader);
+#endif
+		pReaderNames += readerName;
+		// Advance to the next value.
+		pReader += readerName.size() + 1;
+	}
+
+	return returnCode;
+}
+
+
 QDataStream& pcsc::operator<<(QDataStream& pStream, const PcscReturnCode& pCode)
 {
 	return pStream << static_cast<qint64>(pCode);
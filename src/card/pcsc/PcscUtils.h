@@ -11,6 +11,7 @@
 
 #include <QMetaEnum>
 #include <QString>
+#include <QStringList>
 #include <QtGlobal>
 
 #include <winscard.h>
@@ -134,6 +135,11 @@ Q_ENUM_NS(PcscReturnCode)
 
 QString toString(PCSC_RETURNCODE pCode);
 
+/*!
+ * Reads the names of all readers that are known by the given context.
+ */
+PCSC_RETURNCODE readReaderNames(SCARDCONTEXT pContextHandle, QStringList& pReaderNames);
+
 QDataStream& operator<<(QDataStream& pStream, const PcscReturnCode& pCode);
 QDataStream& operator>>(QDataStream& pStream, PcscReturnCode& pCode);
 } // namespace governikus::pcsc
@@ -19,6 +19,7 @@
 #include "pace/ec/EcdhKeyAgreement.h"
 
 #include <QCryptographicHash>
+#include <QRandomGenerator>
 #include <QScopeGuard>
 #include <QThread>
 #include <QtEndian>
@@ -43,6 +44,11 @@ SimulatorCard::SimulatorCard(const SimulatorFileSystem& pFileSystem)
 	, mSelectedProtocol()
 	, mChainingStep(0)
 	, mPaceKeyId(0)
+	, mPacePasswordId(PacePasswordId::UNKNOWN)
+	, mAuthenticatedPasswordId(PacePasswordId::UNKNOWN)
+	, mPinRetryCounter(3)
+	, mApduLatency(0)
+	, mFailureRate(0.0)
 	, mPaceChat()
 	, mPaceNonce()
 	, mPaceTerminalKey()
@@ -81,6 +87,18 @@ bool SimulatorCard::isConnected() const
 }
 
 
+void SimulatorCard::setApduLatency(ulong pMilliseconds)
+{
+	mApduLatency = pMilliseconds;
+}
+
+
+void SimulatorCard::setFailureRate(double pFailureRate)
+{
+	mFailureRate = pFailureRate;
+}
+
+
 ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 {
 	CommandApdu commandApdu = pCmd;
@@ -88,6 +106,17 @@ ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 
 	qCDebug(card_simulator) << "Transmit command APDU:" << commandApdu;
 
+	if (mApduLatency > 0)
+	{
+		QThread::msleep(mApduLatency);
+	}
+
+	if (mFailureRate > 0.0 && QRandomGenerator::global()->generateDouble() < mFailureRate)
+	{
+		qCDebug(card_simulator) << "Inject transmit failure";
+		return {CardReturnCode::COMMAND_FAILED};
+	}
+
 	if (mSecureMessaging)
 	{
 		if (commandApdu.isSecureMessaging())
@@ -100,6 +129,7 @@ ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 			qCDebug(card_simulator) << "Received unencrypted command APDU. Disable secure messaging";
 			mSecureMessaging.reset();
 			mPaceChat.reset();
+			mAuthenticatedPasswordId = PacePasswordId::UNKNOWN;
 		}
 	}
 
@@ -126,6 +156,10 @@ ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 			result = executeGeneralAuthenticate(commandApdu);
 			break;
 
+		case Ins::RESET_RETRY_COUNTER:
+			result = executeResetRetryCounter(commandApdu);
+			break;
+
 		case Ins::VERIFY:
 			if (commandApdu.isProprietary())
 			{
@@ -192,6 +226,7 @@ CardReturnCode SimulatorCard::destroyPaceChannel()
 {
 	mSecureMessaging.reset();
 	mPaceChat.reset();
+	mAuthenticatedPasswordId = PacePasswordId::UNKNOWN;
 
 	return CardReturnCode::OK;
 }
@@ -279,6 +314,7 @@ ResponseApduResult SimulatorCard::executeMseSetAt(const CommandApdu& pCmd)
 			if (protocol.getProtocol() == ProtocolType::PACE)
 			{
 				mPaceKeyId = cmdData.getData(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::PRIVATE_KEY_REFERENCE).back();
+				mPacePasswordId = static_cast<PacePasswordId>(cmdData.getData(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::PUBLIC_KEY_REFERENCE).back());
 				const auto& chat = cmdData.getObject(V_ASN1_APPLICATION, ASN1Struct::CERTIFICATE_HOLDER_AUTHORIZATION_TEMPLATE);
 				if (!chat.isEmpty())
 				{
@@ -288,6 +324,11 @@ ResponseApduResult SimulatorCard::executeMseSetAt(const CommandApdu& pCmd)
 				{
 					mPaceChat.reset();
 				}
+
+				if (mPacePasswordId == PacePasswordId::PACE_PIN)
+				{
+					return {CardReturnCode::OK, ResponseApdu(getPinStatus())};
+				}
 			}
 			break;
 
@@ -323,9 +364,11 @@ ResponseApduResult SimulatorCard::executeGeneralAuthenticate(const CommandApdu&
 
 	const ASN1Struct cmdData(pCmd.getData());
 
-	if (mSelectedProtocol == KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_128)
+	if (const SecurityProtocol protocol(mSelectedProtocol);
+			protocol.getProtocol() == ProtocolType::PACE
+			&& protocol.getKeyAgreement() == KeyAgreementType::ECDH
+			&& protocol.getMapping() == MappingType::GM)
 	{
-		const SecurityProtocol protocol(mSelectedProtocol);
 		QByteArray responseData;
 
 		if (mChainingStep <= 2 && !pCmd.isCommandChaining())
@@ -338,7 +381,7 @@ ResponseApduResult SimulatorCard::executeGeneralAuthenticate(const CommandApdu&
 			case 0:
 			{
 				mPaceNonce = Randomizer::getInstance().createUuid().toRfc4122();
-				const auto& symmetricKey = KeyDerivationFunction(protocol).pi(QByteArray("123456"));
+				const auto& symmetricKey = KeyDerivationFunction(protocol).pi(mFileSystem.getPassword(mPacePasswordId));
 				SymmetricCipher nonceDecrypter(protocol, symmetricKey);
 				const auto& encryptedNonce = nonceDecrypter.encrypt(mPaceNonce);
 
@@ -368,13 +411,7 @@ ResponseApduResult SimulatorCard::executeGeneralAuthenticate(const CommandApdu&
 				mPaceTerminalKey = cmdData.getData(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::PACE_EPHEMERAL_PUBLIC_KEY);
 
 				auto asn1KeyAgreement = newObject<GA_PERFORMKEYAGREEMENTDATA>();
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-				const auto& encodedPublicKey = EcUtil::getEncodedPublicKey(mCardKey);
-#else
-				const auto& curve = EcUtil::create(EC_GROUP_dup(EC_KEY_get0_group(mCardKey.data())));
-				const auto& encodedPublicKey = EcUtil::point2oct(curve, EC_KEY_get0_public_key(mCardKey.data()));
-#endif
-				Asn1OctetStringUtil::setValue(encodedPublicKey, asn1KeyAgreement->mEphemeralPublicKey);
+				Asn1OctetStringUtil::setValue(getEncodedCardPublicKey(), asn1KeyAgreement->mEphemeralPublicKey);
 				responseData = encodeObject(asn1KeyAgreement.data());
 				break;
 			}
@@ -387,10 +424,37 @@ ResponseApduResult SimulatorCard::executeGeneralAuthenticate(const CommandApdu&
 					return {CardReturnCode::OK, ResponseApdu(StatusCode::LAST_CHAIN_CMD_EXPECTED)};
 				}
 
-				const auto& mutualAuthenticationTerminalData = generateAuthenticationToken(mPaceTerminalKey);
+				const auto& macKey = deriveSecureMessaging(mPaceTerminalKey);
+				CipherMac cmac(protocol, macKey);
+				const auto& terminalToken = cmdData.getData(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::AUTHENTICATION_TOKEN);
+				const auto& expectedTerminalToken = cmac.generate(EcdhKeyAgreement::encodeUncompressedPublicKey(mSelectedProtocol, getEncodedCardPublicKey()));
+				const auto& mutualAuthenticationTerminalData = cmac.generate(EcdhKeyAgreement::encodeUncompressedPublicKey(mSelectedProtocol, mPaceTerminalKey));
 				mCardKey.reset();
 				mPaceTerminalKey.clear();
 
+				// A suspended PIN can only be used in a channel that was established with the CAN.
+				const bool pinSuspended = mPacePasswordId == PacePasswordId::PACE_PIN && mPinRetryCounter == 1;
+				if (pinSuspended && mAuthenticatedPasswordId != PacePasswordId::PACE_CAN)
+				{
+					qCDebug(card_simulator) << "PIN is suspended, CAN required";
+					mNewSecureMessaging.reset();
+					return {CardReturnCode::OK, ResponseApdu(getPinStatus())};
+				}
+
+				const bool pinBlocked = mPacePasswordId == PacePasswordId::PACE_PIN && mPinRetryCounter == 0;
+				if (pinBlocked || terminalToken.isEmpty() || terminalToken != expectedTerminalToken)
+				{
+					qCDebug(card_simulator) << "Mutual authentication failed for" << mPacePasswordId;
+					mNewSecureMessaging.reset();
+					return {CardReturnCode::OK, ResponseApdu(handleWrongPassword())};
+				}
+
+				if (mPacePasswordId == PacePasswordId::PACE_PIN)
+				{
+					mPinRetryCounter = 3;
+				}
+				mAuthenticatedPasswordId = mPacePasswordId;
+
 				auto ga = newObject<GA_MUTUALAUTHENTICATIONDATA>();
 				Asn1OctetStringUtil::setValue(mutualAuthenticationTerminalData, ga->mAuthenticationToken);
 				if (mPaceChat)
@@ -452,6 +516,90 @@ ResponseApduResult SimulatorCard::executeGeneralAuthenticate(const CommandApdu&
 }
 
 
+ResponseApduResult SimulatorCard::executeResetRetryCounter(const CommandApdu& pCmd)
+{
+	if (pCmd.getP2() != CommandApdu::PIN)
+	{
+		return {CardReturnCode::OK, ResponseApdu(StatusCode::INVALID_PARAMETER)};
+	}
+
+	switch (pCmd.getP1())
+	{
+		case CommandApdu::UNBLOCK:
+			if (mAuthenticatedPasswordId != PacePasswordId::PACE_PUK)
+			{
+				return {CardReturnCode::OK, ResponseApdu(StatusCode::ACCESS_DENIED)};
+			}
+			mPinRetryCounter = 3;
+			break;
+
+		case CommandApdu::CHANGE:
+			if (mAuthenticatedPasswordId != PacePasswordId::PACE_PIN)
+			{
+				return {CardReturnCode::OK, ResponseApdu(StatusCode::ACCESS_DENIED)};
+			}
+			if (pCmd.getData().isEmpty())
+			{
+				return {CardReturnCode::OK, ResponseApdu(StatusCode::WRONG_LENGTH)};
+			}
+			mFileSystem.setPassword(PacePasswordId::PACE_PIN, pCmd.getData());
+			break;
+
+		default:
+			return {CardReturnCode::OK, ResponseApdu(StatusCode::INVALID_PARAMETER)};
+	}
+
+	return {CardReturnCode::OK, ResponseApdu(StatusCode::SUCCESS)};
+}
+
+
+StatusCode SimulatorCard::getPinStatus() const
+{
+	switch (mPinRetryCounter)
+	{
+		case 3:
+			return StatusCode::SUCCESS;
+
+		case 2:
+			return StatusCode::PIN_RETRY_COUNT_2;
+
+		case 1:
+			return StatusCode::PIN_SUSPENDED;
+
+		default:
+			return StatusCode::PIN_BLOCKED;
+	}
+}
+
+
+StatusCode SimulatorCard::handleWrongPassword()
+{
+	if (mPacePasswordId != PacePasswordId::PACE_PIN)
+	{
+		return StatusCode::VERIFICATION_FAILED;
+	}
+
+	if (mPinRetryCounter > 0)
+	{
+		--mPinRetryCounter;
+	}
+	return getPinStatus();
+}
+
+
+QByteArray SimulatorCard::getEncodedCardPublicKey() const
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	return EcUtil::getEncodedPublicKey(mCardKey);
+
+#else
+	const auto& curve = EcUtil::create(EC_GROUP_dup(EC_KEY_get0_group(mCardKey.data())));
+	return EcUtil::point2oct(curve, EC_KEY_get0_public_key(mCardKey.data()));
+
+#endif
+}
+
+
 QByteArray SimulatorCard::ecMultiplication(const QByteArray& pPoint) const
 {
 	if (mCardKey.isNull())
@@ -518,7 +666,7 @@ QByteArray SimulatorCard::ecMultiplication(const QByteArray& pPoint) const
 }
 
 
-QByteArray SimulatorCard::generateAuthenticationToken(const QByteArray& pPublicKey, const QByteArray& pNonce)
+QByteArray SimulatorCard::deriveSecureMessaging(const QByteArray& pPublicKey, const QByteArray& pNonce)
 {
 	QByteArray sharedSecret = ecMultiplication(pPublicKey);
 
@@ -529,8 +677,13 @@ QByteArray SimulatorCard::generateAuthenticationToken(const QByteArray& pPublicK
 	QByteArray encKey = kdf.enc(sharedSecret, pNonce);
 
 	mNewSecureMessaging.reset(new SecureMessaging(protocol, encKey, macKey));
+	return macKey;
+}
+
 
-	CipherMac cmac(protocol, macKey);
+QByteArray SimulatorCard::generateAuthenticationToken(const QByteArray& pPublicKey, const QByteArray& pNonce)
+{
+	CipherMac cmac(SecurityProtocol(mSelectedProtocol), deriveSecureMessaging(pPublicKey, pNonce));
 	return cmac.generate(EcdhKeyAgreement::encodeUncompressedPublicKey(mSelectedProtocol, pPublicKey));
 }
 
@@ -32,6 +32,11 @@ class SimulatorCard
 		Oid mSelectedProtocol;
 		int mChainingStep;
 		int mPaceKeyId;
+		PacePasswordId mPacePasswordId;
+		PacePasswordId mAuthenticatedPasswordId;
+		int mPinRetryCounter;
+		ulong mApduLatency;
+		double mFailureRate;
 		QSharedPointer<CHAT> mPaceChat;
 		QByteArray mPaceNonce;
 		QByteArray mPaceTerminalKey;
@@ -49,6 +54,16 @@ class SimulatorCard
 		CardReturnCode releaseConnection() override;
 		bool isConnected() const override;
 
+		/*!
+		 * \brief Delays every transmitted APDU like the air interface of a real card.
+		 */
+		void setApduLatency(ulong pMilliseconds);
+
+		/*!
+		 * \brief Lets the given share of transmits fail like a card that lost contact.
+		 */
+		void setFailureRate(double pFailureRate);
+
 		ResponseApduResult transmit(const CommandApdu& pCmd) override;
 
 		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription) override;
@@ -61,7 +76,12 @@ class SimulatorCard
 		ResponseApduResult executeFileCommand(const CommandApdu& pCmd);
 		ResponseApduResult executeMseSetAt(const CommandApdu& pCmd);
 		ResponseApduResult executeGeneralAuthenticate(const CommandApdu& pCmd);
+		ResponseApduResult executeResetRetryCounter(const CommandApdu& pCmd);
+		[[nodiscard]] StatusCode getPinStatus() const;
+		[[nodiscard]] StatusCode handleWrongPassword();
+		[[nodiscard]] QByteArray getEncodedCardPublicKey() const;
 		QByteArray ecMultiplication(const QByteArray& pPoint) const;
+		QByteArray deriveSecureMessaging(const QByteArray& pPublicKey, const QByteArray& pNonce = QByteArray());
 		QByteArray generateAuthenticationToken(const QByteArray& pPublicKey, const QByteArray& pNonce = QByteArray());
 		QByteArray generateRestrictedId(const QByteArray& pPublicKey) const;
 		StatusCode verifyAuxiliaryData(const QByteArray& pASN1Struct);
@@ -26,6 +26,12 @@ Q_DECLARE_LOGGING_CATEGORY(card_simulator)
 
 void SimulatorFileSystem::initMandatoryData()
 {
+	const QByteArray password("123456");
+	mPasswords.insert(PacePasswordId::PACE_MRZ, password);
+	mPasswords.insert(PacePasswordId::PACE_CAN, password);
+	mPasswords.insert(PacePasswordId::PACE_PIN, password);
+	mPasswords.insert(PacePasswordId::PACE_PUK, password);
+
 	mKeys.insert(1, QByteArray::fromHex(
 			"308202050201003081EC06072A8648CE3D02013081E0020101302C06072A8648CE3D0101022100A9FB57DBA1EEA9BC3E"
 			"660A909D838D726E3BF623D52620282013481D1F6E5377304404207D5A0975FC2C3057EEF67530417AFFE7FB8055C126"
@@ -154,11 +160,29 @@ void SimulatorFileSystem::parseKey(const QJsonObject& pKey)
 }
 
 
+void SimulatorFileSystem::parsePasswords(const QJsonObject& pPasswords)
+{
+	for (auto it = pPasswords.constBegin(); it != pPasswords.constEnd(); ++it)
+	{
+		const auto passwordId = Enum<PacePasswordId>::fromString(it.key(), PacePasswordId::UNKNOWN);
+		const auto& password = it.value().toString();
+		if (passwordId == PacePasswordId::UNKNOWN || password.isEmpty())
+		{
+			qCWarning(card_simulator) << "Skipping password entry. Expected PACE_MRZ, PACE_CAN, PACE_PIN or PACE_PUK with a non-empty string, got" << it.key();
+			continue;
+		}
+
+		mPasswords.insert(passwordId, password.toUtf8());
+	}
+}
+
+
 SimulatorFileSystem::SimulatorFileSystem()
 	: mSelectedFile()
 	, mKeys()
 	, mFiles()
 	, mFileIds()
+	, mPasswords()
 {
 	initMandatoryData();
 
@@ -207,6 +231,7 @@ SimulatorFileSystem::SimulatorFileSystem(const QJsonObject& pData)
 	, mKeys()
 	, mFiles()
 	, mFileIds()
+	, mPasswords()
 {
 	initMandatoryData();
 
@@ -245,6 +270,8 @@ SimulatorFileSystem::SimulatorFileSystem(const QJsonObject& pData)
 
 		parseKey(value.toObject());
 	}
+
+	parsePasswords(pData[QLatin1String("passwords")].toObject());
 }
 
 
@@ -357,6 +384,18 @@ QSharedPointer<EC_KEY> SimulatorFileSystem::getKey(int pKeyId) const
 }
 
 
+QByteArray SimulatorFileSystem::getPassword(PacePasswordId pPasswordId) const
+{
+	return mPasswords.value(pPasswordId);
+}
+
+
+void SimulatorFileSystem::setPassword(PacePasswordId pPasswordId, const QByteArray& pPassword)
+{
+	mPasswords.insert(pPasswordId, pPassword);
+}
+
+
 StatusCode SimulatorFileSystem::verify(const Oid& pOid, const QSharedPointer<AuthenticatedAuxiliaryData>& pAuxiliaryData) const
 {
 	if (!pAuxiliaryData)
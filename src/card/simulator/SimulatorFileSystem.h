@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "SmartCardDefinitions.h"
 #include "apdu/ResponseApdu.h"
 #include "asn1/AuthenticatedAuxiliaryData.h"
 #include "asn1/Oid.h"
@@ -25,9 +26,11 @@ class SimulatorFileSystem
 		QMap<int, QByteArray> mKeys;
 		QMap<QByteArray, QByteArray> mFiles;
 		QMap<QByteArray, QByteArray> mFileIds;
+		QMap<PacePasswordId, QByteArray> mPasswords;
 
 		void initMandatoryData();
 		void parseKey(const QJsonObject& pKey);
+		void parsePasswords(const QJsonObject& pPasswords);
 
 	public:
 		SimulatorFileSystem();
@@ -44,6 +47,9 @@ class SimulatorFileSystem
 		[[nodiscard]] QSharedPointer<EC_KEY> getKey(int pKeyId) const;
 #endif
 
+		[[nodiscard]] QByteArray getPassword(PacePasswordId pPasswordId) const;
+		void setPassword(PacePasswordId pPasswordId, const QByteArray& pPassword);
+
 		[[nodiscard]] StatusCode verify(const Oid& pOid, const QSharedPointer<AuthenticatedAuxiliaryData>& pAuxiliaryData) const;
 
 	private:
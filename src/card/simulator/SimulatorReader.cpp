@@ -15,8 +15,10 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card_simulator)
 
 
-SimulatorReader::SimulatorReader()
-	: ConnectableReader(ReaderManagerPluginType::SIMULATOR, QStringLiteral("Simulator"))
+SimulatorReader::SimulatorReader(const SimulatorReaderProfile& pProfile)
+	: ConnectableReader(ReaderManagerPluginType::SIMULATOR, pProfile.getName())
+	, mProfile(pProfile)
+	, mCard()
 {
 	setInfoBasicReader(Env::getSingleton<AppSettings>()->getSimulatorSettings().isBasicReader());
 }
@@ -36,10 +38,16 @@ void SimulatorReader::insertCard(const QVariant& pData)
 		return;
 	}
 
-	const auto& data = pData.toJsonObject();
+	auto data = pData.toJsonObject();
+	if (data.isEmpty())
+	{
+		data = mProfile.getCardData();
+	}
 	const auto& filesystem = data.isEmpty() ? SimulatorFileSystem() : SimulatorFileSystem(data);
 
 	mCard.reset(new SimulatorCard(filesystem));
+	mCard->setApduLatency(mProfile.getApduLatency());
+	mCard->setFailureRate(mProfile.getFailureRate());
 	fetchCardInfo();
 
 	qCInfo(card_simulator) << "Card inserted:" << getReaderInfo().getCardInfo();
@@ -6,6 +6,7 @@
 
 #include "Reader.h"
 #include "SimulatorCard.h"
+#include "SimulatorReaderProfile.h"
 
 
 namespace governikus
@@ -17,10 +18,11 @@ class SimulatorReader
 	Q_OBJECT
 
 	private:
+		const SimulatorReaderProfile mProfile;
 		QScopedPointer<SimulatorCard, QScopedPointerDeleteLater> mCard;
 
 	public:
-		SimulatorReader();
+		explicit SimulatorReader(const SimulatorReaderProfile& pProfile = SimulatorReaderProfile());
 
 		[[nodiscard]] Card* getCard() const override;
 		void insertCard(const QVariant& pData = QVariant()) override;
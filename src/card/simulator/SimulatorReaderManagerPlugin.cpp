@@ -16,13 +16,22 @@ Q_DECLARE_LOGGING_CATEGORY(card_simulator)
 
 SimulatorReaderManagerPlugin::SimulatorReaderManagerPlugin()
 	: ReaderManagerPlugin(ReaderManagerPluginType::SIMULATOR, true)
-	, mSimulatorReader()
+	, mReaders()
 {
 	connect(&Env::getSingleton<AppSettings>()->getSimulatorSettings(), &SimulatorSettings::fireEnabledChanged, this, &SimulatorReaderManagerPlugin::onSettingsChanged);
 	connect(Env::getSingleton<VolatileSettings>(), &VolatileSettings::fireUsedAsSdkChanged, this, &SimulatorReaderManagerPlugin::onSettingsChanged);
 }
 
 
+SimulatorReaderManagerPlugin::~SimulatorReaderManagerPlugin()
+{
+	for (auto* reader : std::as_const(mReaders))
+	{
+		deleteReader(reader);
+	}
+}
+
+
 void SimulatorReaderManagerPlugin::init()
 {
 	ReaderManagerPlugin::init();
@@ -33,11 +42,53 @@ void SimulatorReaderManagerPlugin::init()
 
 QList<Reader*> SimulatorReaderManagerPlugin::getReaders() const
 {
-	if (getInfo().isEnabled() && mSimulatorReader)
+	QList<Reader*> readers;
+	if (getInfo().isEnabled())
+	{
+		for (auto* reader : std::as_const(mReaders))
+		{
+			readers += reader;
+		}
+	}
+	return readers;
+}
+
+
+void SimulatorReaderManagerPlugin::addReader(const SimulatorReaderProfile& pProfile)
+{
+	auto* reader = new SimulatorReader(pProfile);
+	mReaders.insert(reader->getName(), reader);
+
+	// The signals are forwarded from the thread of the reader to keep their order.
+	connect(reader, &SimulatorReader::fireReaderPropertiesUpdated, this, &SimulatorReaderManagerPlugin::fireReaderPropertiesUpdated, Qt::DirectConnection);
+	connect(reader, &SimulatorReader::fireCardInserted, this, &SimulatorReaderManagerPlugin::fireCardInserted, Qt::DirectConnection);
+	connect(reader, &SimulatorReader::fireCardRemoved, this, &SimulatorReaderManagerPlugin::fireCardRemoved, Qt::DirectConnection);
+	qCDebug(card_simulator) << "fireReaderAdded" << reader->getName();
+	Q_EMIT fireReaderAdded(reader->getReaderInfo());
+
+	// The latency of a card blocks its thread, so it must not be the thread of the other readers.
+	if (pProfile.getApduLatency() > 0)
 	{
-		return {mSimulatorReader.data()};
+		moveToReaderThread(reader);
+	}
+
+	runOnThread(reader, [reader] {
+			reader->connectReader();
+		});
+}
+
+
+void SimulatorReaderManagerPlugin::removeReaders()
+{
+	while (!mReaders.isEmpty())
+	{
+		auto* reader = mReaders.take(mReaders.firstKey());
+		runOnThread(reader, [this, reader] {
+				reader->disconnect(this);
+				Q_EMIT fireReaderRemoved(reader->getReaderInfo());
+			});
+		deleteReader(reader);
 	}
-	return {};
 }
 
 
@@ -45,15 +96,13 @@ void SimulatorReaderManagerPlugin::startScan(bool pAutoConnect)
 {
 	if (getInfo().isEnabled())
 	{
-		mSimulatorReader.reset(new SimulatorReader());
-
-		connect(mSimulatorReader.data(), &SimulatorReader::fireReaderPropertiesUpdated, this, &SimulatorReaderManagerPlugin::fireReaderPropertiesUpdated);
-		connect(mSimulatorReader.data(), &SimulatorReader::fireCardInserted, this, &SimulatorReaderManagerPlugin::fireCardInserted);
-		connect(mSimulatorReader.data(), &SimulatorReader::fireCardRemoved, this, &SimulatorReaderManagerPlugin::fireCardRemoved);
-		qCDebug(card_simulator) << "fireReaderAdded" << mSimulatorReader->getName();
-		Q_EMIT fireReaderAdded(mSimulatorReader->getReaderInfo());
+		const auto& settings = Env::getSingleton<AppSettings>()->getSimulatorSettings();
+		const auto& profiles = SimulatorReaderProfile::load(settings.getReaderProfiles(), settings.getApduLatency());
+		for (const auto& profile : profiles)
+		{
+			addReader(profile);
+		}
 
-		mSimulatorReader->connectReader();
 		ReaderManagerPlugin::startScan(pAutoConnect);
 		setInitialScanState(ReaderManagerPluginInfo::InitialScan::SUCCEEDED);
 	}
@@ -62,28 +111,34 @@ void SimulatorReaderManagerPlugin::startScan(bool pAutoConnect)
 
 void SimulatorReaderManagerPlugin::stopScan(const QString& pError)
 {
-	if (mSimulatorReader)
+	for (auto* reader : std::as_const(mReaders))
 	{
-		mSimulatorReader->disconnectReader(pError);
-
-		auto info = mSimulatorReader->getReaderInfo();
-		mSimulatorReader.reset();
-		Q_EMIT fireReaderRemoved(info);
+		runOnThread(reader, [reader, &pError] {
+				reader->disconnectReader(pError);
+			});
 	}
+	removeReaders();
 	ReaderManagerPlugin::stopScan(pError);
 }
 
 
 void SimulatorReaderManagerPlugin::insert(const QString& pReaderName, const QVariant& pData)
 {
-	Q_UNUSED(pReaderName)
-
 	if (!getInfo().isScanRunning())
 	{
 		return;
 	}
 
-	mSimulatorReader->insertCard(pData);
+	auto* reader = mReaders.value(pReaderName);
+	if (!reader)
+	{
+		qCWarning(card_simulator) << "Cannot insert card into unknown reader:" << pReaderName;
+		return;
+	}
+
+	runOnThread(reader, [reader, &pData] {
+			reader->insertCard(pData);
+		});
 }
 
 
@@ -97,11 +152,8 @@ void SimulatorReaderManagerPlugin::onSettingsChanged()
 
 	qCDebug(card_simulator) << "SimulatorStateChanged:" << enabled;
 	setPluginEnabled(enabled);
-	if (!enabled && mSimulatorReader)
+	if (!enabled)
 	{
-		mSimulatorReader->disconnect(this);
-		const auto& readerInfo = mSimulatorReader->getReaderInfo();
-		mSimulatorReader.reset();
-		Q_EMIT fireReaderRemoved(readerInfo);
+		removeReaders();
 	}
 }
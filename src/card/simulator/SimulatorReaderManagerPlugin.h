@@ -7,7 +7,7 @@
 #include "ReaderManagerPlugin.h"
 #include "SimulatorReader.h"
 
-#include <QScopedPointer>
+#include <QMap>
 
 
 namespace governikus
@@ -21,10 +21,14 @@ class SimulatorReaderManagerPlugin
 	Q_INTERFACES(governikus::ReaderManagerPlugin)
 
 	private:
-		QScopedPointer<SimulatorReader> mSimulatorReader;
+		QMap<QString, SimulatorReader*> mReaders;
+
+		void addReader(const SimulatorReaderProfile& pProfile);
+		void removeReaders();
 
 	public:
 		SimulatorReaderManagerPlugin();
+		~SimulatorReaderManagerPlugin() override;
 
 		[[nodiscard]] QList<Reader*> getReaders() const override;
 
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SimulatorReaderProfile.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QLoggingCategory>
+#include <QSet>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_simulator)
+
+
+namespace
+{
+QJsonArray readProfiles(const QString& pFileName)
+{
+	if (pFileName.isEmpty())
+	{
+		return QJsonArray();
+	}
+
+	QFile file(pFileName);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		qCWarning(card_simulator) << "Cannot open reader profiles:" << pFileName;
+		return QJsonArray();
+	}
+
+	QJsonParseError error {};
+	const auto& document = QJsonDocument::fromJson(file.readAll(), &error);
+	if (error.error != QJsonParseError::NoError || !document.isArray())
+	{
+		qCWarning(card_simulator) << "Cannot parse reader profiles:" << pFileName << error.errorString();
+		return QJsonArray();
+	}
+
+	return document.array();
+}
+
+
+} // namespace
+
+
+SimulatorReaderProfile::SimulatorReaderProfile(const QString& pName, const QJsonObject& pCardData, ulong pApduLatency, double pFailureRate)
+	: mName(pName)
+	, mCardData(pCardData)
+	, mApduLatency(pApduLatency)
+	, mFailureRate(pFailureRate)
+{
+}
+
+
+const QString& SimulatorReaderProfile::getName() const
+{
+	return mName;
+}
+
+
+const QJsonObject& SimulatorReaderProfile::getCardData() const
+{
+	return mCardData;
+}
+
+
+ulong SimulatorReaderProfile::getApduLatency() const
+{
+	return mApduLatency;
+}
+
+
+double SimulatorReaderProfile::getFailureRate() const
+{
+	return mFailureRate;
+}
+
+
+QList<SimulatorReaderProfile> SimulatorReaderProfile::fromJson(const QJsonArray& pProfiles, ulong pDefaultApduLatency)
+{
+	QList<SimulatorReaderProfile> profiles;
+	QSet<QString> names;
+
+	for (const QJsonValueConstRef value : pProfiles)
+	{
+		const auto& profile = value.toObject();
+		const auto& name = profile[QLatin1String("name")].toString();
+		const auto count = profile[QLatin1String("count")].toInt(1);
+		const auto apduLatency = profile[QLatin1String("apduLatency")].toInteger(static_cast<qint64>(pDefaultApduLatency));
+		const auto failureRate = profile[QLatin1String("failureRate")].toDouble(0.0);
+		if (name.isEmpty() || count < 1 || apduLatency < 0 || failureRate < 0.0 || failureRate > 1.0)
+		{
+			qCWarning(card_simulator) << "Skipping reader profile. Expected JSON object with 'name' and optional 'count', 'apduLatency', 'failureRate' and 'card', got" << value;
+			continue;
+		}
+
+		const auto& cardData = profile[QLatin1String("card")].toObject();
+		for (int i = 1; i <= count; ++i)
+		{
+			const auto& readerName = count == 1 ? name : QStringLiteral("%1 %2").arg(name).arg(i);
+			if (names.contains(readerName))
+			{
+				qCWarning(card_simulator) << "Skipping reader profile with duplicate name:" << readerName;
+				continue;
+			}
+
+			names += readerName;
+			profiles += SimulatorReaderProfile(readerName, cardData, static_cast<ulong>(apduLatency), failureRate);
+		}
+	}
+
+	return profiles;
+}
+
+
+QList<SimulatorReaderProfile> SimulatorReaderProfile::load(const QString& pFileName, ulong pDefaultApduLatency)
+{
+	const auto& profiles = fromJson(readProfiles(pFileName), pDefaultApduLatency);
+	if (profiles.isEmpty())
+	{
+		return {SimulatorReaderProfile(QStringLiteral("Simulator"), QJsonObject(), pDefaultApduLatency)};
+	}
+
+	qCInfo(card_simulator) << "Loaded" << profiles.size() << "reader profiles from" << pFileName;
+	return profiles;
+}
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Identity and behaviour of one simulated reader.
+ *
+ * A list of profiles allows the simulator to provide many readers at once,
+ * each with its own card, APDU latency and rate of failing transmits.
+ */
+
+#pragma once
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+
+namespace governikus
+{
+
+class SimulatorReaderProfile
+{
+	private:
+		QString mName;
+		QJsonObject mCardData;
+		ulong mApduLatency;
+		double mFailureRate;
+
+	public:
+		explicit SimulatorReaderProfile(const QString& pName = QStringLiteral("Simulator"),
+				const QJsonObject& pCardData = QJsonObject(),
+				ulong pApduLatency = 0,
+				double pFailureRate = 0.0);
+
+		[[nodiscard]] const QString& getName() const;
+		[[nodiscard]] const QJsonObject& getCardData() const;
+		[[nodiscard]] ulong getApduLatency() const;
+		[[nodiscard]] double getFailureRate() const;
+
+		/*!
+		 * \brief Parses a JSON array of profiles.
+		 *
+		 * Every entry needs a unique "name" and may contain "count", "apduLatency",
+		 * "failureRate" and the "card" in the format of \ref SimulatorFileSystem.
+		 * An entry with a "count" greater than one is expanded to numbered readers.
+		 */
+		[[nodiscard]] static QList<SimulatorReaderProfile> fromJson(const QJsonArray& pProfiles, ulong pDefaultApduLatency = 0);
+
+		/*!
+		 * \brief Loads the profiles from a JSON file. Falls back to a single
+		 * default reader if no file is given or it does not contain any valid profile.
+		 */
+		[[nodiscard]] static QList<SimulatorReaderProfile> load(const QString& pFileName, ulong pDefaultApduLatency = 0);
+};
+
+} // namespace governikus
@@ -23,6 +23,8 @@
 #include <QStandardPaths>
 #include <QTimer>
 
+#include <algorithm>
+
 #if defined(Q_OS_WIN)
 	#include <windows.h>
 #endif
@@ -31,6 +33,7 @@
 namespace governikus
 {
 bool AppController::cShowUi = false;
+int AppController::cMaxConcurrentWorkflows = 1;
 } // namespace governikus
 
 
@@ -45,6 +48,7 @@ Q_DECLARE_LOGGING_CATEGORY(system)
 AppController::AppController()
 	: mActiveWorkflow()
 	, mWaitingRequest()
+	, mConcurrentWorkflows()
 	, mShutdownRunning(false)
 	, mUiDomination(nullptr)
 	, mRestartApplication(false)
@@ -76,6 +80,38 @@ bool AppController::canStartNewWorkflow() const
 }
 
 
+bool AppController::canStartConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest) const
+{
+	// Only workflows of different UI sessions run concurrently, so every session
+	// keeps its own state. The workflows select different readers.
+	const auto& sessionId = pRequest->getSessionId();
+	if (sessionId.isNull() || getRunningWorkflowCount() >= cMaxConcurrentWorkflows)
+	{
+		return false;
+	}
+
+	// The settings are global, so they must be equal to the settings of the running workflows.
+	const auto& settings = pRequest->getSessionSettings();
+	if (settings && !(settings.value() == Env::getSingleton<VolatileSettings>()->getWorkflowSettings()))
+	{
+		qCInfo(support) << "Workflow of session" << sessionId << "requests other settings than the running workflows";
+		return false;
+	}
+
+	const auto& isSameSession = [&sessionId](const QSharedPointer<WorkflowRequest>& pWorkflow){
+				return pWorkflow->getSessionId() == sessionId;
+			};
+	return (mActiveWorkflow.isNull() || !isSameSession(mActiveWorkflow))
+		   && std::none_of(mConcurrentWorkflows.constBegin(), mConcurrentWorkflows.constEnd(), isSameSession);
+}
+
+
+qsizetype AppController::getRunningWorkflowCount() const
+{
+	return (mActiveWorkflow.isNull() ? 0 : 1) + mConcurrentWorkflows.size();
+}
+
+
 bool AppController::eventFilter(QObject* pObj, QEvent* pEvent)
 {
 #ifdef Q_OS_MACOS
@@ -187,6 +223,19 @@ bool AppController::shouldApplicationRestart() const
 
 void AppController::onWorkflowFinished()
 {
+	if (const auto* controller = sender())
+	{
+		const auto iter = std::find_if(mConcurrentWorkflows.constBegin(), mConcurrentWorkflows.constEnd(), [controller](const QSharedPointer<WorkflowRequest>& pRequest){
+				return pRequest->getController().data() == controller;
+			});
+		if (iter != mConcurrentWorkflows.constEnd())
+		{
+			const auto request = *iter;
+			finishConcurrentWorkflow(request);
+			return;
+		}
+	}
+
 	Q_ASSERT(mActiveWorkflow);
 	Q_ASSERT(mActiveWorkflow->getController());
 
@@ -207,7 +256,26 @@ void AppController::onWorkflowFinished()
 		mWaitingRequest.reset();
 	}
 
-	if (mShutdownRunning)
+	if (mShutdownRunning && getRunningWorkflowCount() == 0)
+	{
+		completeShutdown();
+	}
+}
+
+
+void AppController::finishConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest)
+{
+	auto controller = pRequest->getController();
+
+	qDebug() << controller->metaObject()->className() << "done";
+	disconnect(controller.data(), &WorkflowController::fireComplete, this, &AppController::onWorkflowFinished);
+	mConcurrentWorkflows.removeOne(pRequest);
+
+	Q_EMIT fireWorkflowFinished(pRequest);
+
+	qCInfo(support) << "Finish concurrent workflow" << pRequest->getAction() << "| Running workflows:" << getRunningWorkflowCount();
+
+	if (mShutdownRunning && getRunningWorkflowCount() == 0)
 	{
 		completeShutdown();
 	}
@@ -219,12 +287,25 @@ void AppController::onWorkflowRequested(const QSharedPointer<WorkflowRequest>& p
 	Q_ASSERT(pRequest && !pRequest->isInitialized());
 	qDebug() << "New workflow requested:" << pRequest->getAction();
 
-	if (canStartNewWorkflow())
+	if (canStartNewWorkflow() && mConcurrentWorkflows.isEmpty())
 	{
 		startNewWorkflow(pRequest);
 		return;
 	}
 
+	if (canStartConcurrentWorkflow(pRequest))
+	{
+		startConcurrentWorkflow(pRequest);
+		return;
+	}
+
+	if (mActiveWorkflow.isNull())
+	{
+		qWarning() << "Cannot start workflow beside concurrent workflows:" << pRequest->getAction();
+		Q_EMIT fireWorkflowUnhandled(pRequest);
+		return;
+	}
+
 	switch (pRequest->handleBusyWorkflow(mActiveWorkflow, mWaitingRequest))
 	{
 		case WorkflowControl::UNHANDLED:
@@ -300,7 +381,7 @@ void AppController::doShutdown(int pExitCode)
 	mExitCode = pExitCode;
 	mShutdownRunning = true;
 
-	if (mActiveWorkflow)
+	if (getRunningWorkflowCount() > 0)
 	{
 		// Make sure that any request for a new workflow is removed from the queue.
 		mWaitingRequest.reset();
@@ -309,11 +390,20 @@ void AppController::doShutdown(int pExitCode)
 		// (hiding the GUI also closes open dialogs).
 		Q_EMIT fireHideUi();
 
-		// Make sure the workflow runs to the end without user interaction.
-		const QSharedPointer<WorkflowContext> context = mActiveWorkflow->getContext();
-		if (context)
+		// Make sure the workflows run to the end without user interaction.
+		auto workflows = mConcurrentWorkflows;
+		if (mActiveWorkflow)
+		{
+			workflows.prepend(mActiveWorkflow);
+		}
+
+		for (const auto& workflow : std::as_const(workflows))
 		{
-			context->killWorkflow();
+			const QSharedPointer<WorkflowContext> context = workflow->getContext();
+			if (context)
+			{
+				context->killWorkflow();
+			}
 		}
 	}
 	else
@@ -393,7 +483,7 @@ void AppController::waitForNetworkConnections(const std::function<void()>& pExit
 void AppController::onUiDominationRequested(const UiPlugin* pUi, const QString& pInformation)
 {
 	bool accepted = false;
-	if (mUiDomination == nullptr && canStartNewWorkflow())
+	if (mUiDomination == nullptr && getRunningWorkflowCount() == 0)
 	{
 		mUiDomination = pUi;
 		accepted = true;
@@ -462,23 +552,52 @@ bool AppController::startNewWorkflow(const QSharedPointer<WorkflowRequest>& pReq
 	}
 
 	mActiveWorkflow = pRequest;
-	mActiveWorkflow->initialize();
-	qCInfo(support) << "Started new workflow" << mActiveWorkflow->getAction();
-	auto controller = mActiveWorkflow->getController();
+	return runWorkflow(pRequest);
+}
+
+
+void AppController::startConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest)
+{
+	Q_ASSERT(pRequest && !pRequest->isInitialized());
+
+	mConcurrentWorkflows += pRequest;
+	qCInfo(support) << "Run concurrent workflow" << pRequest->getAction() << "| Running workflows:" << getRunningWorkflowCount();
+	runWorkflow(pRequest);
+}
+
+
+bool AppController::runWorkflow(const QSharedPointer<WorkflowRequest>& pRequest)
+{
+	pRequest->initialize();
+	qCInfo(support) << "Started new workflow" << pRequest->getAction();
+	auto controller = pRequest->getController();
 	connect(controller.data(), &WorkflowController::fireComplete, this, &AppController::onWorkflowFinished, Qt::QueuedConnection);
-	Env::getSingleton<LogHandler>()->resetBacklog();
+	if (getRunningWorkflowCount() == 1)
+	{
+		// The backlog is shared by concurrent workflows.
+		Env::getSingleton<LogHandler>()->resetBacklog();
+
+		// A concurrent workflow is only started with the settings in use.
+		if (const auto& settings = pRequest->getSessionSettings())
+		{
+			Env::getSingleton<VolatileSettings>()->setWorkflowSettings(settings.value());
+		}
+	}
+
+	// Connections are not shared, a concurrent workflow would miss the TLS handshake of a reused connection.
+	pRequest->getContext()->setConnectionScope(QUuid::createUuid());
 	qDebug() << "Start" << controller->metaObject()->className();
 
 	//first: run new active controller so that it can be canceled during UI activation if required
 	controller->run();
 
 	//second: activate ui
-	Q_EMIT fireWorkflowStarted(mActiveWorkflow);
+	Q_EMIT fireWorkflowStarted(pRequest);
 
-	if (!mActiveWorkflow->getContext()->wasClaimed())
+	if (!pRequest->getContext()->wasClaimed())
 	{
 		qCritical() << "Workflow was not claimed by any UI... aborting";
-		mActiveWorkflow->getContext()->killWorkflow(GlobalStatus::Code::Workflow_InternalError_BeforeTcToken);
+		pRequest->getContext()->killWorkflow(GlobalStatus::Code::Workflow_InternalError_BeforeTcToken);
 		return false;
 	}
 
@@ -36,14 +36,18 @@ class AppController final
 
 	private:
 		static bool cShowUi;
+		static int cMaxConcurrentWorkflows;
 		QSharedPointer<WorkflowRequest> mActiveWorkflow;
 		QSharedPointer<WorkflowRequest> mWaitingRequest;
+		QList<QSharedPointer<WorkflowRequest>> mConcurrentWorkflows;
 		bool mShutdownRunning;
 		const UiPlugin* mUiDomination;
 		bool mRestartApplication;
 		int mExitCode;
 
 		[[nodiscard]] bool canStartNewWorkflow() const;
+		[[nodiscard]] bool canStartConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest) const;
+		[[nodiscard]] qsizetype getRunningWorkflowCount() const;
 		void completeShutdown();
 		void waitForNetworkConnections(const std::function<void()>& pExitFunc);
 
@@ -86,6 +90,9 @@ class AppController final
 
 	private:
 		bool startNewWorkflow(const QSharedPointer<WorkflowRequest>& pRequest);
+		void startConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest);
+		bool runWorkflow(const QSharedPointer<WorkflowRequest>& pRequest);
+		void finishConcurrentWorkflow(const QSharedPointer<WorkflowRequest>& pRequest);
 		static void clearCacheFolders();
 
 };
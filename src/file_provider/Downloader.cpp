@@ -25,6 +25,10 @@ static const char* const cABORTED = "aborted_download";
 void Downloader::scheduleDownload(const QNetworkRequest& pDownloadRequest)
 {
 	mPendingRequests.enqueue(pDownloadRequest);
+	if (mCurrentReply)
+	{
+		Env::getSingleton<NetworkManager>()->prefetch(pDownloadRequest.url());
+	}
 
 	startDownloadIfPending();
 }
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "BinaryLog.h"
+
+#include <QIODevice>
+
+
+using namespace governikus;
+
+
+namespace
+{
+enum RecordKind : quint8
+{
+	CATEGORY = 1,
+	ORIGIN = 2,
+	MESSAGE = 3
+};
+
+
+constexpr auto cStreamVersion = QDataStream::Qt_6_0;
+} // namespace
+
+
+BinaryLog::BinaryLog()
+	: mCategories()
+	, mOrigins()
+{
+}
+
+
+void BinaryLog::reset()
+{
+	mCategories.clear();
+	mOrigins.clear();
+}
+
+
+quint32 BinaryLog::define(QHash<QByteArray, quint32>& pDefinitions, const QByteArray& pValue, quint8 pKind, QByteArray& pOutput)
+{
+	if (const auto iter = pDefinitions.constFind(pValue); iter != pDefinitions.constEnd())
+	{
+		return *iter;
+	}
+
+	const auto id = static_cast<quint32>(pDefinitions.size());
+	pDefinitions.insert(pValue, id);
+
+	QDataStream stream(&pOutput, QIODevice::WriteOnly | QIODevice::Append);
+	stream.setVersion(cStreamVersion);
+	stream << pKind << id << pValue;
+	return id;
+}
+
+
+QByteArray BinaryLog::encode(qint64 pTimestamp, quintptr pThreadId, QtMsgType pType,
+		const QByteArray& pCategory, const QByteArray& pOrigin, const QString& pMessage)
+{
+	QByteArray output;
+	const auto categoryId = define(mCategories, pCategory, RecordKind::CATEGORY, output);
+	const auto originId = define(mOrigins, pOrigin, RecordKind::ORIGIN, output);
+
+	QDataStream stream(&output, QIODevice::WriteOnly | QIODevice::Append);
+	stream.setVersion(cStreamVersion);
+	stream << static_cast<quint8>(RecordKind::MESSAGE)
+		   << pTimestamp
+		   << static_cast<quint64>(pThreadId)
+		   << static_cast<quint8>(pType)
+		   << categoryId
+		   << originId
+		   << pMessage.toUtf8();
+	return output;
+}
+
+
+const QByteArray& BinaryLog::getHeader()
+{
+	static const QByteArray header = QByteArrayLiteral("\x89" "GLOG\r\n\x01");
+	return header;
+}
+
+
+bool BinaryLog::isBinary(const QByteArray& pData)
+{
+	return pData.startsWith(getHeader());
+}
+
+
+QHash<quint32, QString> BinaryLog::invert(const QHash<QByteArray, quint32>& pDefinitions)
+{
+	QHash<quint32, QString> definitions;
+	for (auto iter = pDefinitions.constBegin(); iter != pDefinitions.constEnd(); ++iter)
+	{
+		definitions.insert(iter.value(), QString::fromUtf8(iter.key()));
+	}
+	return definitions;
+}
+
+
+QList<LogEntry> BinaryLog::read(const QByteArray& pData, qint64 pStart, qint64 pLength)
+{
+	if (!isBinary(pData))
+	{
+		return QList<LogEntry>();
+	}
+
+	QHash<quint32, QString> categories;
+	QHash<quint32, QString> origins;
+
+	QDataStream stream(pData);
+	stream.setVersion(cStreamVersion);
+	stream.skipRawData(static_cast<int>(getHeader().size()));
+	return readRecords(stream, categories, origins, pStart, pLength < 0 ? pData.size() : pStart + pLength);
+}
+
+
+QList<LogEntry> BinaryLog::readEncoded(const QByteArray& pRecords) const
+{
+	auto categories = invert(mCategories);
+	auto origins = invert(mOrigins);
+
+	QDataStream stream(pRecords);
+	stream.setVersion(cStreamVersion);
+	return readRecords(stream, categories, origins, 0, pRecords.size());
+}
+
+
+QList<LogEntry> BinaryLog::readRecords(QDataStream& pStream, QHash<quint32, QString>& pCategories, QHash<quint32, QString>& pOrigins,
+		qint64 pStart, qint64 pEnd)
+{
+	QList<LogEntry> entries;
+
+	while (!pStream.atEnd())
+	{
+		const auto position = pStream.device()->pos();
+		if (position >= pEnd)
+		{
+			break;
+		}
+
+		quint8 kind = 0;
+		pStream >> kind;
+
+		if (kind == RecordKind::CATEGORY || kind == RecordKind::ORIGIN)
+		{
+			quint32 id = 0;
+			QByteArray value;
+			pStream >> id >> value;
+			if (pStream.status() != QDataStream::Ok)
+			{
+				break;
+			}
+
+			auto& definitions = kind == RecordKind::CATEGORY ? pCategories : pOrigins;
+			definitions.insert(id, QString::fromUtf8(value));
+			continue;
+		}
+
+		if (kind != RecordKind::MESSAGE)
+		{
+			// The record is unknown, so the rest of the data cannot be read.
+			break;
+		}
+
+		qint64 timestamp = 0;
+		quint64 threadId = 0;
+		quint8 type = 0;
+		quint32 categoryId = 0;
+		quint32 originId = 0;
+		QByteArray message;
+		pStream >> timestamp >> threadId >> type >> categoryId >> originId >> message;
+		if (pStream.status() != QDataStream::Ok)
+		{
+			// The last record may be incomplete while it is written.
+			break;
+		}
+
+		if (position >= pStart && position < pEnd)
+		{
+			entries += LogEntry(timestamp,
+					static_cast<quintptr>(threadId),
+					static_cast<QtMsgType>(type),
+					pCategories.value(categoryId),
+					pOrigins.value(originId),
+					QString::fromUtf8(message));
+		}
+	}
+
+	return entries;
+}
+
+
+QByteArray BinaryLog::toText(const QByteArray& pData, qint64 pStart, qint64 pLength)
+{
+	return toText(read(pData, pStart, pLength));
+}
+
+
+QByteArray BinaryLog::toText(const QList<LogEntry>& pEntries)
+{
+#ifdef Q_OS_WIN
+	const QLatin1String lineBreak("\r\n");
+#else
+	const QLatin1Char lineBreak('\n');
+#endif
+
+	QString text;
+	for (const auto& entry : pEntries)
+	{
+		text += entry.toString() + lineBreak;
+	}
+	return text.toUtf8();
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Compact binary format of the logfile.
+ *
+ * The file starts with a magic header followed by records. Categories and origins
+ * (function, file and line) are defined once by a record with an id and referenced
+ * by the message records. A message record keeps the timestamp, the thread,
+ * the level, the ids and the message. The text is rendered by \ref LogEntry.
+ */
+
+#pragma once
+
+#include "LogEntry.h"
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QHash>
+#include <QList>
+
+
+namespace governikus
+{
+
+class BinaryLog
+{
+	private:
+		QHash<QByteArray, quint32> mCategories;
+		QHash<QByteArray, quint32> mOrigins;
+
+		static quint32 define(QHash<QByteArray, quint32>& pDefinitions, const QByteArray& pValue, quint8 pKind, QByteArray& pOutput);
+		static QHash<quint32, QString> invert(const QHash<QByteArray, quint32>& pDefinitions);
+		static QList<LogEntry> readRecords(QDataStream& pStream, QHash<quint32, QString>& pCategories, QHash<quint32, QString>& pOrigins,
+				qint64 pStart, qint64 pEnd);
+
+	public:
+		BinaryLog();
+
+		void reset();
+		[[nodiscard]] QByteArray encode(qint64 pTimestamp, quintptr pThreadId, QtMsgType pType,
+				const QByteArray& pCategory, const QByteArray& pOrigin, const QString& pMessage);
+
+		[[nodiscard]] static const QByteArray& getHeader();
+		[[nodiscard]] static bool isBinary(const QByteArray& pData);
+
+		/*!
+		 * \brief Reads the entries of the records that start within the given range.
+		 * The definitions are always read from the start of the data.
+		 */
+		[[nodiscard]] static QList<LogEntry> read(const QByteArray& pData, qint64 pStart = 0, qint64 pLength = -1);
+		[[nodiscard]] static QByteArray toText(const QByteArray& pData, qint64 pStart = 0, qint64 pLength = -1);
+		[[nodiscard]] static QByteArray toText(const QList<LogEntry>& pEntries);
+
+		/*!
+		 * \brief Reads records that were encoded by this instance without the header,
+		 * e.g. a part of the written logfile. The definitions are known, so only
+		 * the given records are read.
+		 */
+		[[nodiscard]] QList<LogEntry> readEncoded(const QByteArray& pRecords) const;
+};
+
+} // namespace governikus
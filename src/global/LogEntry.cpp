@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogEntry.h"
+
+#include "Initializer.h"
+#include "LogHandler.h"
+
+#include <QDateTime>
+#include <QRegularExpression>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+INIT_FUNCTION([] {
+			qRegisterMetaType<LogEntry>("LogEntry");
+		})
+
+
+namespace
+{
+const auto cSplitToken = QLatin1String(" : ");
+} // namespace
+
+
+LogEntry::LogEntry()
+	: LogEntry(0, 0, QtDebugMsg, QString(), QString(), QString())
+{
+}
+
+
+LogEntry::LogEntry(qint64 pTimestamp, quintptr pThreadId, QtMsgType pType, const QString& pCategory, const QString& pOrigin, const QString& pMessage)
+	: mText()
+	, mLevel(getLevel(pType))
+	, mCategory(pCategory)
+	, mTimestamp(pTimestamp)
+	, mThreadId(pThreadId)
+	, mType(pType)
+	, mOrigin(pOrigin)
+	, mMessage(pMessage)
+{
+}
+
+
+LogEntry LogEntry::fromText(const QString& pText)
+{
+	static const QRegularExpression re(QStringLiteral("[0-9]{3,} ([A-Z]) "));
+
+	LogEntry entry;
+	entry.mText = pText;
+	entry.mCategory = pText.left(pText.indexOf(QLatin1Char(' ')));
+
+	const auto& match = re.match(pText);
+	entry.mLevel = match.hasMatch() ? match.captured(1) : QStringLiteral("D");
+	return entry;
+}
+
+
+bool LogEntry::isText() const
+{
+	return !mText.isNull();
+}
+
+
+void LogEntry::appendText(const QString& pText)
+{
+	Q_ASSERT(isText());
+	mText.append(QLatin1Char('\n')).append(pText);
+}
+
+
+QString LogEntry::getLevel(QtMsgType pType)
+{
+	switch (pType)
+	{
+		case QtInfoMsg:
+			return QStringLiteral("I");
+
+		case QtWarningMsg:
+			return QStringLiteral("W");
+
+		case QtCriticalMsg:
+			return QStringLiteral("C");
+
+		case QtFatalMsg:
+			return QStringLiteral("F");
+
+		default:
+			return QStringLiteral("D");
+	}
+}
+
+
+const QString& LogEntry::getLevel() const
+{
+	return mLevel;
+}
+
+
+const QString& LogEntry::getCategory() const
+{
+	return mCategory;
+}
+
+
+QString LogEntry::getPrefix() const
+{
+	const auto& time = QDateTime::fromMSecsSinceEpoch(mTimestamp).toString(QStringLiteral("yyyy.MM.dd hh:mm:ss.zzz"));
+	const QChar level = mType == QtDebugMsg ? QLatin1Char(' ') : mLevel.at(0);
+
+	return mCategory.leftJustified(LogHandler::MAX_CATEGORY_LENGTH)
+		   + QLatin1Char(' ') + time
+		   + QLatin1Char(' ') + QString::number(mThreadId)
+		   + QLatin1Char(' ') + level
+		   + QLatin1Char(' ') + mOrigin;
+}
+
+
+QString LogEntry::getOrigin() const
+{
+	if (isText())
+	{
+		return mText.section(cSplitToken, 0, 0).trimmed();
+	}
+
+	return getPrefix().trimmed();
+}
+
+
+QString LogEntry::getMessage() const
+{
+	if (isText())
+	{
+		return mText.section(cSplitToken, 1, -1).trimmed();
+	}
+
+	return mMessage.trimmed();
+}
+
+
+QString LogEntry::toString() const
+{
+	if (isText())
+	{
+		return mText;
+	}
+
+	// Same padding as LogHandler::getPaddedLogMsg, the origin contains the function, file and line.
+	const auto paddingSize = std::max<qsizetype>(0, LogHandler::FUNCTION_FILENAME_SIZE - mOrigin.size());
+	return getPrefix() + QLatin1Char(' ') + QString(paddingSize, QLatin1Char(' ')) + QStringLiteral(": ") + mMessage;
+}
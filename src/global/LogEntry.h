@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Entry of a logfile.
+ *
+ * An entry of a text logfile keeps the text of the line and extracts the level and
+ * the category once. An entry of a binary logfile keeps the structured fields and
+ * renders the text on demand, exactly like the LogHandler writes it to a text logfile.
+ */
+
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+
+namespace governikus
+{
+
+class LogEntry
+{
+	private:
+		QString mText;
+		QString mLevel;
+		QString mCategory;
+		qint64 mTimestamp;
+		quintptr mThreadId;
+		QtMsgType mType;
+		QString mOrigin;
+		QString mMessage;
+
+		[[nodiscard]] QString getPrefix() const;
+
+	public:
+		LogEntry();
+		LogEntry(qint64 pTimestamp, quintptr pThreadId, QtMsgType pType, const QString& pCategory, const QString& pOrigin, const QString& pMessage);
+		static LogEntry fromText(const QString& pText);
+
+		[[nodiscard]] bool isText() const;
+		void appendText(const QString& pText);
+
+		[[nodiscard]] const QString& getLevel() const;
+		[[nodiscard]] const QString& getCategory() const;
+		[[nodiscard]] QString getOrigin() const;
+		[[nodiscard]] QString getMessage() const;
+		[[nodiscard]] QString toString() const;
+
+		static QString getLevel(QtMsgType pType);
+};
+
+} // namespace governikus
@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogFileIndex.h"
+
+#include "LogHandler.h"
+
+#include <QDebug>
+
+
+using namespace governikus;
+
+
+namespace
+{
+template<typename T>
+quint32 intern(QStringList& pValues, const T& pValue)
+{
+	auto index = pValues.indexOf(pValue);
+	if (index < 0)
+	{
+		index = pValues.size();
+		pValues += QString(pValue);
+	}
+	return static_cast<quint32>(index);
+}
+
+
+} // namespace
+
+
+LogFileIndex::LogFileIndex()
+	: mFile()
+	, mData(nullptr)
+	, mBuffer()
+	, mSize(0)
+	, mIndexedSize(0)
+	, mTail()
+	, mEntries()
+	, mLevels()
+	, mCategories()
+{
+}
+
+
+LogFileIndex::~LogFileIndex()
+{
+	close();
+}
+
+
+bool LogFileIndex::open(const QString& pFileName)
+{
+	close();
+
+	mFile.setFileName(pFileName);
+	if (!mFile.open(QIODevice::ReadOnly))
+	{
+		qWarning() << "Cannot open logfile:" << pFileName;
+		return false;
+	}
+
+	update();
+	return true;
+}
+
+
+void LogFileIndex::close()
+{
+	unmap();
+	mFile.close();
+	mSize = 0;
+	mIndexedSize = 0;
+	mTail = Tail();
+	mEntries.clear();
+	mLevels.clear();
+	mCategories.clear();
+}
+
+
+bool LogFileIndex::isOpen() const
+{
+	return mFile.isOpen();
+}
+
+
+bool LogFileIndex::map()
+{
+	mSize = mFile.size();
+	if (mSize == 0)
+	{
+		return true;
+	}
+
+	mData = mFile.map(0, mSize);
+	if (mData == nullptr)
+	{
+		// Some files cannot be mapped, like compressed resources.
+		qDebug() << "Cannot map logfile, read it into memory:" << mFile.fileName();
+		mFile.seek(0);
+		mBuffer = mFile.readAll();
+		mSize = mBuffer.size();
+		mData = reinterpret_cast<const uchar*>(mBuffer.constData());
+	}
+
+	return mData != nullptr;
+}
+
+
+void LogFileIndex::unmap()
+{
+	if (mData != nullptr && reinterpret_cast<const char*>(mData) != mBuffer.constData())
+	{
+		mFile.unmap(const_cast<uchar*>(mData));
+	}
+
+	mData = nullptr;
+	mBuffer.clear();
+}
+
+
+QByteArrayView LogFileIndex::getData(qint64 pOffset, qint64 pLength) const
+{
+	return QByteArrayView(reinterpret_cast<const char*>(mData) + pOffset, pLength);
+}
+
+
+bool LogFileIndex::update()
+{
+	if (!isOpen())
+	{
+		return false;
+	}
+
+	const auto fileSize = mFile.size();
+	if (fileSize == mIndexedSize)
+	{
+		return false;
+	}
+
+	if (fileSize < mIndexedSize)
+	{
+		qDebug() << "Logfile was truncated, index it again:" << mFile.fileName();
+		const QString fileName = mFile.fileName();
+		close();
+		return open(fileName);
+	}
+
+	unmap();
+	if (!map())
+	{
+		qWarning() << "Cannot read logfile:" << mFile.fileName();
+		return false;
+	}
+
+	revertTail();
+
+	const auto data = getData(0, mSize);
+	auto start = mIndexedSize;
+	while (start < mSize)
+	{
+		const auto end = data.indexOf('\n', start);
+		if (end < 0)
+		{
+			// The last line may be continued by the next update.
+			const auto mergedLength = mEntries.isEmpty() ? -1 : mEntries.last().mLength;
+			mTail.mOffset = start;
+			mTail.mMergedLength = indexLine(start, mSize - start) ? -1 : mergedLength;
+			break;
+		}
+
+		indexLine(start, end - start);
+		start = end + 1;
+	}
+
+	mIndexedSize = mSize;
+	return true;
+}
+
+
+void LogFileIndex::revertTail()
+{
+	if (mTail.mOffset < 0)
+	{
+		return;
+	}
+
+	if (mTail.mMergedLength < 0)
+	{
+		mEntries.removeLast();
+	}
+	else
+	{
+		mEntries.last().mLength = mTail.mMergedLength;
+	}
+
+	mIndexedSize = mTail.mOffset;
+	mTail = Tail();
+}
+
+
+qsizetype LogFileIndex::getLevelPosition(QByteArrayView pLine)
+{
+	// Same as the header of a line that is written by LogHandler, 'd' is a digit.
+	static const QByteArrayView timestamp("dddd.dd.dd dd:dd:dd.ddd ");
+	const qsizetype categoryLength = LogHandler::MAX_CATEGORY_LENGTH;
+
+	auto position = categoryLength + 1 + timestamp.size();
+	if (pLine.size() <= position)
+	{
+		return -1;
+	}
+
+	for (qsizetype i = 0; i < categoryLength; ++i)
+	{
+		const char c = pLine.at(i);
+		if (!((c >= 'a' && c <= 'z') || c == '.' || c == '_' || c == ' '))
+		{
+			return -1;
+		}
+	}
+
+	if (pLine.at(categoryLength) != ' ')
+	{
+		return -1;
+	}
+
+	for (qsizetype i = 0; i < timestamp.size(); ++i)
+	{
+		const char expected = timestamp.at(i);
+		const char c = pLine.at(categoryLength + 1 + i);
+		if (expected == 'd' ? !(c >= '0' && c <= '9') : c != expected)
+		{
+			return -1;
+		}
+	}
+
+	const auto threadPosition = position;
+	while (position < pLine.size() && pLine.at(position) >= '0' && pLine.at(position) <= '9')
+	{
+		++position;
+	}
+
+	if (position - threadPosition < 3 || position >= pLine.size() || pLine.at(position) != ' ')
+	{
+		return -1;
+	}
+
+	return position + 1;
+}
+
+
+bool LogFileIndex::indexLine(qint64 pOffset, qint64 pLength)
+{
+	if (pLength > 0 && mData[pOffset + pLength - 1] == '\r')
+	{
+		--pLength;
+	}
+
+	const auto line = getData(pOffset, pLength);
+	const auto levelPosition = getLevelPosition(line);
+	if (levelPosition < 0 && !mEntries.isEmpty())
+	{
+		auto& entry = mEntries.last();
+		entry.mLength = pOffset + pLength - entry.mOffset;
+		return false;
+	}
+
+	Entry entry {pOffset, pLength, 0, 0};
+	if (levelPosition < 0)
+	{
+		const auto& logEntry = LogEntry::fromText(QString::fromUtf8(line));
+		entry.mLevel = intern(mLevels, logEntry.getLevel());
+		entry.mCategory = intern(mCategories, logEntry.getCategory());
+	}
+	else
+	{
+		const bool hasLevel = levelPosition + 1 < line.size()
+				&& line.at(levelPosition) >= 'A' && line.at(levelPosition) <= 'Z'
+				&& line.at(levelPosition + 1) == ' ';
+		const auto level = hasLevel ? line.sliced(levelPosition, 1) : QByteArrayView("D");
+		const auto category = line.first(line.indexOf(' '));
+		entry.mLevel = intern(mLevels, QLatin1String(level.data(), level.size()));
+		entry.mCategory = intern(mCategories, QLatin1String(category.data(), category.size()));
+	}
+
+	mEntries += entry;
+	return true;
+}
+
+
+qsizetype LogFileIndex::size() const
+{
+	return mEntries.size();
+}
+
+
+LogEntry LogFileIndex::at(qsizetype pIndex) const
+{
+	const auto& entry = mEntries.at(pIndex);
+	auto text = QString::fromUtf8(getData(entry.mOffset, entry.mLength));
+	if (text.contains(QLatin1Char('\r')))
+	{
+		text.replace(QLatin1String("\r\n"), QLatin1String("\n"));
+	}
+
+	return LogEntry::fromText(text);
+}
+
+
+const QString& LogFileIndex::getLevel(qsizetype pIndex) const
+{
+	return mLevels.at(mEntries.at(pIndex).mLevel);
+}
+
+
+const QString& LogFileIndex::getCategory(qsizetype pIndex) const
+{
+	return mCategories.at(mEntries.at(pIndex).mCategory);
+}
+
+
+const QStringList& LogFileIndex::getLevels() const
+{
+	return mLevels;
+}
+
+
+const QStringList& LogFileIndex::getCategories() const
+{
+	return mCategories;
+}
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Index of the entries of a text logfile.
+ *
+ * The file is memory-mapped and only the offset, the length, the level and the
+ * category of every entry are kept. An entry is rendered by \ref LogEntry when
+ * it is requested, so a large logfile does not need to be loaded into memory.
+ * Data appended to the file is indexed by update().
+ */
+
+#pragma once
+
+#include "LogEntry.h"
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFile>
+#include <QList>
+#include <QStringList>
+
+
+class test_LogFileIndex;
+
+
+namespace governikus
+{
+
+class LogFileIndex
+{
+	Q_DISABLE_COPY(LogFileIndex)
+	friend class ::test_LogFileIndex;
+
+	private:
+		struct Entry
+		{
+			qint64 mOffset;
+			qint64 mLength;
+			quint32 mLevel;
+			quint32 mCategory;
+		};
+
+		struct Tail
+		{
+			qint64 mOffset = -1;
+			qint64 mMergedLength = -1;
+		};
+
+		QFile mFile;
+		const uchar* mData;
+		QByteArray mBuffer;
+		qint64 mSize;
+		qint64 mIndexedSize;
+		Tail mTail;
+		QList<Entry> mEntries;
+		QStringList mLevels;
+		QStringList mCategories;
+
+		bool map();
+		void unmap();
+		void revertTail();
+		bool indexLine(qint64 pOffset, qint64 pLength);
+
+		[[nodiscard]] static qsizetype getLevelPosition(QByteArrayView pLine);
+		[[nodiscard]] QByteArrayView getData(qint64 pOffset, qint64 pLength) const;
+
+	public:
+		LogFileIndex();
+		~LogFileIndex();
+
+		bool open(const QString& pFileName);
+		void close();
+		[[nodiscard]] bool isOpen() const;
+
+		/*!
+		 * \brief Indexes the data that was appended since the last call.
+		 * \return true if the entries have changed.
+		 */
+		bool update();
+
+		[[nodiscard]] qsizetype size() const;
+		[[nodiscard]] LogEntry at(qsizetype pIndex) const;
+		[[nodiscard]] const QString& getLevel(qsizetype pIndex) const;
+		[[nodiscard]] const QString& getCategory(qsizetype pIndex) const;
+		[[nodiscard]] const QStringList& getLevels() const;
+		[[nodiscard]] const QStringList& getCategories() const;
+};
+
+} // namespace governikus
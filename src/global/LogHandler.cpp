@@ -8,13 +8,23 @@
 
 #include <QCoreApplication>
 #include <QDir>
+#include <QMetaMethod>
 #include <QScopeGuard>
 #include <QStringBuilder>
 
+#include <algorithm>
+
 #ifdef Q_OS_ANDROID
 	#include <QJniObject>
 #endif
 
+#if defined(Q_OS_LINUX)
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elif defined(Q_OS_DARWIN)
+	#include <pthread.h>
+#endif
+
 using namespace governikus;
 
 defineSingleton(LogHandler)
@@ -31,10 +41,30 @@ Q_DECLARE_LOGGING_CATEGORY(configuration)
 #endif
 
 
+namespace
+{
+quintptr getThreadId()
+{
+	// Use the same id as %{threadid} of the message pattern, see qt_gettid() of qlogging.cpp.
+#if defined(Q_OS_LINUX)
+	return static_cast<quintptr>(syscall(SYS_gettid));
+#elif defined(Q_OS_DARWIN)
+	quint64 threadId = 0;
+	pthread_threadid_np(nullptr, &threadId);
+	return static_cast<quintptr>(threadId);
+#else
+	return reinterpret_cast<quintptr>(QThread::currentThreadId());
+#endif
+}
+
+
+} // namespace
+
+
 LogHandler::LogHandler()
 	: mEventHandler()
 	, mEnvPattern(!qEnvironmentVariableIsEmpty("QT_MESSAGE_PATTERN"))
-	, mFunctionFilenameSize(74)
+	, mFunctionFilenameSize(FUNCTION_FILENAME_SIZE)
 	, mBacklogPosition(0)
 	, mCriticalLog(false)
 	, mCriticalLogWindow(10)
@@ -48,6 +78,16 @@ LogHandler::LogHandler()
 	, mUseLogFile(true)
 	, mFilePrefix("/src/")
 	, mMutex()
+	, mUseBinaryLog(false)
+	, mBinaryLog()
+	, mQueue()
+	, mWriter()
+	, mAsync(0)
+	, mProducers(0)
+	, mEnqueuedRecords(0)
+	, mWrittenRecords(0)
+	, mWriterSignal()
+	, mWrittenCondition()
 {
 }
 
@@ -67,6 +107,8 @@ QString LogHandler::getLogFileTemplate()
 
 void LogHandler::reset()
 {
+	setAsync(false);
+
 	const QMutexLocker mutexLocker(&mMutex);
 	if (isInstalled())
 	{
@@ -98,12 +140,7 @@ void LogHandler::init()
 
 	if (mLogFile.isNull())
 	{
-		mLogFile = new QTemporaryFile(getLogFileTemplate());
-		QObject::connect(QCoreApplication::instance(), &QCoreApplication::destroyed, mLogFile.data(), [this] {
-				delete this->mLogFile.data();
-			});
-
-		setAutoRemove(mAutoRemove);
+		createLogFile();
 		setLogFileInternal(mUseLogFile);
 
 		// Avoid deadlock with subsequent logging of this call.
@@ -128,6 +165,18 @@ const LogEventHandler* LogHandler::getEventHandler() const
 }
 
 
+void LogHandler::createLogFile()
+{
+	mLogFile = new QTemporaryFile(getLogFileTemplate());
+	QObject::connect(QCoreApplication::instance(), &QCoreApplication::destroyed, mLogFile.data(), [this] {
+			setAsync(false);
+			delete this->mLogFile.data();
+		});
+
+	setAutoRemove(mAutoRemove);
+}
+
+
 bool LogHandler::isInstalled() const
 {
 	return mHandler;
@@ -144,12 +193,15 @@ void LogHandler::setAutoRemove(bool pRemove)
 }
 
 
-void LogHandler::logToFile(const QString& pOutput)
+void LogHandler::logToFile(const QByteArray& pOutput, bool pFlush)
 {
 	if (mLogFile && mLogFile->isOpen() && mLogFile->isWritable())
 	{
-		mLogFile->write(pOutput.toUtf8());
-		mLogFile->flush();
+		mLogFile->write(pOutput);
+		if (pFlush)
+		{
+			mLogFile->flush();
+		}
 	}
 }
 
@@ -163,6 +215,11 @@ QByteArray LogHandler::readLogFile(qint64 pStart, qint64 pLength)
 				mLogFile->seek(currentPos);
 			});
 
+		if (mUseBinaryLog)
+		{
+			return BinaryLog::toText(readBinaryLogFile(pStart, pLength));
+		}
+
 		mLogFile->seek(pStart);
 		return pLength > 0 ? mLogFile->read(pLength) : mLogFile->readAll();
 	}
@@ -177,16 +234,45 @@ QByteArray LogHandler::readLogFile(qint64 pStart, qint64 pLength)
 }
 
 
+QList<LogEntry> LogHandler::readBinaryLogFile(qint64 pStart, qint64 pLength)
+{
+	// The definitions are known by mBinaryLog, so only the requested records are read.
+	mLogFile->seek(std::max(pStart, static_cast<qint64>(BinaryLog::getHeader().size())));
+	return mBinaryLog.readEncoded(pLength > 0 ? mLogFile->read(pLength) : mLogFile->readAll());
+}
+
+
 QByteArray LogHandler::getBacklog(bool pAll)
 {
 	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
 	return readLogFile(pAll ? 0 : mBacklogPosition);
 }
 
 
+QList<LogEntry> LogHandler::getBacklogEntries()
+{
+	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
+
+	if (!mUseBinaryLog || !mLogFile || !mLogFile->isOpen() || !mLogFile->isReadable())
+	{
+		return QList<LogEntry>();
+	}
+
+	const auto currentPos = mLogFile->pos();
+	const auto resetPosition = qScopeGuard([this, currentPos] {
+			mLogFile->seek(currentPos);
+		});
+
+	return readBinaryLogFile(mBacklogPosition);
+}
+
+
 QByteArray LogHandler::getCriticalLogWindow()
 {
 	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
 
 	if (mCriticalLog)
 	{
@@ -201,6 +287,8 @@ QByteArray LogHandler::getCriticalLogWindow()
 
 bool LogHandler::hasCriticalLog() const
 {
+	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
 	return mCriticalLog;
 }
 
@@ -243,6 +331,7 @@ QDateTime LogHandler::getCurrentLogFileDate() const
 void LogHandler::resetBacklog()
 {
 	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
 
 	if (useLogFile())
 	{
@@ -362,7 +451,14 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 	}
 #endif
 
-	const QMutexLocker mutexLocker(&mMutex);
+	mProducers.ref();
+	const auto producerGuard = qScopeGuard([this] {
+			mProducers.deref();
+		});
+
+	// The asynchronous mode leaves the logfile, the log window and the signals to the writer thread.
+	const bool async = isAsync();
+	const QMutexLocker mutexLocker(async ? nullptr : &mMutex);
 
 	const QByteArray& filename = formatFilename(pContext.file);
 	const QByteArray& function = formatFunction(pContext.function, filename, pContext.line);
@@ -373,7 +469,10 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 
 	const QString& message = mEnvPattern ? pMsg : getPaddedLogMsg(ctx, pMsg);
 
-	qSetMessagePattern(mMessagePattern);
+	if (!async)
+	{
+		qSetMessagePattern(mMessagePattern);
+	}
 
 #ifdef Q_OS_WIN
 	const QLatin1String lineBreak("\r\n");
@@ -381,9 +480,20 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 	const QLatin1Char lineBreak('\n');
 #endif
 
-	const QString logMsg = qFormatLogMessage(pType, ctx, message) + lineBreak;
-	handleLogWindow(pType, pContext.category, logMsg);
-	logToFile(logMsg);
+	LogRecord record {
+		pType,
+		QString::fromLatin1(pContext.category),
+		pMsg,
+		isTextLogRequired() ? qFormatLogMessage(pType, ctx, message) + lineBreak : QString(),
+		QDateTime::currentMSecsSinceEpoch(),
+		getThreadId(),
+		function + '(' + filename + ':' + QByteArray::number(pContext.line) + ')'
+	};
+
+	if (!async)
+	{
+		writeRecord(record, true);
+	}
 
 	if (Q_LIKELY(mUseHandler))
 	{
@@ -395,15 +505,236 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 #endif
 	}
 
-	if (mEventHandler)
+	if (async)
+	{
+		enqueueRecord(std::move(record));
+	}
+	else
+	{
+		emitRecord(record);
+	}
+}
+
+
+bool LogHandler::isTextLogRequired() const
+{
+	// The console handler formats the message on its own.
+	if (mUseLogFile && !mUseBinaryLog)
+	{
+		return true;
+	}
+
+	return mEventHandler && mEventHandler->isSignalConnected(QMetaMethod::fromSignal(&LogEventHandler::fireLog));
+}
+
+
+void LogHandler::writeRecord(const LogRecord& pRecord, bool pFlush)
+{
+	if (!mUseBinaryLog)
+	{
+		handleLogWindow(pRecord.mType, pRecord.mCategory, pRecord.mLogMessage.size());
+		logToFile(pRecord.mLogMessage.toUtf8(), pFlush);
+		return;
+	}
+
+	// The definitions of BinaryLog must not be encoded if they cannot be written.
+	if (!mLogFile || !mLogFile->isOpen() || !mLogFile->isWritable())
+	{
+		return;
+	}
+
+	const auto& data = mBinaryLog.encode(pRecord.mTimestamp,
+			pRecord.mThreadId,
+			pRecord.mType,
+			formatCategory(pRecord.mCategory.toLatin1()).trimmed(),
+			pRecord.mOrigin,
+			pRecord.mMessage);
+	handleLogWindow(pRecord.mType, pRecord.mCategory, data.size());
+	logToFile(data, pFlush);
+}
+
+
+void LogHandler::emitRecord(const LogRecord& pRecord) const
+{
+	if (!mEventHandler)
+	{
+		return;
+	}
+
+	Q_EMIT mEventHandler->fireRawLog(pRecord.mMessage, pRecord.mCategory);
+
+	if (!pRecord.mLogMessage.isEmpty())
+	{
+		Q_EMIT mEventHandler->fireLog(pRecord.mLogMessage);
+	}
+
+	if (mEventHandler->isSignalConnected(QMetaMethod::fromSignal(&LogEventHandler::fireLogEntry)))
+	{
+		Q_EMIT mEventHandler->fireLogEntry(LogEntry(pRecord.mTimestamp,
+				pRecord.mThreadId,
+				pRecord.mType,
+				QString::fromLatin1(formatCategory(pRecord.mCategory.toLatin1()).trimmed()),
+				QString::fromLatin1(pRecord.mOrigin),
+				pRecord.mMessage));
+	}
+}
+
+
+void LogHandler::enqueueRecord(LogRecord&& pRecord)
+{
+	while (!mQueue->push(std::move(pRecord)))
+	{
+		// The queue is full, let the writer catch up instead of losing the message.
+		mWriterSignal.release();
+		QThread::yieldCurrentThread();
+	}
+
+	mEnqueuedRecords.fetchAndAddRelease(1);
+	mWriterSignal.release();
+}
+
+
+void LogHandler::writeRecords()
+{
+	const QMutexLocker mutexLocker(&mMutex);
+
+	quint64 written = 0;
+	LogRecord record;
+	while (mQueue->pop(record))
+	{
+		writeRecord(record, false);
+		emitRecord(record);
+		++written;
+	}
+
+	if (written > 0)
+	{
+		if (mLogFile && mLogFile->isOpen())
+		{
+			mLogFile->flush();
+		}
+		mWrittenRecords += written;
+	}
+	mWrittenCondition.wakeAll();
+}
+
+
+void LogHandler::runWriter()
+{
+	for (;;)
+	{
+		// Wake up at least periodically to write the records of producers that gave no signal yet.
+		if (mWriterSignal.tryAcquire(1, ASYNC_FLUSH_INTERVAL))
+		{
+			mWriterSignal.tryAcquire(mWriterSignal.available());
+		}
+
+		// No producer can enqueue a record once the mode is switched off and all producers have left.
+		const bool stop = !mAsync.loadAcquire() && mProducers.loadAcquire() == 0;
+		writeRecords();
+		if (stop)
+		{
+			return;
+		}
+	}
+}
+
+
+void LogHandler::waitForWriter() const
+{
+	// Called with locked mutex. The writer releases the mutex while it waits for the next batch.
+	if (!mWriter || QThread::currentThread() == mWriter.data())
+	{
+		return;
+	}
+
+	const auto enqueued = mEnqueuedRecords.loadAcquire();
+	while (mWrittenRecords < enqueued && mWriter->isRunning())
+	{
+		mWriterSignal.release();
+		mWrittenCondition.wait(&mMutex, ASYNC_FLUSH_INTERVAL);
+	}
+}
+
+
+void LogHandler::setAsync(bool pEnable)
+{
+#ifdef ENABLE_MESSAGE_PATTERN
+	if (pEnable == isAsync())
+	{
+		return;
+	}
+
+	if (pEnable)
+	{
+		if (!mQueue)
+		{
+			mQueue.reset(new MpscRingBuffer<LogRecord>(ASYNC_QUEUE_SIZE));
+		}
+
+		// The pattern is set once as producers of the asynchronous mode do not hold the mutex.
+		qSetMessagePattern(mMessagePattern);
+		mWriter.reset(QThread::create([this] {
+				runWriter();
+			}));
+		mWriter->setObjectName(QStringLiteral("LogWriter"));
+		mAsync.storeRelease(1);
+		mWriter->start();
+		return;
+	}
+
+	mAsync.storeRelease(0);
+	mWriterSignal.release();
+	mWriter->wait();
+	mWriter.reset();
+#else
+	Q_UNUSED(pEnable)
+#endif
+}
+
+
+void LogHandler::setBinaryLog(bool pEnable)
+{
+	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
+
+	if (mUseBinaryLog == pEnable)
+	{
+		return;
+	}
+
+	// Avoid a logfile with mixed formats. The messages written so far are kept
+	// as an older logfile that is removed together with the new one.
+	if (mLogFile && mLogFile->isOpen())
 	{
-		Q_EMIT mEventHandler->fireRawLog(pMsg, QString::fromLatin1(pContext.category));
-		Q_EMIT mEventHandler->fireLog(logMsg);
+		QTemporaryFile* previous = mLogFile.data();
+		previous->close();
+		QObject::disconnect(QCoreApplication::instance(), nullptr, previous, nullptr);
+		createLogFile();
+		previous->setParent(mLogFile.data());
+
+		mBacklogPosition = 0;
+		mCriticalLog = false;
+		mCriticalLogWindow.clear();
 	}
+	mUseBinaryLog = pEnable;
+	setLogFileInternal(mUseLogFile);
 }
 
 
-void LogHandler::handleLogWindow(QtMsgType pType, const char* pCategory, const QString& pMsg)
+bool LogHandler::isBinaryLog() const
+{
+	return mUseBinaryLog;
+}
+
+
+bool LogHandler::isAsync() const
+{
+	return mAsync.loadAcquire() != 0;
+}
+
+
+void LogHandler::handleLogWindow(QtMsgType pType, const QString& pCategory, qint64 pLength)
 {
 	if (!useLogFile())
 	{
@@ -414,18 +745,19 @@ void LogHandler::handleLogWindow(QtMsgType pType, const char* pCategory, const Q
 	{
 		return;
 	}
-	else if (pType == QtCriticalMsg && !mCriticalLogIgnore.contains(QLatin1String(pCategory)))
+	else if (pType == QtCriticalMsg && !mCriticalLogIgnore.contains(pCategory))
 	{
 		mCriticalLog = true;
 	}
 
-	mCriticalLogWindow.append({mLogFile->pos(), pMsg.size()});
+	mCriticalLogWindow.append({mLogFile->pos(), pLength});
 }
 
 
 bool LogHandler::copy(const QString& pDest) const
 {
 	const QMutexLocker mutexLocker(&mMutex);
+	waitForWriter();
 
 	if (useLogFile())
 	{
@@ -453,6 +785,12 @@ bool LogHandler::copyOther(const QString& pSource, const QString& pDest) const
 		return false;
 	}
 
+	if (QFile source(pSource); source.open(QIODevice::ReadOnly) && BinaryLog::isBinary(source.peek(BinaryLog::getHeader().size())))
+	{
+		QFile destination(pDest);
+		return destination.open(QIODevice::WriteOnly) && destination.write(BinaryLog::toText(source.readAll())) >= 0;
+	}
+
 	return QFile::copy(pSource, pDest);
 }
 
@@ -525,6 +863,11 @@ void LogHandler::setLogFileInternal(bool pEnable)
 		{
 			mLogFile->setFileTemplate(getLogFileTemplate());
 			mLogFile->open();
+			if (mUseBinaryLog && mLogFile->isOpen())
+			{
+				mBinaryLog.reset();
+				logToFile(BinaryLog::getHeader());
+			}
 		}
 	}
 	else
@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include "BinaryLog.h"
 #include "Env.h"
+#include "LogEntry.h"
+#include "MpscRingBuffer.h"
 
+#include <QAtomicInt>
 #include <QContiguousCache>
 #include <QDateTime>
 #include <QDebug>
@@ -18,8 +22,12 @@
 #include <QMessageLogContext>
 #include <QMutex>
 #include <QPointer>
+#include <QScopedPointer>
+#include <QSemaphore>
 #include <QStringList>
 #include <QTemporaryFile>
+#include <QThread>
+#include <QWaitCondition>
 #include <functional>
 
 #define spawnMessageLogger(category)\
@@ -60,9 +68,11 @@ class LogEventHandler
 		/**
 		 * \brief Every log will be fired by this signal. Be aware that you NEVER use a qDebug()
 		 * or something like that function in your slot or you will get a deadlock!
+		 * If the LogHandler is asynchronous the signals are emitted by its writer thread.
 		 */
 		void fireLog(const QString& pMsg);
 		void fireRawLog(const QString& pMsg, const QString& pCategoryName);
+		void fireLogEntry(const LogEntry& pEntry);
 };
 
 class LogHandler
@@ -81,6 +91,20 @@ class LogHandler
 			qint64 mLength;
 		};
 
+		struct LogRecord
+		{
+			QtMsgType mType = QtDebugMsg;
+			QString mCategory;
+			QString mMessage;
+			QString mLogMessage;
+			qint64 mTimestamp = 0;
+			quintptr mThreadId = 0;
+			QByteArray mOrigin;
+		};
+
+		static constexpr quintptr ASYNC_QUEUE_SIZE = 4096;
+		static constexpr int ASYNC_FLUSH_INTERVAL = 100;
+
 		static QString getLogFileTemplate();
 
 		QPointer<LogEventHandler> mEventHandler;
@@ -99,22 +123,42 @@ class LogHandler
 		bool mUseLogFile;
 		const QByteArray mFilePrefix;
 		mutable QMutex mMutex;
+		bool mUseBinaryLog;
+		BinaryLog mBinaryLog;
+
+		QScopedPointer<MpscRingBuffer<LogRecord>> mQueue;
+		QScopedPointer<QThread> mWriter;
+		QAtomicInt mAsync;
+		QAtomicInt mProducers;
+		QAtomicInteger<quint64> mEnqueuedRecords;
+		quint64 mWrittenRecords;
+		mutable QSemaphore mWriterSignal;
+		mutable QWaitCondition mWrittenCondition;
 
 		inline void copyMessageLogContext(const QMessageLogContext& pSource,
 				QMessageLogContext& pDestination,
 				const QByteArray& pFilename = QByteArray(),
 				const QByteArray& pFunction = QByteArray(),
 				const QByteArray& pCategory = QByteArray()) const;
-		inline void logToFile(const QString& pOutput);
+		inline void logToFile(const QByteArray& pOutput, bool pFlush = true);
 		[[nodiscard]] QByteArray formatFunction(const char* const pFunction, const QByteArray& pFilename, int pLine) const;
 		[[nodiscard]] QByteArray formatFilename(const char* const pFilename) const;
 		[[nodiscard]] QByteArray formatCategory(const QByteArray& pCategory) const;
 
 		[[nodiscard]] QString getPaddedLogMsg(const QMessageLogContext& pContext, const QString& pMsg) const;
 		void handleMessage(QtMsgType pType, const QMessageLogContext& pContext, const QString& pMsg);
-		void handleLogWindow(QtMsgType pType, const char* pCategory, const QString& pMsg);
+		void handleLogWindow(QtMsgType pType, const QString& pCategory, qint64 pLength);
+		[[nodiscard]] bool isTextLogRequired() const;
+		void writeRecord(const LogRecord& pRecord, bool pFlush);
+		void emitRecord(const LogRecord& pRecord) const;
+		void enqueueRecord(LogRecord&& pRecord);
+		void writeRecords();
+		void runWriter();
+		void waitForWriter() const;
 		void removeOldLogFiles();
 		QByteArray readLogFile(qint64 pStart, qint64 pLength = -1);
+		QList<LogEntry> readBinaryLogFile(qint64 pStart, qint64 pLength = -1);
+		void createLogFile();
 		void setLogFileInternal(bool pEnable);
 
 		static void messageHandler(QtMsgType pType, const QMessageLogContext& pContext, const QString& pMsg);
@@ -133,6 +177,7 @@ class LogHandler
 
 	public:
 		static constexpr int MAX_CATEGORY_LENGTH = 13;
+		static constexpr int FUNCTION_FILENAME_SIZE = 74;
 
 		void init();
 		[[nodiscard]] const LogEventHandler* getEventHandler() const;
@@ -142,6 +187,7 @@ class LogHandler
 		[[nodiscard]] bool copyOther(const QString& pSource, const QString& pDest) const;
 		void resetBacklog();
 		QByteArray getBacklog(bool pAll = false);
+		[[nodiscard]] QList<LogEntry> getBacklogEntries();
 		QByteArray getCriticalLogWindow();
 		[[nodiscard]] bool hasCriticalLog() const;
 		[[nodiscard]] qsizetype getCriticalLogCapacity() const;
@@ -155,6 +201,24 @@ class LogHandler
 		[[nodiscard]] bool useLogFile() const;
 		void setUseHandler(bool pEnable);
 		[[nodiscard]] bool useHandler() const;
+
+		/*!
+		 * \brief Enables the asynchronous mode that hands over formatted messages
+		 * to a writer thread by a lock-free queue. The writer thread writes them in
+		 * batches to the logfile, maintains the critical log window and emits the
+		 * signals of the LogEventHandler. Only supported if the message pattern is
+		 * enabled, i.e. not on mobile platforms or with journald.
+		 */
+		void setAsync(bool pEnable);
+		[[nodiscard]] bool isAsync() const;
+
+		/*!
+		 * \brief Writes the logfile in the compact format of \ref BinaryLog. The backlog,
+		 * the critical log window and copies of the logfile are rendered as text on demand.
+		 * A change of the format starts a new logfile.
+		 */
+		void setBinaryLog(bool pEnable);
+		[[nodiscard]] bool isBinaryLog() const;
 };
 
 inline QDebug operator<<(QDebug pDbg, const governikus::LogHandler& pHandler)
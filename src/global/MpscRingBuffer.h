@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Bounded lock-free queue for multiple producers and a single consumer.
+ *
+ * Every cell of the ring carries a sequence number that tells the producers and
+ * the consumer whether the cell is free or filled for the current round. The
+ * producers reserve a cell by an atomic increment of the enqueue position, the
+ * consumer is the only one that moves the dequeue position.
+ */
+
+#pragma once
+
+#include <QAtomicInteger>
+#include <QtGlobal>
+
+#include <memory>
+#include <utility>
+
+
+namespace governikus
+{
+
+template<typename T>
+class MpscRingBuffer
+{
+	Q_DISABLE_COPY(MpscRingBuffer)
+
+	private:
+		struct Cell
+		{
+			QAtomicInteger<quintptr> mSequence;
+			T mData;
+		};
+
+		const quintptr mMask;
+		const std::unique_ptr<Cell[]> mCells;
+		alignas(64) QAtomicInteger<quintptr> mEnqueuePosition;
+		alignas(64) quintptr mDequeuePosition;
+
+		static quintptr getCapacity(quintptr pMinimum)
+		{
+			quintptr capacity = 2;
+			while (capacity < pMinimum)
+			{
+				capacity <<= 1;
+			}
+			return capacity;
+		}
+
+	public:
+		explicit MpscRingBuffer(quintptr pCapacity)
+			: mMask(getCapacity(pCapacity) - 1)
+			, mCells(new Cell[mMask + 1])
+			, mEnqueuePosition(0)
+			, mDequeuePosition(0)
+		{
+			for (quintptr i = 0; i <= mMask; ++i)
+			{
+				mCells[i].mSequence.storeRelaxed(i);
+			}
+		}
+
+
+		[[nodiscard]] quintptr capacity() const
+		{
+			return mMask + 1;
+		}
+
+
+		/*!
+		 * \brief Can be called by any thread. Returns false if the queue is full.
+		 */
+		bool push(T&& pData)
+		{
+			quintptr position = mEnqueuePosition.loadRelaxed();
+			for (;;)
+			{
+				Cell& cell = mCells[position & mMask];
+				const auto difference = static_cast<qintptr>(cell.mSequence.loadAcquire() - position);
+				if (difference == 0)
+				{
+					if (mEnqueuePosition.testAndSetRelaxed(position, position + 1, position))
+					{
+						cell.mData = std::move(pData);
+						cell.mSequence.storeRelease(position + 1);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = mEnqueuePosition.loadRelaxed();
+				}
+			}
+		}
+
+
+		/*!
+		 * \brief Must only be called by the consumer thread. Returns false if the queue is empty.
+		 */
+		bool pop(T& pData)
+		{
+			Cell& cell = mCells[mDequeuePosition & mMask];
+			if (static_cast<qintptr>(cell.mSequence.loadAcquire() - (mDequeuePosition + 1)) < 0)
+			{
+				return false;
+			}
+
+			pData = std::move(cell.mData);
+			cell.mData = T();
+			cell.mSequence.storeRelease(mDequeuePosition + mMask + 1);
+			++mDequeuePosition;
+			return true;
+		}
+
+
+};
+
+} // namespace governikus
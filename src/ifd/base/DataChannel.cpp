@@ -9,3 +9,9 @@ using namespace governikus;
 
 
 DataChannel::~DataChannel() = default;
+
+
+void DataChannel::sendBinary(const QByteArray& pDataBlock)
+{
+	send(pDataBlock);
+}
@@ -26,6 +26,7 @@ class DataChannel
 		~DataChannel() override;
 
 		Q_INVOKABLE virtual void send(const QByteArray& pDataBlock) = 0;
+		Q_INVOKABLE virtual void sendBinary(const QByteArray& pDataBlock);
 		Q_INVOKABLE virtual void close() = 0;
 		[[nodiscard]] virtual bool isPairingConnection() const = 0;
 		[[nodiscard]] virtual const QString& getId() const = 0;
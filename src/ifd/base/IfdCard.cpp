@@ -63,7 +63,7 @@ bool IfdCard::sendMessage(const QSharedPointer<const IfdMessage>& pMessage, IfdM
 }
 
 
-void IfdCard::onMessageReceived(IfdMessageType pMessageTpe, const QJsonObject& pJsonObject)
+void IfdCard::onMessageReceived(IfdMessageType pMessageTpe, const QCborMap& pMessageObject)
 {
 	QMutexLocker locker(&mProcessResponse);
 
@@ -74,7 +74,7 @@ void IfdCard::onMessageReceived(IfdMessageType pMessageTpe, const QJsonObject& p
 
 	if (pMessageTpe == mExpectedAnswerType || pMessageTpe == IfdMessageType::IFDError)
 	{
-		mResponse = pJsonObject;
+		mResponse = pMessageObject;
 		mWaitingForAnswer = false;
 		mWaitCondition.wakeOne();
 		return;
@@ -93,7 +93,7 @@ void IfdCard::onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString& p
 	{
 		qCWarning(card_remote) << "IfdDispatcher was closed while waiting for an answer:" << pCloseCode;
 
-		mResponse = QJsonObject();
+		mResponse = QCborMap();
 		mWaitingForAnswer = false;
 		mWaitCondition.wakeOne();
 	}
@@ -222,6 +222,56 @@ ResponseApduResult IfdCard::transmit(const CommandApdu& pCommand)
 }
 
 
+bool IfdCard::isBatchTransmitSupported() const
+{
+	return mDispatcher->getVersion() >= IfdVersion::Version::v3;
+}
+
+
+QList<ResponseApduResult> IfdCard::transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos)
+{
+	if (pInputApduInfos.size() < 2 || !isBatchTransmitSupported())
+	{
+		return Card::transmitBatch(pInputApduInfos);
+	}
+
+	qCDebug(card_remote) << "Transmit batch of" << pInputApduInfos.size() << "command APDUs";
+
+	const QSharedPointer<const IfdTransmit>& transmitCmd = QSharedPointer<IfdTransmit>::create(mSlotHandle, pInputApduInfos, mProgressMessage);
+	if (!sendMessage(transmitCmd, IfdMessageType::IFDTransmitResponse, 5000 * static_cast<unsigned long>(pInputApduInfos.size())))
+	{
+		return {ResponseApduResult{CardReturnCode::INPUT_TIME_OUT}};
+	}
+
+	mProgressMessage.clear();
+	const IfdTransmitResponse response(mResponse);
+	if (response.isIncomplete())
+	{
+		return {ResponseApduResult{CardReturnCode::COMMAND_FAILED}};
+	}
+
+	QList<ResponseApduResult> results;
+	const auto& outputApdus = response.getOutputApdus();
+	for (qsizetype i = 0; i < outputApdus.size() && i < pInputApduInfos.size(); ++i)
+	{
+		results += ResponseApduResult{CardReturnCode::OK, ResponseApdu(outputApdus.at(i))};
+		if (!pInputApduInfos.at(i).isContinuable(results.constLast()))
+		{
+			break;
+		}
+	}
+	qCDebug(card_remote) << "Received" << results.size() << "response APDUs";
+
+	if (response.resultHasError() && results.size() < pInputApduInfos.size())
+	{
+		qCWarning(card_remote) << response.getResultMinor();
+		results += ResponseApduResult{CardReturnCode::COMMAND_FAILED};
+	}
+
+	return results;
+}
+
+
 EstablishPaceChannelOutput IfdCard::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription)
 {
 	EstablishPaceChannel establishPaceChannel(pPasswordId, pChat, pCertificateDescription);
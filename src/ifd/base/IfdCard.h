@@ -33,7 +33,7 @@ class IfdCard
 		QMutex mProcessResponse;
 
 		IfdMessageType mExpectedAnswerType;
-		QJsonObject mResponse;
+		QCborMap mResponse;
 		const QSharedPointer<IfdDispatcherClient> mDispatcher;
 		QString mReaderName;
 		QString mSlotHandle;
@@ -43,7 +43,7 @@ class IfdCard
 		bool sendMessage(const QSharedPointer<const IfdMessage>& pMessage, IfdMessageType pExpectedAnswer, unsigned long pTimeout);
 
 	private Q_SLOTS:
-		void onMessageReceived(IfdMessageType pMessageTpe, const QJsonObject& pJsonObject);
+		void onMessageReceived(IfdMessageType pMessageTpe, const QCborMap& pMessageObject);
 		void onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 
 	Q_SIGNALS:
@@ -60,6 +60,8 @@ class IfdCard
 		void setErrorMessage(const QString& pMessage) override;
 
 		ResponseApduResult transmit(const CommandApdu& pCmd) override;
+		bool isBatchTransmitSupported() const override;
+		QList<ResponseApduResult> transmitBatch(const QList<InputAPDUInfo>& pInputApduInfos) override;
 
 		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription) override;
 
@@ -143,7 +143,14 @@ void IfdDispatcher::send(const QSharedPointer<const IfdMessage>& pMessage)
 			|| messageType == IfdMessageType::IFDEstablishContext
 			|| messageType == IfdMessageType::IFDEstablishContextResponse);
 
-	mDataChannel->send(pMessage->toByteArray(mVersion, mContextHandle));
+	const auto& data = pMessage->toByteArray(mVersion, mContextHandle);
+	if (IfdMessage::isBinary(data))
+	{
+		mDataChannel->sendBinary(data);
+		return;
+	}
+
+	mDataChannel->send(data);
 }
 
 
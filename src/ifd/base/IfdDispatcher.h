@@ -32,7 +32,7 @@ class IfdDispatcher
 		IfdVersion::Version mVersion;
 		QString mContextHandle;
 
-		virtual bool processContext(IfdMessageType pMsgType, const QJsonObject& pMsgObject) = 0;
+		virtual bool processContext(IfdMessageType pMsgType, const QCborMap& pMsgObject) = 0;
 
 	private Q_SLOTS:
 		void onReceived(const QByteArray& pDataBlock);
@@ -56,7 +56,7 @@ class IfdDispatcher
 		Q_INVOKABLE virtual void send(const QSharedPointer<const IfdMessage>& pMessage);
 
 	Q_SIGNALS:
-		void fireReceived(IfdMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void fireReceived(IfdMessageType pMessageType, const QCborMap& pMessageObject, const QString& pId);
 		void fireClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 };
 
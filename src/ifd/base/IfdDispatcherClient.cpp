@@ -40,7 +40,7 @@ IfdDispatcherClient::IfdDispatcherClient(IfdVersion::Version pVersion, const QSh
 }
 
 
-bool IfdDispatcherClient::processContext(IfdMessageType pMsgType, const QJsonObject& pMsgObject)
+bool IfdDispatcherClient::processContext(IfdMessageType pMsgType, const QCborMap& pMsgObject)
 {
 	if (pMsgType != IfdMessageType::IFDEstablishContextResponse)
 	{
@@ -20,7 +20,7 @@ class IfdDispatcherClient
 	Q_OBJECT
 
 	private:
-		bool processContext(IfdMessageType pMsgType, const QJsonObject& pMsgObject) override;
+		bool processContext(IfdMessageType pMsgType, const QCborMap& pMsgObject) override;
 
 	public:
 		IfdDispatcherClient(IfdVersion::Version pVersion, const QSharedPointer<DataChannel>& pDataChannel);
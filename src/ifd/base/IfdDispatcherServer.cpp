@@ -41,7 +41,7 @@ IfdDispatcherServer::IfdDispatcherServer(const QSharedPointer<DataChannel>& pDat
 }
 
 
-void IfdDispatcherServer::createAndSendContext(const QJsonObject& pMessageObject)
+void IfdDispatcherServer::createAndSendContext(const QCborMap& pMessageObject)
 {
 	ECardApiResult::Minor fail = ECardApiResult::Minor::null;
 
@@ -79,7 +79,7 @@ void IfdDispatcherServer::createAndSendContext(const QJsonObject& pMessageObject
 }
 
 
-bool IfdDispatcherServer::processContext(IfdMessageType pMsgType, const QJsonObject& pMsgObject)
+bool IfdDispatcherServer::processContext(IfdMessageType pMsgType, const QCborMap& pMsgObject)
 {
 	if (pMsgType != IfdMessageType::IFDEstablishContext)
 	{
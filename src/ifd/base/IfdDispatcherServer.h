@@ -19,8 +19,8 @@ class IfdDispatcherServer
 	Q_OBJECT
 
 	private:
-		void createAndSendContext(const QJsonObject& pMessageObject);
-		bool processContext(IfdMessageType pMsgType, const QJsonObject& pMsgObject) override;
+		void createAndSendContext(const QCborMap& pMessageObject);
+		bool processContext(IfdMessageType pMsgType, const QCborMap& pMsgObject) override;
 
 	public:
 		explicit IfdDispatcherServer(const QSharedPointer<DataChannel>& pDataChannel);
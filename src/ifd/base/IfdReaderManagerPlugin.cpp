@@ -96,7 +96,7 @@ void IfdReaderManagerPlugin::processConnectedReader(const QString& pReaderName,
 }
 
 
-void IfdReaderManagerPlugin::handleIFDStatus(const QJsonObject& pJsonObject, const QString& pId)
+void IfdReaderManagerPlugin::handleIFDStatus(const QCborMap& pMessageObject, const QString& pId)
 {
 	const auto it = mDispatcherList.constFind(pId);
 	if (it == mDispatcherList.constEnd())
@@ -104,7 +104,7 @@ void IfdReaderManagerPlugin::handleIFDStatus(const QJsonObject& pJsonObject, con
 		return;
 	}
 	const auto& dispatcher = *it;
-	IfdStatus ifdStatus(pJsonObject);
+	IfdStatus ifdStatus(pMessageObject);
 
 	const QString& contextHandle = dispatcher->getContextHandle();
 	const QString& readerName = ifdStatus.getSlotName() + contextHandle;
@@ -163,7 +163,7 @@ void IfdReaderManagerPlugin::onContextEstablished(const QString& pIfdName, const
 }
 
 
-void IfdReaderManagerPlugin::onMessage(IfdMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId)
+void IfdReaderManagerPlugin::onMessage(IfdMessageType pMessageType, const QCborMap& pMessageObject, const QString& pId)
 {
 	switch (pMessageType)
 	{
@@ -197,7 +197,7 @@ void IfdReaderManagerPlugin::onMessage(IfdMessageType pMessageType, const QJsonO
 		}
 
 		case IfdMessageType::IFDStatus:
-			handleIFDStatus(pJsonObject, pId);
+			handleIFDStatus(pMessageObject, pId);
 			break;
 	}
 }
@@ -32,11 +32,11 @@ class IfdReaderManagerPlugin
 		QMap<QString, Reader*> mReaderList;
 
 		void processConnectedReader(const QString& pReaderName, const IfdStatus& pIfdStatus, const QSharedPointer<IfdDispatcherClient>& pDispatcher, const QString& pId);
-		void handleIFDStatus(const QJsonObject& pJsonObject, const QString& pId);
+		void handleIFDStatus(const QCborMap& pMessageObject, const QString& pId);
 
 	private Q_SLOTS:
 		void onContextEstablished(const QString& pIfdName, const QString& pId) const;
-		void onMessage(IfdMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void onMessage(IfdMessageType pMessageType, const QCborMap& pMessageObject, const QString& pId);
 		void onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 
 	protected:
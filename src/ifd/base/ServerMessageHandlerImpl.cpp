@@ -48,6 +48,7 @@ ServerMessageHandlerImpl::ServerMessageHandlerImpl(const QSharedPointer<DataChan
 	, mAllowedPluginTypes(pAllowedTypes)
 	, mAllowedCardTypes(pAllowedTypes)
 	, mCardConnections()
+	, mBatchTransmits()
 {
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireReceived, this, &ServerMessageHandlerImpl::onMessage);
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireClosed, this, &ServerMessageHandlerImpl::onClosed);
@@ -64,9 +65,9 @@ ServerMessageHandlerImpl::ServerMessageHandlerImpl(const QSharedPointer<DataChan
 }
 
 
-void ServerMessageHandlerImpl::handleIfdGetStatus(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdGetStatus(const QCborMap& pMessageObject)
 {
-	const IfdGetStatus ifdGetStatus(pJsonObject);
+	const IfdGetStatus ifdGetStatus(pMessageObject);
 	const auto* readerManager = Env::getSingleton<ReaderManager>();
 
 	if (!ifdGetStatus.getSlotName().isEmpty())
@@ -102,9 +103,9 @@ void ServerMessageHandlerImpl::handleIfdGetStatus(const QJsonObject& pJsonObject
 }
 
 
-void ServerMessageHandlerImpl::handleIfdConnect(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdConnect(const QCborMap& pMessageObject)
 {
-	const IfdConnect ifdConnect(pJsonObject);
+	const IfdConnect ifdConnect(pMessageObject);
 	auto* readerManager = Env::getSingleton<ReaderManager>();
 
 	const auto& info = readerManager->getReaderInfo(ifdConnect.getSlotName());
@@ -191,9 +192,9 @@ bool ServerMessageHandlerImpl::isAllowed(const QSharedPointer<CardConnection>& p
 }
 
 
-void ServerMessageHandlerImpl::handleIfdDisconnect(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdDisconnect(const QCborMap& pMessageObject)
 {
-	const IfdDisconnect ifdDisconnect(pJsonObject);
+	const IfdDisconnect ifdDisconnect(pMessageObject);
 	const QString& slotHandle = ifdDisconnect.getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -213,9 +214,9 @@ void ServerMessageHandlerImpl::handleIfdDisconnect(const QJsonObject& pJsonObjec
 }
 
 
-void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdTransmit(const QCborMap& pMessageObject)
 {
-	const IfdTransmit ifdTransmit(pJsonObject);
+	const IfdTransmit ifdTransmit(pMessageObject);
 	const QString& slotHandle = ifdTransmit.getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -226,6 +227,14 @@ void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
 		return;
 	}
 
+	if (ifdTransmit.isBatch() && mDispatcher->getVersion() < IfdVersion::Version::v3)
+	{
+		qCWarning(ifd) << "Transmit batches are not supported by" << mDispatcher->getVersion();
+		const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, QByteArray(), ECardApiResult::Minor::AL_Unknown_Error);
+		mDispatcher->send(response);
+		return;
+	}
+
 	const auto& cardConnection = mCardConnections.value(slotHandle);
 
 	const QString& progressMessage = ifdTransmit.getDisplayText();
@@ -235,15 +244,21 @@ void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
 		Q_EMIT fireDisplayTextChanged(progressMessage);
 	}
 
-	qCDebug(ifd) << "Transmit APDU for" << slotHandle;
-	InputAPDUInfo inputApduInfo(ifdTransmit.getInputApdu());
-	cardConnection->callTransmitCommand(this, &ServerMessageHandlerImpl::onTransmitCardCommandDone, {inputApduInfo}, slotHandle);
+	// The response has to use the form of the request, even for a batch with a single APDU.
+	if (ifdTransmit.isBatch())
+	{
+		mBatchTransmits.insert(slotHandle);
+	}
+
+	const auto& inputApduInfos = ifdTransmit.getInputApduInfos();
+	qCDebug(ifd) << "Transmit" << inputApduInfos.size() << "APDU(s) for" << slotHandle;
+	cardConnection->callTransmitCommand(this, &ServerMessageHandlerImpl::onTransmitCardCommandDone, inputApduInfos, slotHandle);
 }
 
 
-void ServerMessageHandlerImpl::handleIfdEstablishPaceChannel(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdEstablishPaceChannel(const QCborMap& pMessageObject)
 {
-	const auto& ifdEstablishPaceChannel = QSharedPointer<IfdEstablishPaceChannel>::create(pJsonObject);
+	const auto& ifdEstablishPaceChannel = QSharedPointer<IfdEstablishPaceChannel>::create(pMessageObject);
 	const QString& slotHandle = ifdEstablishPaceChannel->getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -287,9 +302,9 @@ void ServerMessageHandlerImpl::sendEstablishPaceChannelResponse(const QString& p
 }
 
 
-void ServerMessageHandlerImpl::handleIfdDestroyPaceChannel(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdDestroyPaceChannel(const QCborMap& pMessageObject)
 {
-	const IfdDestroyPaceChannel ifdDestroy(pJsonObject);
+	const IfdDestroyPaceChannel ifdDestroy(pMessageObject);
 	const QString& slotHandle = ifdDestroy.getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -313,9 +328,9 @@ void ServerMessageHandlerImpl::handleIfdDestroyPaceChannel(const QJsonObject& pJ
 }
 
 
-void ServerMessageHandlerImpl::handleIfdModifyPIN(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdModifyPIN(const QCborMap& pMessageObject)
 {
-	const auto& ifdModifyPin = QSharedPointer<IfdModifyPin>::create(pJsonObject);
+	const auto& ifdModifyPin = QSharedPointer<IfdModifyPin>::create(pMessageObject);
 	const QString slotHandle = ifdModifyPin->getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -406,6 +421,12 @@ void ServerMessageHandlerImpl::onTransmitCardCommandDone(QSharedPointer<BaseCard
 	auto transmitCommand = pCommand.staticCast<TransmitCommand>();
 	const QString& slotHandle = transmitCommand->getSlotHandle();
 
+	if (mBatchTransmits.remove(slotHandle))
+	{
+		sendTransmitBatchResponse(transmitCommand);
+		return;
+	}
+
 	if (transmitCommand->getReturnCode() != CardReturnCode::OK)
 	{
 		qCWarning(ifd) << "Transmit for" << slotHandle << "failed" << transmitCommand->getReturnCode();
@@ -431,6 +452,37 @@ void ServerMessageHandlerImpl::onTransmitCardCommandDone(QSharedPointer<BaseCard
 }
 
 
+void ServerMessageHandlerImpl::sendTransmitBatchResponse(const QSharedPointer<TransmitCommand>& pCommand)
+{
+	const QString& slotHandle = pCommand->getSlotHandle();
+
+	QByteArrayList outputApdus;
+	for (const auto& outputApduAsHex : pCommand->getOutputApduAsHex())
+	{
+		outputApdus += QByteArray::fromHex(outputApduAsHex);
+	}
+
+	// An unexpected status code is no error of the batch. The client evaluates the last response on its own.
+	const auto returnCode = pCommand->getReturnCode();
+	if (returnCode != CardReturnCode::OK && returnCode != CardReturnCode::UNEXPECTED_TRANSMIT_STATUS)
+	{
+		qCWarning(ifd) << "Transmit batch for" << slotHandle << "failed after" << outputApdus.size() << "APDU(s)" << returnCode;
+		const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, outputApdus, ECardApiResult::Minor::AL_Unknown_Error);
+		mDispatcher->send(response);
+		return;
+	}
+
+	qCInfo(ifd) << "Transmit batch of" << outputApdus.size() << "APDU(s) for" << slotHandle << "succeeded";
+	const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, outputApdus);
+	mDispatcher->send(response);
+
+	if (pCommand->getSecureMessagingStopped())
+	{
+		Q_EMIT fireSecureMessagingStopped();
+	}
+}
+
+
 void ServerMessageHandlerImpl::onDestroyPaceChannelCommandDone(QSharedPointer<BaseCardCommand> pCommand)
 {
 	auto destroyPaceChannelCommand = pCommand.staticCast<DestroyPaceChannelCommand>();
@@ -458,12 +510,13 @@ void ServerMessageHandlerImpl::onDestroyPaceChannelCommandDone(QSharedPointer<Ba
 void ServerMessageHandlerImpl::onClosed()
 {
 	mCardConnections.clear();
+	mBatchTransmits.clear();
 
 	Q_EMIT fireClosed();
 }
 
 
-void ServerMessageHandlerImpl::onMessage(IfdMessageType pMessageType, const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::onMessage(IfdMessageType pMessageType, const QCborMap& pMessageObject)
 {
 	switch (pMessageType)
 	{
@@ -491,31 +544,31 @@ void ServerMessageHandlerImpl::onMessage(IfdMessageType pMessageType, const QJso
 		}
 
 		case IfdMessageType::IFDGetStatus:
-			handleIfdGetStatus(pJsonObject);
+			handleIfdGetStatus(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDConnect:
-			handleIfdConnect(pJsonObject);
+			handleIfdConnect(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDTransmit:
-			handleIfdTransmit(pJsonObject);
+			handleIfdTransmit(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDDisconnect:
-			handleIfdDisconnect(pJsonObject);
+			handleIfdDisconnect(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDEstablishPACEChannel:
-			handleIfdEstablishPaceChannel(pJsonObject);
+			handleIfdEstablishPaceChannel(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDDestroyPACEChannel:
-			handleIfdDestroyPaceChannel(pJsonObject);
+			handleIfdDestroyPaceChannel(pMessageObject);
 			break;
 
 		case IfdMessageType::IFDModifyPIN:
-			handleIfdModifyPIN(pJsonObject);
+			handleIfdModifyPIN(pMessageObject);
 			break;
 	}
 }
@@ -11,11 +11,13 @@
 #include "ServerMessageHandler.h"
 #include "command/BaseCardCommand.h"
 #include "command/CreateCardConnectionCommand.h"
+#include "command/TransmitCommand.h"
 #include "messages/IfdMessage.h"
 
 #include <QList>
 #include <QMap>
 #include <QPointer>
+#include <QSet>
 
 
 namespace governikus
@@ -31,25 +33,27 @@ class ServerMessageHandlerImpl
 		QList<ReaderManagerPluginType> mAllowedPluginTypes;
 		QList<ReaderManagerPluginType> mAllowedCardTypes;
 		QMap<QString, QSharedPointer<CardConnection>> mCardConnections;
+		QSet<QString> mBatchTransmits;
 
 		[[nodiscard]] QString slotHandleForReaderName(const QString& pReaderName) const;
 		[[nodiscard]] bool isAllowed(const QSharedPointer<CardConnection>& pCardConnection, QStringView pCommand) const;
 
-		void handleIfdGetStatus(const QJsonObject& pJsonObject);
-		void handleIfdConnect(const QJsonObject& pJsonObject);
-		void handleIfdDisconnect(const QJsonObject& pJsonObject);
-		void handleIfdTransmit(const QJsonObject& pJsonObject);
-		void handleIfdEstablishPaceChannel(const QJsonObject& pJsonObject);
-		void handleIfdDestroyPaceChannel(const QJsonObject& pJsonObject);
-		void handleIfdModifyPIN(const QJsonObject& pJsonObject);
+		void handleIfdGetStatus(const QCborMap& pMessageObject);
+		void handleIfdConnect(const QCborMap& pMessageObject);
+		void handleIfdDisconnect(const QCborMap& pMessageObject);
+		void handleIfdTransmit(const QCborMap& pMessageObject);
+		void handleIfdEstablishPaceChannel(const QCborMap& pMessageObject);
+		void handleIfdDestroyPaceChannel(const QCborMap& pMessageObject);
+		void handleIfdModifyPIN(const QCborMap& pMessageObject);
 		void sendIfdStatus(const ReaderInfo& pReaderInfo);
+		void sendTransmitBatchResponse(const QSharedPointer<TransmitCommand>& pCommand);
 
 	private Q_SLOTS:
 		void onCreateCardConnectionCommandDone(QSharedPointer<CreateCardConnectionCommand> pCommand);
 		void onTransmitCardCommandDone(QSharedPointer<BaseCardCommand> pCommand);
 		void onDestroyPaceChannelCommandDone(QSharedPointer<BaseCardCommand> pCommand);
 		void onClosed();
-		void onMessage(IfdMessageType pMessageType, const QJsonObject& pJsonObject);
+		void onMessage(IfdMessageType pMessageType, const QCborMap& pMessageObject);
 		void onReaderChanged(const ReaderInfo& pInfo);
 		void onReaderRemoved(const ReaderInfo& pInfo);
 
@@ -44,6 +44,7 @@ WebSocketChannel::WebSocketChannel(const QSharedPointer<QWebSocket>& pConnection
 	if (mConnection)
 	{
 		connect(mConnection.data(), &QWebSocket::textMessageReceived, this, &WebSocketChannel::onReceived);
+		connect(mConnection.data(), &QWebSocket::binaryMessageReceived, this, &WebSocketChannel::onBinaryReceived);
 		connect(mConnection.data(), &QWebSocket::disconnected, this, &WebSocketChannel::onDisconnected);
 		connect(&mPingTimer, &QTimer::timeout, this, &WebSocketChannel::onPingScheduled);
 		connect(mConnection.data(), &QWebSocket::pong, this, &WebSocketChannel::onPongReceived);
@@ -63,6 +64,7 @@ WebSocketChannel::~WebSocketChannel()
 	if (mConnection)
 	{
 		disconnect(mConnection.data(), &QWebSocket::textMessageReceived, this, &WebSocketChannel::onReceived);
+		disconnect(mConnection.data(), &QWebSocket::binaryMessageReceived, this, &WebSocketChannel::onBinaryReceived);
 		disconnect(mConnection.data(), &QWebSocket::disconnected, this, &WebSocketChannel::onDisconnected);
 		disconnect(mConnection.data(), &QWebSocket::pong, this, &WebSocketChannel::onPongReceived);
 		disconnect(&mPingTimer, &QTimer::timeout, this, &WebSocketChannel::onPingScheduled);
@@ -80,6 +82,15 @@ void WebSocketChannel::send(const QByteArray& pDataBlock)
 }
 
 
+void WebSocketChannel::sendBinary(const QByteArray& pDataBlock)
+{
+	if (mConnection)
+	{
+		mConnection->sendBinaryMessage(pDataBlock);
+	}
+}
+
+
 void WebSocketChannel::close()
 {
 	if (mConnection)
@@ -116,6 +127,12 @@ void WebSocketChannel::onReceived(const QString& pMessage)
 }
 
 
+void WebSocketChannel::onBinaryReceived(const QByteArray& pMessage)
+{
+	Q_EMIT fireReceived(pMessage);
+}
+
+
 void WebSocketChannel::onDisconnected()
 {
 	mPingTimer.stop();
@@ -34,12 +34,14 @@ class WebSocketChannel
 		~WebSocketChannel() override;
 
 		void send(const QByteArray& pDataBlock) override;
+		void sendBinary(const QByteArray& pDataBlock) override;
 		void close() override;
 		[[nodiscard]] bool isPairingConnection() const override;
 		[[nodiscard]] const QString& getId() const override;
 
 	private Q_SLOTS:
 		void onReceived(const QString& pMessage);
+		void onBinaryReceived(const QByteArray& pMessage);
 		void onDisconnected();
 		void onPingScheduled();
 		void onPongReceived();
@@ -8,8 +8,7 @@
 #include "Initializer.h"
 #include "RemoteServiceSettings.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
+#include <QCborArray>
 #include <QLoggingCategory>
 
 
@@ -35,7 +34,7 @@ INIT_FUNCTION([] {
 		})
 
 
-void Discovery::parseSupportedApi(const QJsonObject& pMessageObject)
+void Discovery::parseSupportedApi(const QCborMap& pMessageObject)
 {
 	if (!pMessageObject.contains(SUPPORTED_API()))
 	{
@@ -51,7 +50,7 @@ void Discovery::parseSupportedApi(const QJsonObject& pMessageObject)
 	}
 
 	const auto& array = value.toArray();
-	for (const QJsonValueConstRef entry : array)
+	for (const auto& entry : array)
 	{
 		if (entry.isString())
 		{
@@ -64,7 +63,7 @@ void Discovery::parseSupportedApi(const QJsonObject& pMessageObject)
 }
 
 
-void Discovery::parseIfdId(const QJsonObject& pMessageObject)
+void Discovery::parseIfdId(const QCborMap& pMessageObject)
 {
 	mIfdId = getStringValue(pMessageObject, IFD_ID());
 	if (isIncomplete())
@@ -89,7 +88,7 @@ void Discovery::parseIfdId(const QJsonObject& pMessageObject)
 }
 
 
-void Discovery::parsePairing(const QJsonObject& pMessageObject)
+void Discovery::parsePairing(const QCborMap& pMessageObject)
 {
 	QList<IfdVersion::Version> sorted(mSupportedApis);
 	std::sort(sorted.rbegin(), sorted.rend());
@@ -120,7 +119,7 @@ Discovery::Discovery(const QString& pIfdName, const QString& pIfdId, quint16 pPo
 }
 
 
-Discovery::Discovery(const QJsonObject& pMessageObject)
+Discovery::Discovery(const QCborMap& pMessageObject)
 	: IfdMessage(IfdMessageType::UNDEFINED)
 	, mIfdName()
 	, mIfdId()
@@ -179,14 +178,14 @@ bool Discovery::getPairing() const
 
 QByteArray Discovery::toByteArray(IfdVersion::Version pIfdVersion, const QString&) const
 {
-	QJsonObject result;
+	QCborMap result;
 
 	result[MSG_TYPE()] = QStringLiteral("REMOTE_IFD");
 	result[IFD_NAME()] = mIfdName;
 	result[IFD_ID()] = mIfdId;
 	result[PORT()] = mPort;
 
-	QJsonArray levels;
+	QCborArray levels;
 	for (const auto& level : std::as_const(mSupportedApis))
 	{
 		levels += IfdVersion(level).toString();
@@ -22,13 +22,13 @@ class Discovery
 		QList<IfdVersion::Version> mSupportedApis;
 		bool mPairing;
 
-		void parseSupportedApi(const QJsonObject& pMessageObject);
-		void parseIfdId(const QJsonObject& pMessageObject);
-		void parsePairing(const QJsonObject& pMessageObject);
+		void parseSupportedApi(const QCborMap& pMessageObject);
+		void parseIfdId(const QCborMap& pMessageObject);
+		void parsePairing(const QCborMap& pMessageObject);
 
 	public:
 		Discovery(const QString& pIfdName, const QString& pIfdId, quint16 pPort, const QList<IfdVersion::Version>& pSupportedApis, bool pPairing = false);
-		explicit Discovery(const QJsonObject& pMessageObject);
+		explicit Discovery(const QCborMap& pMessageObject);
 		~Discovery() override = default;
 
 		[[nodiscard]] const QString& getIfdName() const;
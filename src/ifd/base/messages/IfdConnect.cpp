@@ -5,7 +5,6 @@
 
 #include "IfdConnect.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -30,7 +29,7 @@ IfdConnect::IfdConnect(const QString& pSlotName, bool pExclusive)
 }
 
 
-IfdConnect::IfdConnect(const QJsonObject& pMessageObject)
+IfdConnect::IfdConnect(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotName()
 	, mExclusive(true)
@@ -54,12 +53,12 @@ bool IfdConnect::isExclusive() const
 }
 
 
-QByteArray IfdConnect::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdConnect::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_NAME()] = mSlotName;
 	result[EXCLUSIVE()] = mExclusive;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
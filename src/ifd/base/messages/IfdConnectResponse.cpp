@@ -5,7 +5,6 @@
 
 #include "IfdConnectResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdConnectResponse::IfdConnectResponse(const QString& pSlotHandle, ECardApiResul
 }
 
 
-IfdConnectResponse::IfdConnectResponse(const QJsonObject& pMessageObject)
+IfdConnectResponse::IfdConnectResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -45,11 +44,11 @@ const QString& IfdConnectResponse::getSlotHandle() const
 }
 
 
-QByteArray IfdConnectResponse::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdConnectResponse::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -18,7 +18,7 @@ class IfdConnectResponse
 
 	public:
 		IfdConnectResponse(const QString& pSlotHandle, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdConnectResponse(const QJsonObject& pMessageObject);
+		explicit IfdConnectResponse(const QCborMap& pMessageObject);
 		~IfdConnectResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -5,7 +5,6 @@
 
 #include "IfdDestroyPaceChannel.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDestroyPaceChannel::IfdDestroyPaceChannel(const QString& pSlotHandle)
 }
 
 
-IfdDestroyPaceChannel::IfdDestroyPaceChannel(const QJsonObject& pMessageObject)
+IfdDestroyPaceChannel::IfdDestroyPaceChannel(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotHandle()
 {
@@ -44,11 +43,11 @@ const QString& IfdDestroyPaceChannel::getSlotHandle() const
 }
 
 
-QByteArray IfdDestroyPaceChannel::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdDestroyPaceChannel::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
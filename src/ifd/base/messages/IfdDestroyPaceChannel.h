@@ -17,7 +17,7 @@ class IfdDestroyPaceChannel
 
 	public:
 		explicit IfdDestroyPaceChannel(const QString& pSlotHandle);
-		explicit IfdDestroyPaceChannel(const QJsonObject& pMessageObject);
+		explicit IfdDestroyPaceChannel(const QCborMap& pMessageObject);
 		~IfdDestroyPaceChannel() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -5,7 +5,6 @@
 
 #include "IfdDestroyPaceChannelResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDestroyPaceChannelResponse::IfdDestroyPaceChannelResponse(const QString& pSlo
 }
 
 
-IfdDestroyPaceChannelResponse::IfdDestroyPaceChannelResponse(const QJsonObject& pMessageObject)
+IfdDestroyPaceChannelResponse::IfdDestroyPaceChannelResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -44,11 +43,11 @@ const QString& IfdDestroyPaceChannelResponse::getSlotHandle() const
 }
 
 
-QByteArray IfdDestroyPaceChannelResponse::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdDestroyPaceChannelResponse::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -17,7 +17,7 @@ class IfdDestroyPaceChannelResponse
 
 	public:
 		explicit IfdDestroyPaceChannelResponse(const QString& pSlotHandle, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdDestroyPaceChannelResponse(const QJsonObject& pMessageObject);
+		explicit IfdDestroyPaceChannelResponse(const QCborMap& pMessageObject);
 		~IfdDestroyPaceChannelResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
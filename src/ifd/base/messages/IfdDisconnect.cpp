@@ -5,7 +5,6 @@
 
 #include "IfdDisconnect.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDisconnect::IfdDisconnect(const QString& pSlotHandle)
 }
 
 
-IfdDisconnect::IfdDisconnect(const QJsonObject& pMessageObject)
+IfdDisconnect::IfdDisconnect(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotHandle()
 {
@@ -44,11 +43,11 @@ const QString& IfdDisconnect::getSlotHandle() const
 }
 
 
-QByteArray IfdDisconnect::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdDisconnect::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -17,7 +17,7 @@ class IfdDisconnect
 
 	public:
 		explicit IfdDisconnect(const QString& pReaderName);
-		explicit IfdDisconnect(const QJsonObject& pMessageObject);
+		explicit IfdDisconnect(const QCborMap& pMessageObject);
 		~IfdDisconnect() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -5,7 +5,6 @@
 
 #include "IfdDisconnectResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDisconnectResponse::IfdDisconnectResponse(const QString& pSlotHandle, ECardAp
 }
 
 
-IfdDisconnectResponse::IfdDisconnectResponse(const QJsonObject& pMessageObject)
+IfdDisconnectResponse::IfdDisconnectResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -44,11 +43,11 @@ const QString& IfdDisconnectResponse::getSlotHandle() const
 }
 
 
-QByteArray IfdDisconnectResponse::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdDisconnectResponse::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -17,7 +17,7 @@ class IfdDisconnectResponse
 
 	public:
 		IfdDisconnectResponse(const QString& pSlotHandle, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdDisconnectResponse(const QJsonObject& pMessageObject);
+		explicit IfdDisconnectResponse(const QCborMap& pMessageObject);
 		~IfdDisconnectResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -5,7 +5,6 @@
 
 #include "IfdError.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdError::IfdError(const QString& pSlotHandle, ECardApiResult::Minor pResultMino
 }
 
 
-IfdError::IfdError(const QJsonObject& pMessageObject)
+IfdError::IfdError(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -44,11 +43,11 @@ const QString& IfdError::getSlotHandle() const
 }
 
 
-QByteArray IfdError::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdError::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -5,7 +5,6 @@
 
 #include "IfdEstablishContext.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -30,7 +29,7 @@ IfdEstablishContext::IfdEstablishContext(const IfdVersion::Version& pVersion, co
 }
 
 
-IfdEstablishContext::IfdEstablishContext(const QJsonObject& pMessageObject)
+IfdEstablishContext::IfdEstablishContext(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mProtocolRaw(getStringValue(pMessageObject, PROTOCOL()))
 	, mProtocol(IfdVersion(mProtocolRaw))
@@ -60,7 +59,7 @@ const QString& IfdEstablishContext::getUdName() const
 
 QByteArray IfdEstablishContext::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[PROTOCOL()] = mProtocol.toString();
 	result[UD_NAME()] = mUdName;
@@ -8,7 +8,6 @@
 #include "IfdMessage.h"
 #include "IfdVersion.h"
 
-#include <QJsonObject>
 #include <QString>
 
 
@@ -24,7 +23,7 @@ class IfdEstablishContext
 
 	public:
 		IfdEstablishContext(const IfdVersion::Version& pVersion, const QString& pUdName);
-		explicit IfdEstablishContext(const QJsonObject& pMessageObject);
+		explicit IfdEstablishContext(const QCborMap& pMessageObject);
 		~IfdEstablishContext() override = default;
 
 		[[nodiscard]] const IfdVersion& getProtocol() const;
@@ -5,7 +5,6 @@
 
 #include "IfdEstablishContextResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -26,7 +25,7 @@ IfdEstablishContextResponse::IfdEstablishContextResponse(const QString& pIfdName
 }
 
 
-IfdEstablishContextResponse::IfdEstablishContextResponse(const QJsonObject& pMessageObject)
+IfdEstablishContextResponse::IfdEstablishContextResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mIfdName()
 {
@@ -38,7 +37,7 @@ IfdEstablishContextResponse::IfdEstablishContextResponse(const QJsonObject& pMes
 
 QByteArray IfdEstablishContextResponse::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[IFD_NAME()] = mIfdName;
 
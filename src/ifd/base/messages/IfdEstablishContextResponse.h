@@ -6,7 +6,6 @@
 
 #include "IfdMessageResponse.h"
 
-#include <QJsonObject>
 #include <QString>
 
 
@@ -20,7 +19,7 @@ class IfdEstablishContextResponse
 
 	public:
 		IfdEstablishContextResponse(const QString& pIfdName, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdEstablishContextResponse(const QJsonObject& pMessageObject);
+		explicit IfdEstablishContextResponse(const QCborMap& pMessageObject);
 		~IfdEstablishContextResponse() override = default;
 
 		[[nodiscard]] const QString& getIfdName() const;
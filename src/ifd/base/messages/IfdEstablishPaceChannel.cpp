@@ -4,7 +4,6 @@
 
 #include "IfdEstablishPaceChannel.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -22,17 +21,16 @@ VALUE_NAME(EXPECTED_PIN_LENGTH, "ExpectedPINLength")
 } // namespace
 
 
-void IfdEstablishPaceChannel::parseInputData(const QJsonObject& pMessageObject)
+void IfdEstablishPaceChannel::parseInputData(const QCborMap& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
-	const QString& inputData = getStringValue(pMessageObject, INPUT_DATA());
+	const auto& input = getByteArrayValue(pMessageObject, INPUT_DATA());
 	if (isIncomplete())
 	{
 		return;
 	}
 
-	const auto& input = QByteArray::fromHex(inputData.toUtf8());
 	if (v0Supported && EstablishPaceChannel::isCcid(input))
 	{
 		if (!mInputData.fromCcid(input))
@@ -67,7 +65,7 @@ IfdEstablishPaceChannel::IfdEstablishPaceChannel(const QString& pSlotHandle, con
 }
 
 
-IfdEstablishPaceChannel::IfdEstablishPaceChannel(const QJsonObject& pMessageObject)
+IfdEstablishPaceChannel::IfdEstablishPaceChannel(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotHandle()
 	, mInputData()
@@ -106,12 +104,12 @@ int IfdEstablishPaceChannel::getExpectedPinLength() const
 
 QByteArray IfdEstablishPaceChannel::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 	if (pIfdVersion >= IfdVersion::Version::v2)
 	{
-		result[INPUT_DATA()] = QString::fromLatin1(mInputData.createInputData().toHex());
+		result[INPUT_DATA()] = mInputData.createInputData();
 		if (mExpectedPinLength > 0)
 		{
 			result[EXPECTED_PIN_LENGTH()] = mExpectedPinLength;
@@ -119,8 +117,8 @@ QByteArray IfdEstablishPaceChannel::toByteArray(IfdVersion::Version pIfdVersion,
 	}
 	else
 	{
-		result[INPUT_DATA()] = QString::fromLatin1(mInputData.createASN1StructCcid().toHex());
+		result[INPUT_DATA()] = mInputData.createASN1StructCcid();
 	}
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
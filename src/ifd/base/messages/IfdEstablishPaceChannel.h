@@ -19,11 +19,11 @@ class IfdEstablishPaceChannel
 		EstablishPaceChannel mInputData;
 		int mExpectedPinLength;
 
-		void parseInputData(const QJsonObject& pMessageObject);
+		void parseInputData(const QCborMap& pMessageObject);
 
 	public:
 		IfdEstablishPaceChannel(const QString& pSlotHandle, const EstablishPaceChannel& pInputData, int pExpectedPinLength);
-		explicit IfdEstablishPaceChannel(const QJsonObject& pMessageObject);
+		explicit IfdEstablishPaceChannel(const QCborMap& pMessageObject);
 		~IfdEstablishPaceChannel() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -5,7 +5,6 @@
 
 #include "IfdGetStatus.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdGetStatus::IfdGetStatus(const QString& pSlotName)
 }
 
 
-IfdGetStatus::IfdGetStatus(const QJsonObject& pMessageObject)
+IfdGetStatus::IfdGetStatus(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotName()
 {
@@ -44,11 +43,11 @@ const QString& IfdGetStatus::getSlotName() const
 }
 
 
-QByteArray IfdGetStatus::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdGetStatus::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_NAME()] = mSlotName;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
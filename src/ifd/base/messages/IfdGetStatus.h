@@ -17,7 +17,7 @@ class IfdGetStatus
 
 	public:
 		explicit IfdGetStatus(const QString& pSlotName = QString());
-		explicit IfdGetStatus(const QJsonObject& pMessageObject);
+		explicit IfdGetStatus(const QCborMap& pMessageObject);
 		~IfdGetStatus() override = default;
 
 		[[nodiscard]] const QString& getSlotName() const;
@@ -7,11 +7,20 @@
 
 #include "Initializer.h"
 
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
 #ifndef QT_NO_DEBUG
 	#include <QCoreApplication>
 #endif
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QLoggingCategory>
 
+#include <algorithm>
+#include <iterator>
+
 
 Q_DECLARE_LOGGING_CATEGORY(ifd)
 
@@ -23,6 +32,98 @@ namespace
 {
 VALUE_NAME(MSG_TYPE, "msg")
 VALUE_NAME(CONTEXT_HANDLE, "ContextHandle")
+
+// Values that are hex encoded in JSON and transferred as byte strings in CBOR.
+// They are carried as byte arrays in a parsed or created message.
+const QLatin1String cBinaryValues[] = {
+	QLatin1String("InputAPDU"),
+	QLatin1String("ResponseAPDU"),
+	QLatin1String("ResponseAPDUs"),
+	QLatin1String("OutputAPDUs"),
+	QLatin1String("InputData"),
+	QLatin1String("OutputData"),
+	QLatin1String("ResultCode")
+};
+
+
+bool isBinaryValue(const QString& pName)
+{
+	return std::find(std::begin(cBinaryValues), std::end(cBinaryValues), pName) != std::end(cBinaryValues);
+}
+
+
+QCborValue toCbor(const QJsonValue& pValue, bool pBinary)
+{
+	switch (pValue.type())
+	{
+		case QJsonValue::Object:
+		{
+			const auto& object = pValue.toObject();
+			QCborMap map;
+			for (auto iter = object.constBegin(); iter != object.constEnd(); ++iter)
+			{
+				map.insert(iter.key(), toCbor(iter.value(), isBinaryValue(iter.key())));
+			}
+			return map;
+		}
+
+		case QJsonValue::Array:
+		{
+			QCborArray array;
+			const auto& values = pValue.toArray();
+			for (const auto& value : values)
+			{
+				array.append(toCbor(value, pBinary));
+			}
+			return array;
+		}
+
+		case QJsonValue::String:
+			if (pBinary)
+			{
+				return QCborValue(QByteArray::fromHex(pValue.toString().toLatin1()));
+			}
+			return QCborValue(pValue.toString());
+
+		default:
+			return QCborValue::fromJsonValue(pValue);
+	}
+}
+
+
+QJsonValue toJson(const QCborValue& pValue)
+{
+	if (pValue.isMap())
+	{
+		QJsonObject object;
+		const auto& map = pValue.toMap();
+		for (auto iter = map.constBegin(); iter != map.constEnd(); ++iter)
+		{
+			object.insert(iter.key().toString(), toJson(iter.value()));
+		}
+		return object;
+	}
+
+	if (pValue.isArray())
+	{
+		QJsonArray array;
+		const auto& values = pValue.toArray();
+		for (const auto& value : values)
+		{
+			array.append(toJson(value));
+		}
+		return array;
+	}
+
+	if (pValue.isByteArray())
+	{
+		return QString::fromLatin1(pValue.toByteArray().toHex());
+	}
+
+	return pValue.toJsonValue();
+}
+
+
 } // namespace
 
 
@@ -31,9 +132,9 @@ INIT_FUNCTION([] {
 		})
 
 
-QJsonObject IfdMessage::createMessageBody(const QString& pContextHandle) const
+QCborMap IfdMessage::createMessageBody(const QString& pContextHandle) const
 {
-	QJsonObject messageBody;
+	QCborMap messageBody;
 	messageBody[MSG_TYPE()] = getEnumName(mMessageType);
 	if (mMessageType == IfdMessageType::IFDEstablishContext)
 	{
@@ -49,16 +150,29 @@ QJsonObject IfdMessage::createMessageBody(const QString& pContextHandle) const
 }
 
 
-QByteArray IfdMessage::toByteArray(const QJsonObject& pJsonObject)
+QByteArray IfdMessage::toByteArray(const QCborMap& pMessageObject)
 {
+	const QJsonObject& jsonObject = toJson(pMessageObject).toObject();
+
 #ifndef QT_NO_DEBUG
 	if (QCoreApplication::applicationName().startsWith(QLatin1String("Test")))
 	{
-		return QJsonDocument(pJsonObject).toJson(QJsonDocument::Indented);
+		return QJsonDocument(jsonObject).toJson(QJsonDocument::Indented);
 	}
 #endif
 
-	return QJsonDocument(pJsonObject).toJson(QJsonDocument::Compact);
+	return QJsonDocument(jsonObject).toJson(QJsonDocument::Compact);
+}
+
+
+QByteArray IfdMessage::toByteArray(IfdVersion::Version pIfdVersion, const QCborMap& pMessageObject)
+{
+	if (IfdVersion(pIfdVersion).isBinaryFraming())
+	{
+		return pMessageObject.toCborValue().toCbor();
+	}
+
+	return toByteArray(pMessageObject);
 }
 
 
@@ -94,11 +208,11 @@ void IfdMessage::invalidType(const QLatin1String& pName, const QLatin1String& pE
 }
 
 
-bool IfdMessage::getBoolValue(const QJsonObject& pJsonObject, const QLatin1String& pName)
+bool IfdMessage::getBoolValue(const QCborMap& pMessageObject, const QLatin1String& pName)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
+		const auto& value = pMessageObject.value(pName);
 		if (value.isBool())
 		{
 			return value.toBool();
@@ -113,14 +227,18 @@ bool IfdMessage::getBoolValue(const QJsonObject& pJsonObject, const QLatin1Strin
 }
 
 
-int IfdMessage::getIntValue(const QJsonObject& pJsonObject, const QLatin1String& pName, int pDefault)
+int IfdMessage::getIntValue(const QCborMap& pMessageObject, const QLatin1String& pName, int pDefault)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
+		const auto& value = pMessageObject.value(pName);
+		if (value.isInteger())
+		{
+			return static_cast<int>(value.toInteger());
+		}
 		if (value.isDouble())
 		{
-			return value.toInt();
+			return static_cast<int>(value.toDouble());
 		}
 
 		invalidType(pName, QLatin1String("number"));
@@ -132,11 +250,11 @@ int IfdMessage::getIntValue(const QJsonObject& pJsonObject, const QLatin1String&
 }
 
 
-QString IfdMessage::getStringValue(const QJsonObject& pJsonObject, const QLatin1String& pName)
+QString IfdMessage::getStringValue(const QCborMap& pMessageObject, const QLatin1String& pName)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
+		const auto& value = pMessageObject.value(pName);
 		if (value.isString())
 		{
 			return value.toString();
@@ -151,8 +269,52 @@ QString IfdMessage::getStringValue(const QJsonObject& pJsonObject, const QLatin1
 }
 
 
-QJsonObject IfdMessage::parseByteArray(const QByteArray& pMessage)
+QByteArray IfdMessage::getByteArrayValue(const QCborMap& pMessageObject, const QLatin1String& pName)
 {
+	if (pMessageObject.contains(pName))
+	{
+		const auto& value = pMessageObject.value(pName);
+		if (value.isByteArray())
+		{
+			return value.toByteArray();
+		}
+
+		invalidType(pName, QLatin1String("string"));
+		return QByteArray();
+	}
+
+	missingValue(pName);
+	return QByteArray();
+}
+
+
+bool IfdMessage::isBinary(const QByteArray& pMessage)
+{
+	// A JSON message starts with '{' or whitespace, a CBOR message with the initial byte of a map (major type 5).
+	return !pMessage.isEmpty() && (static_cast<quint8>(pMessage.at(0)) >> 5) == 5;
+}
+
+
+QCborMap IfdMessage::parseByteArray(const QByteArray& pMessage)
+{
+	if (isBinary(pMessage))
+	{
+		QCborParserError error {};
+		const auto& value = QCborValue::fromCbor(pMessage, &error);
+		if (error.error != QCborError::NoError)
+		{
+			qCWarning(ifd) << "Cbor parsing failed." << error.offset << ":" << error.errorString();
+		}
+
+		const QCborMap& map = error.error == QCborError::NoError ? value.toMap() : QCborMap();
+		if (map.isEmpty())
+		{
+			qCWarning(ifd) << "Expected object at top level";
+		}
+
+		return map;
+	}
+
 	QJsonParseError error {};
 	const QJsonDocument& doc = QJsonDocument::fromJson(pMessage, &error);
 	if (error.error != QJsonParseError::NoError)
@@ -166,7 +328,7 @@ QJsonObject IfdMessage::parseByteArray(const QByteArray& pMessage)
 		qCWarning(ifd) << "Expected object at top level";
 	}
 
-	return obj;
+	return toCbor(obj, false).toMap();
 }
 
 
@@ -178,7 +340,7 @@ IfdMessage::IfdMessage(IfdMessageType pMessageType)
 }
 
 
-IfdMessage::IfdMessage(const QJsonObject& pMessageObject)
+IfdMessage::IfdMessage(const QCborMap& pMessageObject)
 	: mIncomplete(false)
 	, mMessageType(IfdMessageType::UNDEFINED)
 	, mContextHandle()
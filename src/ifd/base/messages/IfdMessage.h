@@ -7,8 +7,8 @@
 #include "EnumHelper.h"
 #include "IfdVersion.h"
 
-#include <QJsonDocument>
-#include <QJsonObject>
+#include <QByteArray>
+#include <QCborMap>
 #include <QString>
 
 
@@ -49,22 +49,29 @@ class IfdMessage
 		QString mContextHandle;
 
 	protected:
-		[[nodiscard]] virtual QJsonObject createMessageBody(const QString& pContextHandle) const;
-		static QByteArray toByteArray(const QJsonObject& pJsonObject);
+		[[nodiscard]] virtual QCborMap createMessageBody(const QString& pContextHandle) const;
+		static QByteArray toByteArray(const QCborMap& pMessageObject);
+		static QByteArray toByteArray(IfdVersion::Version pIfdVersion, const QCborMap& pMessageObject);
 
 		void ensureType(IfdMessageType pType);
 		void markIncomplete(const QString& pLogMessage);
 		void missingValue(const QLatin1String& pName);
 		void invalidType(const QLatin1String& pName, const QLatin1String& pExpectedType);
-		bool getBoolValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
-		int getIntValue(const QJsonObject& pJsonObject, const QLatin1String& pName, int pDefault);
-		QString getStringValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
+		bool getBoolValue(const QCborMap& pMessageObject, const QLatin1String& pName);
+		int getIntValue(const QCborMap& pMessageObject, const QLatin1String& pName, int pDefault);
+		QString getStringValue(const QCborMap& pMessageObject, const QLatin1String& pName);
+		QByteArray getByteArrayValue(const QCborMap& pMessageObject, const QLatin1String& pName);
 
 	public:
-		static QJsonObject parseByteArray(const QByteArray& pMessage);
+		/*!
+		 * Parses a message in JSON or, if \ref isBinary, in CBOR format.
+		 * Binary values are returned as byte arrays, hex strings of a JSON message are decoded.
+		 */
+		static QCborMap parseByteArray(const QByteArray& pMessage);
+		static bool isBinary(const QByteArray& pMessage);
 
 		explicit IfdMessage(IfdMessageType pType);
-		explicit IfdMessage(const QJsonObject& pMessageObject);
+		explicit IfdMessage(const QCborMap& pMessageObject);
 		virtual ~IfdMessage() = default;
 
 		[[nodiscard]] bool isIncomplete() const;
@@ -21,12 +21,12 @@ VALUE_NAME(RESULT_MINOR, "ResultMinor")
 } // namespace
 
 
-QJsonObject IfdMessageResponse::createMessageBody(const QString& pContextHandle) const
+QCborMap IfdMessageResponse::createMessageBody(const QString& pContextHandle) const
 {
-	QJsonObject result = IfdMessage::createMessageBody(pContextHandle);
+	QCborMap result = IfdMessage::createMessageBody(pContextHandle);
 	const ECardApiResult eCardApiResult(mResultMajor, mResultMinor);
 	result[RESULT_MAJOR()] = eCardApiResult.getMajorString();
-	result[RESULT_MINOR()] = mResultMinor == ECardApiResult::Minor::null ? QJsonValue() : eCardApiResult.getMinorString();
+	result[RESULT_MINOR()] = mResultMinor == ECardApiResult::Minor::null ? QCborValue(nullptr) : eCardApiResult.getMinorString();
 	return result;
 }
 
@@ -39,7 +39,7 @@ IfdMessageResponse::IfdMessageResponse(IfdMessageType pMessageType, ECardApiResu
 }
 
 
-IfdMessageResponse::IfdMessageResponse(const QJsonObject& pMessageObject)
+IfdMessageResponse::IfdMessageResponse(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mResultMajor(ECardApiResult::Major::Ok)
 	, mResultMinor(ECardApiResult::Minor::null)
@@ -18,11 +18,11 @@ class IfdMessageResponse
 		ECardApiResult::Minor mResultMinor;
 
 	protected:
-		[[nodiscard]] QJsonObject createMessageBody(const QString& pContextHandle) const override;
+		[[nodiscard]] QCborMap createMessageBody(const QString& pContextHandle) const override;
 
 	public:
 		IfdMessageResponse(IfdMessageType pType, ECardApiResult::Minor pResultMinor);
-		explicit IfdMessageResponse(const QJsonObject& pMessageObject);
+		explicit IfdMessageResponse(const QCborMap& pMessageObject);
 		~IfdMessageResponse() override = default;
 
 		[[nodiscard]] bool resultHasError() const;
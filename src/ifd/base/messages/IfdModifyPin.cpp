@@ -4,7 +4,6 @@
 
 #include "IfdModifyPin.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -29,15 +28,14 @@ IfdModifyPin::IfdModifyPin(const QString& pSlotHandle, const QByteArray& pInputD
 }
 
 
-IfdModifyPin::IfdModifyPin(const QJsonObject& pMessageObject)
+IfdModifyPin::IfdModifyPin(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotHandle()
 	, mInputData()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	const QString& inputData = getStringValue(pMessageObject, INPUT_DATA());
-	mInputData = QByteArray::fromHex(inputData.toUtf8());
+	mInputData = getByteArrayValue(pMessageObject, INPUT_DATA());
 
 	ensureType(IfdMessageType::IFDModifyPIN);
 }
@@ -61,12 +59,12 @@ const QByteArray& IfdModifyPin::getInputData() const
 }
 
 
-QByteArray IfdModifyPin::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdModifyPin::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
-	result[INPUT_DATA()] = QString::fromLatin1(mInputData.toHex());
+	result[INPUT_DATA()] = mInputData;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -4,7 +4,6 @@
 
 #include "IfdModifyPinResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -29,15 +28,14 @@ IfdModifyPinResponse::IfdModifyPinResponse(const QString& pSlotHandle, const QBy
 }
 
 
-IfdModifyPinResponse::IfdModifyPinResponse(const QJsonObject& pMessageObject)
+IfdModifyPinResponse::IfdModifyPinResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 	, mOutputData()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	const QString& inputData = getStringValue(pMessageObject, OUTPUT_DATA());
-	mOutputData = QByteArray::fromHex(inputData.toUtf8());
+	mOutputData = getByteArrayValue(pMessageObject, OUTPUT_DATA());
 
 	ensureType(IfdMessageType::IFDModifyPINResponse);
 }
@@ -92,12 +90,12 @@ CardReturnCode IfdModifyPinResponse::getReturnCode() const
 }
 
 
-QByteArray IfdModifyPinResponse::toByteArray(IfdVersion::Version, const QString& pContextHandle) const
+QByteArray IfdModifyPinResponse::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
-	result[OUTPUT_DATA()] = QString::fromLatin1(mOutputData.toHex());
+	result[OUTPUT_DATA()] = mOutputData;
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -19,7 +19,7 @@ class IfdModifyPinResponse
 
 	public:
 		IfdModifyPinResponse(const QString& pSlotHandle, const QByteArray& pOutputData, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdModifyPinResponse(const QJsonObject& pMessageObject);
+		explicit IfdModifyPinResponse(const QCborMap& pMessageObject);
 		~IfdModifyPinResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
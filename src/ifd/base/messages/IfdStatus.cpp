@@ -34,9 +34,9 @@ VALUE_NAME(EF_DIR, "EFDIR")
 } // namespace
 
 
-QJsonValue IfdStatus::createPaceCapabilities() const
+QCborMap IfdStatus::createPaceCapabilities() const
 {
-	QJsonObject result;
+	QCborMap result;
 	result[PIN_CAP_PACE()] = mHasPinPad;
 	result[PIN_CAP_EID()] = false;
 	result[PIN_CAP_ESIGN()] = false;
@@ -45,7 +45,7 @@ QJsonValue IfdStatus::createPaceCapabilities() const
 }
 
 
-void IfdStatus::parsePinPad(const QJsonObject& pMessageObject)
+void IfdStatus::parsePinPad(const QCborMap& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
@@ -53,10 +53,10 @@ void IfdStatus::parsePinPad(const QJsonObject& pMessageObject)
 	if (v0Supported && pMessageObject.contains(PIN_CAPABILITIES()))
 	{
 		pinPadFound = true;
-		QJsonValue value = pMessageObject.value(PIN_CAPABILITIES());
-		if (value.isObject())
+		const auto& value = pMessageObject.value(PIN_CAPABILITIES());
+		if (value.isMap())
 		{
-			QJsonObject object = value.toObject();
+			const QCborMap& object = value.toMap();
 			mHasPinPad = getBoolValue(object, PIN_CAP_PACE());
 			Q_UNUSED(getBoolValue(object, PIN_CAP_EID()))
 			Q_UNUSED(getBoolValue(object, PIN_CAP_ESIGN()))
@@ -108,7 +108,7 @@ IfdStatus::IfdStatus(const ReaderInfo& pReaderInfo, bool pPublishCard)
 }
 
 
-IfdStatus::IfdStatus(const QJsonObject& pMessageObject)
+IfdStatus::IfdStatus(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotName()
 	, mHasPinPad(false)
@@ -165,7 +165,7 @@ bool IfdStatus::getCardAvailable() const
 
 QByteArray IfdStatus::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_NAME()] = mSlotName;
 	if (pIfdVersion >= IfdVersion::Version::v2)
@@ -179,8 +179,8 @@ QByteArray IfdStatus::toByteArray(IfdVersion::Version pIfdVersion, const QString
 	result[MAX_APDU_LENGTH()] = mMaxApduLength;
 	result[CONNECTED_READER()] = mConnectedReader;
 	result[CARD_AVAILABLE()] = mCardAvailable;
-	result[EF_ATR()] = QJsonValue();
-	result[EF_DIR()] = QJsonValue();
+	result[EF_ATR()] = QCborValue(nullptr);
+	result[EF_DIR()] = QCborValue(nullptr);
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -7,8 +7,6 @@
 #include "IfdMessage.h"
 #include "ReaderInfo.h"
 
-#include <QJsonObject>
-
 
 class test_RemoteIfdReaderManagerPlugin;
 
@@ -29,12 +27,12 @@ class IfdStatus
 		bool mConnectedReader;
 		bool mCardAvailable;
 
-		[[nodiscard]] QJsonValue createPaceCapabilities() const;
-		void parsePinPad(const QJsonObject& pMessageObject);
+		[[nodiscard]] QCborMap createPaceCapabilities() const;
+		void parsePinPad(const QCborMap& pMessageObject);
 
 	public:
 		explicit IfdStatus(const ReaderInfo& pReaderInfo, bool pPublishCard = true);
-		explicit IfdStatus(const QJsonObject& pMessageObject);
+		explicit IfdStatus(const QCborMap& pMessageObject);
 		~IfdStatus() override = default;
 
 		[[nodiscard]] const QString& getSlotName() const;
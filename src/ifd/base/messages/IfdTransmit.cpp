@@ -5,8 +5,7 @@
 
 #include "IfdTransmit.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
+#include <QCborArray>
 #include <QLoggingCategory>
 
 
@@ -23,10 +22,11 @@ VALUE_NAME(COMMAND_APDUS, "CommandAPDUs")
 VALUE_NAME(INPUT_APDU, "InputAPDU")
 VALUE_NAME(DISPLAY_TEXT, "DisplayText")
 VALUE_NAME(ACCEPTABLE_STATUS_CODES, "AcceptableStatusCodes")
+VALUE_NAME(INPUT_APDU_INFOS, "InputAPDUInfos")
 } // namespace
 
 
-void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
+void IfdTransmit::parseInputApdu(const QCborMap& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
@@ -38,11 +38,9 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 		if (value.isArray())
 		{
 			const auto& entry = value.toArray().at(0);
-			if (entry.isObject())
+			if (entry.isMap())
 			{
-				const QJsonObject& commandApdu = entry.toObject();
-				const QString& inputApdu = getStringValue(commandApdu, INPUT_APDU());
-				mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
+				mInputApdu = getByteArrayValue(entry.toMap(), INPUT_APDU());
 			}
 			else
 			{
@@ -63,8 +61,7 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 	if (!v0Supported || pMessageObject.contains(INPUT_APDU()))
 	{
 		inputApduFound = true;
-		const QString& inputApdu = getStringValue(pMessageObject, INPUT_APDU());
-		mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
+		mInputApdu = getByteArrayValue(pMessageObject, INPUT_APDU());
 	}
 
 	if (!inputApduFound)
@@ -75,24 +72,89 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 }
 
 
+void IfdTransmit::parseInputApduInfos(const QCborMap& pMessageObject)
+{
+	const auto& value = pMessageObject.value(INPUT_APDU_INFOS());
+	if (!value.isArray() || value.toArray().isEmpty())
+	{
+		invalidType(INPUT_APDU_INFOS(), QLatin1String("non-empty object array"));
+		return;
+	}
+
+	const auto& entries = value.toArray();
+	for (const auto& entry : entries)
+	{
+		if (!entry.isMap())
+		{
+			invalidType(INPUT_APDU_INFOS(), QLatin1String("object array"));
+			mInputApduInfos.clear();
+			return;
+		}
+
+		const QCborMap& object = entry.toMap();
+		InputAPDUInfo inputApduInfo(getByteArrayValue(object, INPUT_APDU()));
+
+		const auto& codes = object.value(ACCEPTABLE_STATUS_CODES());
+		if (codes.isArray())
+		{
+			for (const auto& code : codes.toArray())
+			{
+				if (!code.isString())
+				{
+					invalidType(ACCEPTABLE_STATUS_CODES(), QLatin1String("string array"));
+					continue;
+				}
+				inputApduInfo.addAcceptableStatusCode(code.toString().toLatin1());
+			}
+		}
+		else if (!codes.isUndefined() && !codes.isNull())
+		{
+			invalidType(ACCEPTABLE_STATUS_CODES(), QLatin1String("string array"));
+		}
+
+		mInputApduInfos += inputApduInfo;
+	}
+}
+
+
 IfdTransmit::IfdTransmit(const QString& pSlotHandle, const QByteArray& pInputApdu, const QString& pDisplayText)
 	: IfdMessage(IfdMessageType::IFDTransmit)
 	, mSlotHandle(pSlotHandle)
 	, mInputApdu(pInputApdu)
+	, mInputApduInfos()
+	, mDisplayText(pDisplayText)
+{
+}
+
+
+IfdTransmit::IfdTransmit(const QString& pSlotHandle, const QList<InputAPDUInfo>& pInputApduInfos, const QString& pDisplayText)
+	: IfdMessage(IfdMessageType::IFDTransmit)
+	, mSlotHandle(pSlotHandle)
+	, mInputApdu()
+	, mInputApduInfos(pInputApduInfos)
 	, mDisplayText(pDisplayText)
 {
+	Q_ASSERT(!mInputApduInfos.isEmpty());
 }
 
 
-IfdTransmit::IfdTransmit(const QJsonObject& pMessageObject)
+IfdTransmit::IfdTransmit(const QCborMap& pMessageObject)
 	: IfdMessage(pMessageObject)
 	, mSlotHandle()
 	, mInputApdu()
+	, mInputApduInfos()
 	, mDisplayText()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	parseInputApdu(pMessageObject);
+	if (pMessageObject.contains(INPUT_APDU_INFOS()))
+	{
+		parseInputApduInfos(pMessageObject);
+	}
+	else
+	{
+		parseInputApdu(pMessageObject);
+	}
 
 	if (pMessageObject.contains(DISPLAY_TEXT()))
 	{
@@ -115,6 +177,23 @@ const QByteArray& IfdTransmit::getInputApdu() const
 }
 
 
+bool IfdTransmit::isBatch() const
+{
+	return !mInputApduInfos.isEmpty();
+}
+
+
+QList<InputAPDUInfo> IfdTransmit::getInputApduInfos() const
+{
+	if (isBatch())
+	{
+		return mInputApduInfos;
+	}
+
+	return {InputAPDUInfo(mInputApdu)};
+}
+
+
 const QString& IfdTransmit::getDisplayText() const
 {
 	return mDisplayText;
@@ -123,13 +202,37 @@ const QString& IfdTransmit::getDisplayText() const
 
 QByteArray IfdTransmit::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	if (pIfdVersion >= IfdVersion::Version::v2)
+	Q_ASSERT(!isBatch() || pIfdVersion >= IfdVersion::Version::v3);
+
+	if (isBatch())
+	{
+		QCborArray inputApduInfos;
+		for (const auto& inputApduInfo : std::as_const(mInputApduInfos))
+		{
+			QCborArray acceptableStatusCodes;
+			for (const auto& code : inputApduInfo.getAcceptableStatusCodes())
+			{
+				acceptableStatusCodes += QString::fromLatin1(code);
+			}
+
+			QCborMap entry;
+			entry[INPUT_APDU()] = QByteArray(inputApduInfo.getInputApdu());
+			entry[ACCEPTABLE_STATUS_CODES()] = acceptableStatusCodes;
+			inputApduInfos += entry;
+		}
+		result[INPUT_APDU_INFOS()] = inputApduInfos;
+		if (!mDisplayText.isNull())
+		{
+			result[DISPLAY_TEXT()] = mDisplayText;
+		}
+	}
+	else if (pIfdVersion >= IfdVersion::Version::v2)
 	{
-		result[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
+		result[INPUT_APDU()] = mInputApdu;
 		if (!mDisplayText.isNull())
 		{
 			result[DISPLAY_TEXT()] = mDisplayText;
@@ -137,13 +240,13 @@ QByteArray IfdTransmit::toByteArray(IfdVersion::Version pIfdVersion, const QStri
 	}
 	else
 	{
-		QJsonArray commandApdus;
-		QJsonObject commandApdu;
-		commandApdu[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
-		commandApdu[ACCEPTABLE_STATUS_CODES()] = QJsonValue();
+		QCborArray commandApdus;
+		QCborMap commandApdu;
+		commandApdu[INPUT_APDU()] = mInputApdu;
+		commandApdu[ACCEPTABLE_STATUS_CODES()] = QCborValue(nullptr);
 		commandApdus += commandApdu;
 		result[COMMAND_APDUS()] = commandApdus;
 	}
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -5,8 +5,10 @@
 #pragma once
 
 #include "IfdMessage.h"
+#include "InputAPDUInfo.h"
 
 #include <QByteArray>
+#include <QList>
 
 
 namespace governikus
@@ -17,17 +19,22 @@ class IfdTransmit
 	private:
 		QString mSlotHandle;
 		QByteArray mInputApdu;
+		QList<InputAPDUInfo> mInputApduInfos;
 		QString mDisplayText;
 
-		void parseInputApdu(const QJsonObject& pMessageObject);
+		void parseInputApdu(const QCborMap& pMessageObject);
+		void parseInputApduInfos(const QCborMap& pMessageObject);
 
 	public:
 		IfdTransmit(const QString& pSlotHandle, const QByteArray& pInputApdu, const QString& pDisplayText = QString());
-		explicit IfdTransmit(const QJsonObject& pMessageObject);
+		IfdTransmit(const QString& pSlotHandle, const QList<InputAPDUInfo>& pInputApduInfos, const QString& pDisplayText = QString());
+		explicit IfdTransmit(const QCborMap& pMessageObject);
 		~IfdTransmit() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
 		[[nodiscard]] const QByteArray& getInputApdu() const;
+		[[nodiscard]] bool isBatch() const;
+		[[nodiscard]] QList<InputAPDUInfo> getInputApduInfos() const;
 		[[nodiscard]] const QString& getDisplayText() const;
 		[[nodiscard]] QByteArray toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const override;
 };
@@ -5,8 +5,7 @@
 
 #include "IfdTransmitResponse.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
+#include <QCborArray>
 #include <QLoggingCategory>
 
 
@@ -21,10 +20,11 @@ namespace
 VALUE_NAME(SLOT_HANDLE, "SlotHandle")
 VALUE_NAME(RESPONSE_APDU, "ResponseAPDU")
 VALUE_NAME(RESPONSE_APDUS, "ResponseAPDUs")
+VALUE_NAME(OUTPUT_APDUS, "OutputAPDUs")
 } // namespace
 
 
-void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
+void IfdTransmitResponse::parseResponseApdu(const QCborMap& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
@@ -36,9 +36,9 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 		if (value.isArray())
 		{
 			const auto& inputApduValue = value.toArray().at(0);
-			if (inputApduValue.isString())
+			if (inputApduValue.isByteArray())
 			{
-				mResponseApdu = QByteArray::fromHex(inputApduValue.toString().toUtf8());
+				mResponseApdu = inputApduValue.toByteArray();
 			}
 			else
 			{
@@ -59,8 +59,7 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 	if (!v0Supported || pMessageObject.contains(RESPONSE_APDU()))
 	{
 		responseApduFound = true;
-		const QString& responseApdu = getStringValue(pMessageObject, RESPONSE_APDU());
-		mResponseApdu = QByteArray::fromHex(responseApdu.toUtf8());
+		mResponseApdu = getByteArrayValue(pMessageObject, RESPONSE_APDU());
 	}
 
 	if (!responseApduFound)
@@ -71,22 +70,68 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 }
 
 
+void IfdTransmitResponse::parseOutputApdus(const QCborMap& pMessageObject)
+{
+	mBatch = true;
+
+	const auto& value = pMessageObject.value(OUTPUT_APDUS());
+	if (!value.isArray())
+	{
+		invalidType(OUTPUT_APDUS(), QLatin1String("string array"));
+		return;
+	}
+
+	const auto& entries = value.toArray();
+	for (const auto& entry : entries)
+	{
+		if (!entry.isByteArray())
+		{
+			invalidType(OUTPUT_APDUS(), QLatin1String("string array"));
+			mOutputApdus.clear();
+			return;
+		}
+		mOutputApdus += entry.toByteArray();
+	}
+}
+
+
 IfdTransmitResponse::IfdTransmitResponse(const QString& pSlotHandle, const QByteArray& pResponseApdu, ECardApiResult::Minor pResultMinor)
 	: IfdMessageResponse(IfdMessageType::IFDTransmitResponse, pResultMinor)
 	, mSlotHandle(pSlotHandle)
 	, mResponseApdu(pResponseApdu)
+	, mOutputApdus()
+	, mBatch(false)
+{
+}
+
+
+IfdTransmitResponse::IfdTransmitResponse(const QString& pSlotHandle, const QByteArrayList& pOutputApdus, ECardApiResult::Minor pResultMinor)
+	: IfdMessageResponse(IfdMessageType::IFDTransmitResponse, pResultMinor)
+	, mSlotHandle(pSlotHandle)
+	, mResponseApdu()
+	, mOutputApdus(pOutputApdus)
+	, mBatch(true)
 {
 }
 
 
-IfdTransmitResponse::IfdTransmitResponse(const QJsonObject& pMessageObject)
+IfdTransmitResponse::IfdTransmitResponse(const QCborMap& pMessageObject)
 	: IfdMessageResponse(pMessageObject)
 	, mSlotHandle()
 	, mResponseApdu()
+	, mOutputApdus()
+	, mBatch(false)
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	parseResponseApdu(pMessageObject);
+	if (pMessageObject.contains(OUTPUT_APDUS()))
+	{
+		parseOutputApdus(pMessageObject);
+	}
+	else
+	{
+		parseResponseApdu(pMessageObject);
+	}
 
 	ensureType(IfdMessageType::IFDTransmitResponse);
 }
@@ -104,22 +149,50 @@ const QByteArray& IfdTransmitResponse::getResponseApdu() const
 }
 
 
+bool IfdTransmitResponse::isBatch() const
+{
+	return mBatch;
+}
+
+
+QByteArrayList IfdTransmitResponse::getOutputApdus() const
+{
+	if (mBatch)
+	{
+		return mOutputApdus;
+	}
+
+	return {mResponseApdu};
+}
+
+
 QByteArray IfdTransmitResponse::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	QCborMap result = createMessageBody(pContextHandle);
 
 	result[SLOT_HANDLE()] = mSlotHandle;
 
-	if (pIfdVersion >= IfdVersion::Version::v2)
+	Q_ASSERT(!mBatch || pIfdVersion >= IfdVersion::Version::v3);
+
+	if (mBatch)
+	{
+		QCborArray outputApdus;
+		for (const auto& outputApdu : std::as_const(mOutputApdus))
+		{
+			outputApdus += outputApdu;
+		}
+		result[OUTPUT_APDUS()] = outputApdus;
+	}
+	else if (pIfdVersion >= IfdVersion::Version::v2)
 	{
-		result[RESPONSE_APDU()] = QString::fromLatin1(mResponseApdu.toHex());
+		result[RESPONSE_APDU()] = mResponseApdu;
 	}
 	else
 	{
-		QJsonArray responseApdus;
-		responseApdus += QString::fromLatin1(mResponseApdu.toHex());
+		QCborArray responseApdus;
+		responseApdus += mResponseApdu;
 		result[RESPONSE_APDUS()] = responseApdus;
 	}
 
-	return IfdMessage::toByteArray(result);
+	return IfdMessage::toByteArray(pIfdVersion, result);
 }
@@ -7,6 +7,7 @@
 #include "IfdMessageResponse.h"
 
 #include <QByteArray>
+#include <QByteArrayList>
 
 
 namespace governikus
@@ -17,16 +18,22 @@ class IfdTransmitResponse
 	private:
 		QString mSlotHandle;
 		QByteArray mResponseApdu;
+		QByteArrayList mOutputApdus;
+		bool mBatch;
 
-		void parseResponseApdu(const QJsonObject& pMessageObject);
+		void parseResponseApdu(const QCborMap& pMessageObject);
+		void parseOutputApdus(const QCborMap& pMessageObject);
 
 	public:
 		IfdTransmitResponse(const QString& pSlotHandle, const QByteArray& pResponseApdu = QByteArray(), ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdTransmitResponse(const QJsonObject& pMessageObject);
+		IfdTransmitResponse(const QString& pSlotHandle, const QByteArrayList& pOutputApdus, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
+		explicit IfdTransmitResponse(const QCborMap& pMessageObject);
 		~IfdTransmitResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
 		[[nodiscard]] const QByteArray& getResponseApdu() const;
+		[[nodiscard]] bool isBatch() const;
+		[[nodiscard]] QByteArrayList getOutputApdus() const;
 		[[nodiscard]] QByteArray toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const override;
 };
 
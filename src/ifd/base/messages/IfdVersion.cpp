@@ -21,6 +21,16 @@ IfdVersion::Version IfdVersion::fromString(const QString& pVersionString)
 		return Version::v2;
 	}
 
+	if (pVersionString == IfdVersion(Version::v3).toString())
+	{
+		return Version::v3;
+	}
+
+	if (pVersionString == IfdVersion(Version::v4).toString())
+	{
+		return Version::v4;
+	}
+
 	return Version::Unknown;
 }
 
@@ -61,6 +71,12 @@ QString IfdVersion::toString() const
 
 		case IfdVersion::Version::v2:
 			return QStringLiteral("IFDInterface_WebSocket_v2");
+
+		case IfdVersion::Version::v3:
+			return QStringLiteral("IFDInterface_WebSocket_v3");
+
+		case IfdVersion::Version::v4:
+			return QStringLiteral("IFDInterface_WebSocket_v4");
 	}
 
 	Q_UNREACHABLE();
@@ -69,7 +85,7 @@ QString IfdVersion::toString() const
 
 QList<IfdVersion::Version> IfdVersion::supported()
 {
-	return QList<IfdVersion::Version>({Version::v2});
+	return QList<IfdVersion::Version>({Version::v2, Version::v3, Version::v4});
 }
 
 
@@ -96,6 +112,12 @@ bool IfdVersion::isSupported() const
 }
 
 
+bool IfdVersion::isBinaryFraming() const
+{
+	return mVersion >= Version::v4;
+}
+
+
 bool IfdVersion::operator==(const IfdVersion& pOther) const
 {
 	return mVersion == pOther.mVersion;
@@ -18,7 +18,9 @@ class IfdVersion
 			Unknown = -1,
 			v0,
 			v2,
-			latest = v2
+			v3,
+			v4,
+			latest = v4
 		};
 
 	private:
@@ -33,6 +35,7 @@ class IfdVersion
 		[[nodiscard]] Version getVersion() const;
 		[[nodiscard]] bool isValid() const;
 		[[nodiscard]] bool isSupported() const;
+		[[nodiscard]] bool isBinaryFraming() const;
 
 		bool operator==(const IfdVersion& pOther) const;
 		bool operator!=(const IfdVersion& pOther) const;
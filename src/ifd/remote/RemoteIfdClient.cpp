@@ -9,8 +9,7 @@
 #include "ReaderManager.h"
 #include "messages/Discovery.h"
 
-#include <QJsonDocument>
-#include <QJsonObject>
+#include <QCborMap>
 #include <QLoggingCategory>
 
 
@@ -40,7 +39,7 @@ RemoteIfdClient::RemoteIfdClient()
 
 void RemoteIfdClient::onNewMessage(const QByteArray& pData, const QHostAddress& pAddress)
 {
-	QJsonObject obj;
+	QCborMap obj;
 	{
 		obj = IfdMessage::parseByteArray(pData);
 	}
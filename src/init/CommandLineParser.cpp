@@ -27,11 +27,16 @@ CommandLineParser::CommandLineParser()
 	, mOptionKeepLog(QStringLiteral("keep"), QStringLiteral("Keep logfile."))
 	, mOptionNoLogFile(QStringLiteral("no-logfile"), QStringLiteral("Disable logfile."))
 	, mOptionNoLogHandler(QStringLiteral("no-loghandler"), QStringLiteral("Disable default log handler."))
+	, mOptionAsyncLog(QStringLiteral("async-log"), QStringLiteral("Write log asynchronously."))
+	, mOptionBinaryLog(QStringLiteral("binary-log"), QStringLiteral("Write logfile in binary format."))
 	, mOptionShowWindow(QStringLiteral("show"), QStringLiteral("Show window on startup."))
 	, mOptionProxy(QStringLiteral("no-proxy"), QStringLiteral("Ignore proxy settings."))
 	, mOptionUi(QStringLiteral("ui"), QStringLiteral("Use given UI plugin."), UiLoader::getDefault())
 	, mOptionPort(QStringLiteral("port"), QStringLiteral("Use listening port."), QString::number(PortFile::cDefaultPort))
 	, mOptionAddresses(QStringLiteral("address"), QStringLiteral("Use address binding."), HttpServer::getDefault())
+#ifdef CONTAINER_SDK
+	, mOptionWorkflows(QStringLiteral("workflows"), QStringLiteral("Run given count of workflows concurrently."), QString::number(AppController::cMaxConcurrentWorkflows))
+#endif
 {
 	addOptions();
 }
@@ -45,6 +50,8 @@ void CommandLineParser::addOptions()
 	mParser.addOption(mOptionKeepLog);
 	mParser.addOption(mOptionNoLogFile);
 	mParser.addOption(mOptionNoLogHandler);
+	mParser.addOption(mOptionAsyncLog);
+	mParser.addOption(mOptionBinaryLog);
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS) && !defined(Q_OS_WINRT)
 	mParser.addOption(mOptionShowWindow);
@@ -54,6 +61,10 @@ void CommandLineParser::addOptions()
 	mParser.addOption(mOptionUi);
 	mParser.addOption(mOptionPort);
 	mParser.addOption(mOptionAddresses);
+
+#ifdef CONTAINER_SDK
+	mParser.addOption(mOptionWorkflows);
+#endif
 }
 
 
@@ -69,8 +80,10 @@ void CommandLineParser::parse(const QCoreApplication* pApp)
 
 	auto* logHandler = Env::getSingleton<LogHandler>();
 	logHandler->setAutoRemove(!mParser.isSet(mOptionKeepLog));
+	logHandler->setBinaryLog(mParser.isSet(mOptionBinaryLog));
 	logHandler->setLogFile(!mParser.isSet(mOptionNoLogFile));
 	logHandler->setUseHandler(!mParser.isSet(mOptionNoLogHandler));
+	logHandler->setAsync(mParser.isSet(mOptionAsyncLog));
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS) && !defined(Q_OS_WINRT)
 	AppController::cShowUi = mParser.isSet(mOptionShowWindow);
@@ -88,6 +101,18 @@ void CommandLineParser::parse(const QCoreApplication* pApp)
 		}
 	}
 
+#ifdef CONTAINER_SDK
+	if (mParser.isSet(mOptionWorkflows))
+	{
+		bool converted = false;
+		const int workflows = mParser.value(mOptionWorkflows).toInt(&converted);
+		if (converted && workflows > 0)
+		{
+			AppController::cMaxConcurrentWorkflows = workflows;
+		}
+	}
+#endif
+
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
 	if (mParser.isSet(mOptionAddresses))
 	{
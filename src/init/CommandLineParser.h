@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "config.h"
+
 #include <QCommandLineParser>
 #include <QCoreApplication>
 
@@ -23,11 +25,16 @@ class CommandLineParser
 		const QCommandLineOption mOptionKeepLog;
 		const QCommandLineOption mOptionNoLogFile;
 		const QCommandLineOption mOptionNoLogHandler;
+		const QCommandLineOption mOptionAsyncLog;
+		const QCommandLineOption mOptionBinaryLog;
 		const QCommandLineOption mOptionShowWindow;
 		const QCommandLineOption mOptionProxy;
 		const QCommandLineOption mOptionUi;
 		const QCommandLineOption mOptionPort;
 		const QCommandLineOption mOptionAddresses;
+#ifdef CONTAINER_SDK
+		const QCommandLineOption mOptionWorkflows;
+#endif
 
 		void addOptions();
 		void parseUiPlugin();
@@ -17,14 +17,20 @@ HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
 	, mUrl()
 	, mHeader()
 	, mBody()
+	, mBodyConsumer()
 	, mSocket(pSocket)
 	, mParser()
 	, mParserSettings()
 	, mFinished(false)
+	, mKeepAlive(false)
+	, mReusable(true)
+	, mResponded(false)
+	, mMessageSize(0)
 	, mCurrentHeaderField()
 	, mCurrentHeaderValue()
 {
 	Q_ASSERT(mSocket);
+	mHeader.reserve(16);
 	mSocket->setParent(this);
 	mSocket->startTransaction();
 
@@ -46,6 +52,7 @@ HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
 
 QTcpSocket* HttpRequest::take()
 {
+	mReusable = false;
 	mSocket->disconnect(this);
 	auto socket = mSocket;
 	socket->setParent(nullptr);
@@ -93,11 +100,20 @@ bool HttpRequest::isUpgrade() const
 
 QByteArray HttpRequest::getHeader(const QByteArray& pKey) const
 {
-	return mHeader.value(pKey);
+	// The last header wins if a client sends it twice.
+	for (auto iter = mHeader.crbegin(); iter != mHeader.crend(); ++iter)
+	{
+		if (iter->first.compare(pKey, Qt::CaseInsensitive) == 0)
+		{
+			return iter->second;
+		}
+	}
+
+	return QByteArray();
 }
 
 
-const QMap<QByteArray, QByteArray>& HttpRequest::getHeader() const
+const QList<HttpRequest::Header>& HttpRequest::getHeader() const
 {
 	return mHeader;
 }
@@ -115,6 +131,12 @@ const QByteArray& HttpRequest::getBody() const
 }
 
 
+void HttpRequest::setBodyConsumer(const BodyConsumer& pConsumer)
+{
+	mBodyConsumer = pConsumer;
+}
+
+
 quint16 HttpRequest::getPeerPort() const
 {
 	return mSocket->peerPort();
@@ -135,18 +157,34 @@ void HttpRequest::triggerSocketBuffer()
 
 bool HttpRequest::send(const HttpResponse& pResponse)
 {
-	return send(pResponse.getMessage());
+	if (!mKeepAlive || !mReusable)
+	{
+		return write(pResponse.getMessage());
+	}
+
+	HttpResponse response(pResponse);
+	response.setHeader(QByteArrayLiteral("Connection"), QByteArrayLiteral("keep-alive"));
+	mResponded = write(response.getMessage());
+	return mResponded;
 }
 
 
 bool HttpRequest::send(const QByteArray& pResponse)
+{
+	// The end of a raw response is unknown, so the connection cannot be used again.
+	mReusable = false;
+	return write(pResponse);
+}
+
+
+bool HttpRequest::write(const QByteArray& pData)
 {
 	if (!mSocket)
 	{
 		return false;
 	}
 
-	if (mSocket->write(pResponse) != pResponse.size())
+	if (mSocket->write(pData) != pData.size())
 	{
 		qCCritical(network) << "Cannot write response:" << mSocket->error() << '|' << mSocket->errorString();
 		return false;
@@ -156,6 +194,28 @@ bool HttpRequest::send(const QByteArray& pResponse)
 }
 
 
+void HttpRequest::preventKeepAlive()
+{
+	mReusable = false;
+}
+
+
+bool HttpRequest::isKeepAlive() const
+{
+	return mFinished && mKeepAlive && mReusable && mResponded && isConnected();
+}
+
+
+QTcpSocket* HttpRequest::takeForNextRequest()
+{
+	Q_ASSERT(isKeepAlive());
+
+	// The transaction was rolled back, so the data of the next request follows this request.
+	mSocket->skip(mMessageSize);
+	return take();
+}
+
+
 void HttpRequest::onReadyRead()
 {
 	if (!mSocket)
@@ -165,6 +225,7 @@ void HttpRequest::onReadyRead()
 
 	if (mFinished)
 	{
+		mReusable = false;
 		while (mSocket->bytesAvailable())
 		{
 			Q_EMIT fireSocketBuffer(mSocket->readAll());
@@ -172,18 +233,31 @@ void HttpRequest::onReadyRead()
 		return;
 	}
 
-	while (mSocket->bytesAvailable())
+	while (!mFinished && mSocket->bytesAvailable())
 	{
 		const auto& buffer = mSocket->readAll();
-		http_parser_execute(&mParser, &mParserSettings, buffer.constData(), static_cast<size_t>(buffer.size()));
+		mMessageSize += static_cast<qint64>(http_parser_execute(&mParser, &mParserSettings, buffer.constData(), static_cast<size_t>(buffer.size())));
 
 		// See macro HTTP_PARSER_ERRNO if http_errno fails.
 		// We do not use this to avoid -Wold-style-cast warning
 		const auto errorCode = static_cast<http_errno>(mParser.http_errno);
-		if (errorCode != HPE_OK)
+		if (errorCode == HPE_PAUSED)
+		{
+			// The parser pauses after a message, a pipelined request is parsed by the next HttpRequest.
+			http_parser_pause(&mParser, 0);
+		}
+		else if (errorCode != HPE_OK)
 		{
 			qCWarning(network) << "Http request not well-formed:" << http_errno_name(errorCode) << '|' << http_errno_description(errorCode);
 		}
+
+		if (mBodyConsumer && !mFinished && !isUpgrade())
+		{
+			// The parsed data is not needed again, so the transaction must not keep the body.
+			mSocket->commitTransaction();
+			mSocket->startTransaction();
+			mMessageSize = 0;
+		}
 	}
 
 	if (mFinished)
@@ -209,6 +283,8 @@ int HttpRequest::onMessageComplete(http_parser* pParser)
 {
 	CAST_OBJ(pParser)
 	obj->mFinished = true;
+	obj->mKeepAlive = !pParser->upgrade && http_should_keep_alive(pParser) != 0;
+	http_parser_pause(pParser, 1);
 	qCDebug(network) << "Message completed";
 	return 0;
 }
@@ -220,6 +296,7 @@ int HttpRequest::onHeadersComplete(http_parser* pParser)
 	obj->insertHeader();
 	qCDebug(network) << obj->getMethod() << '|' << obj->getUrl();
 	qCDebug(network) << "Header completed";
+	Q_EMIT obj->fireHeadersComplete(obj);
 	return 0;
 }
 
@@ -244,6 +321,12 @@ int HttpRequest::onHeaderValue(http_parser* pParser, const char* const pPos, siz
 int HttpRequest::onBody(http_parser* pParser, const char* const pPos, size_t pLength)
 {
 	CAST_OBJ(pParser)
+	if (obj->mBodyConsumer)
+	{
+		obj->mBodyConsumer(QByteArrayView(pPos, static_cast<qsizetype>(pLength)));
+		return 0;
+	}
+
 	add(obj->mBody, pPos, pLength);
 	return 0;
 }
@@ -262,7 +345,7 @@ void HttpRequest::insertHeader()
 	if (!mCurrentHeaderField.isEmpty() && !mCurrentHeaderValue.isEmpty())
 	{
 		qCDebug(network).nospace() << "Header | " << mCurrentHeaderField << ": " << mCurrentHeaderValue;
-		mHeader.insert(mCurrentHeaderField.toLower(), mCurrentHeaderValue);
+		mHeader += qMakePair(mCurrentHeaderField, mCurrentHeaderValue);
 		mCurrentHeaderField.clear();
 		mCurrentHeaderValue.clear();
 	}
@@ -4,6 +4,12 @@
 
 /*!
  * \brief Class to parse http request.
+ *
+ * The body is collected by getBody() unless a BodyConsumer is set after the
+ * headers are received, see fireHeadersComplete(). A consumed body is not
+ * kept by the socket. If the client requests a persistent connection the
+ * HttpServer parses the next request of the same connection after this
+ * request is released, see isKeepAlive().
  */
 
 #pragma once
@@ -11,14 +17,17 @@
 #include "HttpResponse.h"
 
 #include <QByteArray>
-#include <QMap>
+#include <QByteArrayView>
+#include <QList>
 #include <QObject>
+#include <QPair>
 #include <QPointer>
 #include <QTcpSocket>
 #include <QUrl>
 
 #include <http_parser.h>
 
+#include <functional>
 #include <memory>
 
 
@@ -35,6 +44,10 @@ class HttpRequest
 	friend class HttpServer;
 	friend class ::test_HttpRequest;
 
+	public:
+		using Header = QPair<QByteArray, QByteArray>;
+		using BodyConsumer = std::function<void (QByteArrayView pChunk)>;
+
 	private:
 		[[nodiscard]] static int onMessageBegin(http_parser* pParser);
 		[[nodiscard]] static int onMessageComplete(http_parser* pParser);
@@ -46,22 +59,29 @@ class HttpRequest
 
 		static inline void add(QByteArray& pDest, const char* const pPos, size_t pLength)
 		{
-			pDest += QByteArray(pPos, static_cast<int>(pLength));
+			pDest.append(pPos, static_cast<qsizetype>(pLength));
 		}
 
 
 		QByteArray mUrl;
-		QMap<QByteArray, QByteArray> mHeader;
+		QList<Header> mHeader;
 		QByteArray mBody;
+		BodyConsumer mBodyConsumer;
 		QPointer<QTcpSocket> mSocket;
 		http_parser mParser;
 		http_parser_settings mParserSettings;
 
 		bool mFinished;
+		bool mKeepAlive;
+		bool mReusable;
+		bool mResponded;
+		qint64 mMessageSize;
 		QByteArray mCurrentHeaderField;
 		QByteArray mCurrentHeaderValue;
 
 		void insertHeader();
+		void preventKeepAlive();
+		bool write(const QByteArray& pData);
 
 	public:
 		HttpRequest(QTcpSocket* pSocket, QObject* pParent = nullptr);
@@ -73,9 +93,10 @@ class HttpRequest
 		[[nodiscard]] http_method getHttpMethod() const;
 		[[nodiscard]] bool isUpgrade() const;
 		[[nodiscard]] QByteArray getHeader(const QByteArray& pKey) const;
-		[[nodiscard]] const QMap<QByteArray, QByteArray>& getHeader() const;
+		[[nodiscard]] const QList<Header>& getHeader() const;
 		[[nodiscard]] QUrl getUrl() const;
 		[[nodiscard]] const QByteArray& getBody() const;
+		void setBodyConsumer(const BodyConsumer& pConsumer);
 		[[nodiscard]] quint16 getPeerPort() const;
 		[[nodiscard]] quint16 getLocalPort() const;
 		void triggerSocketBuffer();
@@ -83,12 +104,20 @@ class HttpRequest
 		bool send(const HttpResponse& pResponse);
 		bool send(const QByteArray& pResponse);
 
+		/*!
+		 * \brief Returns true if the connection can be used for the next request.
+		 * This requires that the client asked for it and a HttpResponse was sent.
+		 */
+		[[nodiscard]] bool isKeepAlive() const;
+
 		QTcpSocket* take();
+		QTcpSocket* takeForNextRequest();
 
 	private Q_SLOTS:
 		void onReadyRead();
 
 	Q_SIGNALS:
+		void fireHeadersComplete(HttpRequest* pSelf);
 		void fireMessageComplete(HttpRequest* pSelf);
 		void fireSocketStateChanged(QAbstractSocket::SocketState pSocketState);
 		void fireSocketBuffer(const QByteArray& pBuffer);
@@ -5,7 +5,9 @@
 #include "HttpServer.h"
 
 #include <QLoggingCategory>
+#include <QPointer>
 #include <QTcpSocket>
+#include <QTimer>
 
 using namespace governikus;
 
@@ -14,12 +16,15 @@ Q_DECLARE_LOGGING_CATEGORY(network)
 
 quint16 HttpServer::cPort = PortFile::cDefaultPort;
 QList<QHostAddress> HttpServer::cAddresses = {QHostAddress::LocalHost, QHostAddress::LocalHostIPv6};
+int HttpServer::cKeepAliveTimeout = 5000;
+int HttpServer::cMaxKeepAliveConnections = 10;
 
 
 HttpServer::HttpServer(quint16 pPort, const QList<QHostAddress>& pAddresses)
 	: QObject()
 	, mServer()
 	, mPortFile()
+	, mKeptAliveRequests()
 {
 	bindAddresses(pPort, pAddresses);
 }
@@ -137,14 +142,65 @@ void HttpServer::onNewConnection()
 	{
 		while (server->hasPendingConnections())
 		{
-			auto* request = new HttpRequest(server->nextPendingConnection(), this);
-			connect(request, &HttpRequest::fireMessageComplete, this, &HttpServer::onMessageComplete);
-			request->triggerSocketBuffer();
+			addRequest(server->nextPendingConnection());
 		}
 	}
 }
 
 
+void HttpServer::addRequest(QTcpSocket* pSocket, bool pKeptAlive)
+{
+	auto* request = new HttpRequest(pSocket, this);
+	connect(request, &HttpRequest::fireHeadersComplete, this, &HttpServer::fireNewHttpRequestHeaders);
+	connect(request, &HttpRequest::fireMessageComplete, this, &HttpServer::onMessageComplete);
+	connect(request, &HttpRequest::fireSocketStateChanged, this, [this, request](QAbstractSocket::SocketState pSocketState){
+			// A request is owned by the server until it is complete.
+			if (pSocketState == QAbstractSocket::UnconnectedState && request->parent() == this)
+			{
+				request->deleteLater();
+			}
+		});
+
+	if (pKeptAlive)
+	{
+		mKeptAliveRequests += request;
+		connect(request, &QObject::destroyed, this, [this, request]{
+				mKeptAliveRequests -= request;
+			});
+
+		QTimer::singleShot(cKeepAliveTimeout, request, [this, request]{
+				if (request->parent() == this)
+				{
+					qCDebug(network) << "Close idle connection";
+					request->deleteLater();
+				}
+			});
+	}
+
+	request->triggerSocketBuffer();
+}
+
+
+void HttpServer::releaseRequest(HttpRequest* pRequest)
+{
+	if (pRequest->isKeepAlive())
+	{
+		QPointer<QTcpSocket> socket = pRequest->takeForNextRequest();
+		socket->setParent(this);
+
+		// The next request must not be handled while the receiver releases the current one.
+		QMetaObject::invokeMethod(this, [this, socket] {
+				if (socket)
+				{
+					addRequest(socket, true);
+				}
+			}, Qt::QueuedConnection);
+	}
+
+	pRequest->deleteLater();
+}
+
+
 bool HttpServer::checkReceiver(const QMetaMethod& pSignal, HttpRequest* pRequest)
 {
 	if (isSignalConnected(pSignal))
@@ -154,7 +210,7 @@ bool HttpServer::checkReceiver(const QMetaMethod& pSignal, HttpRequest* pRequest
 
 	qCDebug(network) << "No registration found:" << pSignal.name();
 	pRequest->send(HTTP_STATUS_SERVICE_UNAVAILABLE);
-	pRequest->deleteLater();
+	releaseRequest(pRequest);
 	return false;
 }
 
@@ -174,6 +230,21 @@ void HttpServer::onMessageComplete(HttpRequest* pRequest)
 {
 	pRequest->setParent(nullptr);
 
+	if (!mKeptAliveRequests.contains(pRequest) && mKeptAliveRequests.size() >= cMaxKeepAliveConnections)
+	{
+		qCDebug(network) << "Too many kept-alive connections, close connection after response";
+		pRequest->preventKeepAlive();
+	}
+
+	const auto deleter = [server = QPointer<HttpServer>(this)](HttpRequest* pSelf){
+				if (server)
+				{
+					server->releaseRequest(pSelf);
+					return;
+				}
+				pSelf->deleteLater();
+			};
+
 	if (pRequest->isUpgrade())
 	{
 		if (pRequest->getHeader(QByteArrayLiteral("upgrade")).toLower() == QByteArrayLiteral("websocket"))
@@ -203,6 +274,6 @@ void HttpServer::onMessageComplete(HttpRequest* pRequest)
 			return;
 		}
 
-		Q_EMIT fireNewHttpRequest(QSharedPointer<HttpRequest>(pRequest, &QObject::deleteLater));
+		Q_EMIT fireNewHttpRequest(QSharedPointer<HttpRequest>(pRequest, deleter));
 	}
 }
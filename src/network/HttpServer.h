@@ -4,6 +4,11 @@
 
 /*!
  * \brief Provide a HTTP server.
+ *
+ * A connection is kept open for the next request if the client asks for it.
+ * Pipelined requests are handled one after another in the order of arrival.
+ * A kept-alive connection is closed if it is idle for cKeepAliveTimeout and
+ * at most cMaxKeepAliveConnections connections are kept alive.
  */
 
 #pragma once
@@ -13,9 +18,14 @@
 
 #include <QList>
 #include <QMetaMethod>
+#include <QSet>
 #include <QStringList>
 #include <QTcpServer>
 
+
+class test_HttpServer;
+
+
 namespace governikus
 {
 
@@ -23,18 +33,24 @@ class HttpServer
 	: public QObject
 {
 	Q_OBJECT
+	friend class ::test_HttpServer;
 
 	private:
 		QList<QTcpServer*> mServer;
 		PortFile mPortFile;
+		QSet<const HttpRequest*> mKeptAliveRequests;
 
 		void shutdown();
 		void bindAddresses(quint16 pPort, const QList<QHostAddress>& pAddresses);
 		bool checkReceiver(const QMetaMethod& pSignal, HttpRequest* pRequest);
+		void addRequest(QTcpSocket* pSocket, bool pKeptAlive = false);
+		void releaseRequest(HttpRequest* pRequest);
 
 	public:
 		static quint16 cPort;
 		static QList<QHostAddress> cAddresses;
+		static int cKeepAliveTimeout;
+		static int cMaxKeepAliveConnections;
 		static QString getDefault();
 
 		explicit HttpServer(quint16 pPort = HttpServer::cPort,
@@ -51,6 +67,11 @@ class HttpServer
 		void onMessageComplete(HttpRequest* pRequest);
 
 	Q_SIGNALS:
+		/*!
+		 * \brief Emitted if the headers of a request are received.
+		 * A receiver can stream the body by HttpRequest::setBodyConsumer() in a direct connection.
+		 */
+		void fireNewHttpRequestHeaders(HttpRequest* pRequest);
 		void fireNewHttpRequest(const QSharedPointer<HttpRequest>& pRequest);
 		void fireNewWebSocketRequest(const QSharedPointer<HttpRequest>& pRequest);
 		void fireRebound();
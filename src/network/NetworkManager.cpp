@@ -12,6 +12,7 @@
 #include "VersionInfo.h"
 
 #include <QCoreApplication>
+#include <QHostInfo>
 #include <QLoggingCategory>
 #include <QNetworkProxyFactory>
 #include <QStringBuilder>
@@ -27,12 +28,14 @@ bool NetworkManager::mLockProxy = false;
 NetworkManager::NetworkManager()
 	: QObject()
 	, mNetAccessManager()
+	, mScopedAccessManagers()
 	, mApplicationExitInProgress(false)
 	, mOpenConnectionCount(0)
 	, mUpdaterSessions()
+	, mSslSessions()
+	, mPrefetchingHosts()
 {
-	mNetAccessManager.setRedirectPolicy(QNetworkRequest::ManualRedirectPolicy);
-	connect(&mNetAccessManager, &QNetworkAccessManager::proxyAuthenticationRequired, this, &NetworkManager::fireProxyAuthenticationRequired);
+	initAccessManager(mNetAccessManager);
 
 	connect(&Env::getSingleton<AppSettings>()->getGeneralSettings(), &GeneralSettings::fireProxyChanged, this, &NetworkManager::onProxyChanged);
 }
@@ -44,13 +47,117 @@ int NetworkManager::getOpenConnectionCount() const
 }
 
 
-void NetworkManager::clearConnections()
+void NetworkManager::initAccessManager(QNetworkAccessManager& pManager)
 {
+	pManager.setRedirectPolicy(QNetworkRequest::ManualRedirectPolicy);
+	connect(&pManager, &QNetworkAccessManager::proxyAuthenticationRequired, this, &NetworkManager::fireProxyAuthenticationRequired);
+}
+
+
+QNetworkAccessManager& NetworkManager::getAccessManager(const QNetworkRequest& pRequest)
+{
+	const auto& scope = pRequest.attribute(cConnectionScopeAttribute).toUuid();
+	if (scope.isNull())
+	{
+		return mNetAccessManager;
+	}
+
+	auto& manager = mScopedAccessManagers[scope];
+	if (manager.isNull())
+	{
+		qCDebug(network) << "Create connection scope:" << scope;
+		manager = QSharedPointer<QNetworkAccessManager>::create();
+		initAccessManager(*manager);
+	}
+	return *manager;
+}
+
+
+void NetworkManager::setConnectionScope(QNetworkRequest& pRequest, const QUuid& pScope)
+{
+	pRequest.setAttribute(cConnectionScopeAttribute, pScope.isNull() ? QVariant() : QVariant::fromValue(pScope));
+}
+
+
+void NetworkManager::releaseConnectionScope(const QUuid& pScope)
+{
+	// Replies are children of their QNetworkAccessManager. Release the scope
+	// after its workflow has released the replies.
+	if (mScopedAccessManagers.remove(pScope))
+	{
+		qCDebug(network) << "Release connection scope:" << pScope;
+	}
+}
+
+
+void NetworkManager::clearConnections(const QUuid& pScope)
+{
+	if (!pScope.isNull())
+	{
+		if (const auto& manager = mScopedAccessManagers.value(pScope))
+		{
+			manager->clearConnectionCache();
+		}
+		return;
+	}
+
 	mNetAccessManager.clearConnectionCache();
 	mUpdaterSessions.clear();
 }
 
 
+void NetworkManager::resumeSslSession(QNetworkRequest& pRequest)
+{
+	const auto& ticket = mSslSessions.take(pRequest.url());
+	if (ticket.isEmpty())
+	{
+		return;
+	}
+
+	auto cfg = pRequest.sslConfiguration();
+	if (cfg == QSslConfiguration::defaultConfiguration())
+	{
+		cfg = Env::getSingleton<SecureStorage>()->getTlsConfig().getConfiguration();
+	}
+	cfg.setSessionTicket(ticket);
+	pRequest.setSslConfiguration(cfg);
+}
+
+
+void NetworkManager::cacheSslSession(const QUrl& pUrl, const QSslConfiguration& pConfiguration)
+{
+	mSslSessions.insert(pUrl, pConfiguration);
+}
+
+
+void NetworkManager::prefetch(const QUrl& pUrl)
+{
+	const auto& host = pUrl.host();
+	if (mApplicationExitInProgress || host.isEmpty() || mPrefetchingHosts.contains(host))
+	{
+		return;
+	}
+
+	// A proxy resolves the host by itself, a lookup would only leak the host to the local resolver.
+	const auto& proxies = QNetworkProxyFactory::proxyForQuery(QNetworkProxyQuery(pUrl));
+	if (!proxies.isEmpty() && proxies.constFirst().type() != QNetworkProxy::NoProxy)
+	{
+		qCDebug(network) << "Proxy is used, skip prefetch of" << host;
+		return;
+	}
+
+	qCDebug(network) << "Prefetch" << host;
+	mPrefetchingHosts << host;
+	QHostInfo::lookupHost(host, this, [this, host](const QHostInfo& pInfo){
+			mPrefetchingHosts.remove(host);
+			if (pInfo.error() != QHostInfo::NoError)
+			{
+				qCDebug(network) << "Prefetch of" << host << "failed:" << pInfo.errorString();
+			}
+		});
+}
+
+
 QSharedPointer<QNetworkReply> NetworkManager::paos(QNetworkRequest& pRequest,
 		const QByteArray& pNamespace,
 		const QByteArray& pData,
@@ -75,7 +182,7 @@ QSharedPointer<QNetworkReply> NetworkManager::paos(QNetworkRequest& pRequest,
 QSharedPointer<QNetworkReply> NetworkManager::get(QNetworkRequest& pRequest)
 {
 	return processRequest(pRequest, [this] (const QNetworkRequest& request){
-			return trackConnection(mNetAccessManager.get(request));
+			return trackConnection(getAccessManager(request).get(request));
 		});
 }
 
@@ -86,7 +193,7 @@ QSharedPointer<QNetworkReply> NetworkManager::post(QNetworkRequest& pRequest,
 	pRequest.setHeader(QNetworkRequest::ContentLengthHeader, QString::number(pData.size()));
 
 	return processRequest(pRequest, [pData, this] (const QNetworkRequest& request){
-			return trackConnection(mNetAccessManager.post(request, pData));
+			return trackConnection(getAccessManager(request).post(request, pData));
 		});
 }
 
@@ -94,7 +201,7 @@ QSharedPointer<QNetworkReply> NetworkManager::post(QNetworkRequest& pRequest,
 QSharedPointer<QNetworkReply> NetworkManager::deleteResource(QNetworkRequest& pRequest)
 {
 	return processRequest(pRequest, [this] (const QNetworkRequest& request){
-			return trackConnection(mNetAccessManager.deleteResource(request));
+			return trackConnection(getAccessManager(request).deleteResource(request));
 		});
 }
 
@@ -102,7 +209,7 @@ QSharedPointer<QNetworkReply> NetworkManager::deleteResource(QNetworkRequest& pR
 QSharedPointer<QNetworkReply> NetworkManager::head(QNetworkRequest& pRequest)
 {
 	return processRequest(pRequest, [this] (const QNetworkRequest& request){
-			return trackConnection(mNetAccessManager.head(request));
+			return trackConnection(getAccessManager(request).head(request));
 		});
 }
 
@@ -110,7 +217,7 @@ QSharedPointer<QNetworkReply> NetworkManager::head(QNetworkRequest& pRequest)
 QSharedPointer<QNetworkReply> NetworkManager::options(QNetworkRequest& pRequest)
 {
 	return processRequest(pRequest, [this] (const QNetworkRequest& request){
-			return trackConnection(mNetAccessManager.sendCustomRequest(request, "OPTIONS"));
+			return trackConnection(getAccessManager(request).sendCustomRequest(request, "OPTIONS"));
 		});
 }
 
@@ -219,7 +326,12 @@ void NetworkManager::onShutdown()
 {
 	mApplicationExitInProgress = true;
 	mNetAccessManager.clearAccessCache();
+	for (const auto& manager : std::as_const(mScopedAccessManagers))
+	{
+		manager->clearAccessCache();
+	}
 	clearConnections();
+	mSslSessions.clear();
 	Q_EMIT fireShutdown();
 }
 
@@ -11,14 +11,17 @@
 #include "Env.h"
 #include "GlobalStatus.h"
 #include "LogHandler.h"
+#include "TlsSessionCache.h"
 
 #include <QAtomicInt>
 #include <QAuthenticator>
 #include <QDebug>
+#include <QHash>
 #include <QNetworkAccessManager>
 #include <QNetworkProxy>
 #include <QNetworkReply>
 #include <QSsl>
+#include <QUuid>
 
 class test_NetworkManager;
 
@@ -34,13 +37,19 @@ class NetworkManager
 
 	private:
 		static bool mLockProxy;
+		static constexpr QNetworkRequest::Attribute cConnectionScopeAttribute = QNetworkRequest::User;
 
 		QNetworkAccessManager mNetAccessManager;
+		QHash<QUuid, QSharedPointer<QNetworkAccessManager>> mScopedAccessManagers;
 		bool mApplicationExitInProgress;
 		QAtomicInt mOpenConnectionCount;
 		QSet<QByteArray> mUpdaterSessions;
+		TlsSessionCache mSslSessions;
+		QSet<QString> mPrefetchingHosts;
 
 		bool prepareConnection(QNetworkRequest& pRequest) const;
+		void initAccessManager(QNetworkAccessManager& pManager);
+		[[nodiscard]] QNetworkAccessManager& getAccessManager(const QNetworkRequest& pRequest);
 		[[nodiscard]] QSharedPointer<QNetworkReply> trackConnection(QNetworkReply* pResponse);
 		[[nodiscard]] QSharedPointer<QNetworkReply> processRequest(QNetworkRequest& pRequest,
 				const std::function<QSharedPointer<QNetworkReply>(QNetworkRequest&)>& pInvoke);
@@ -85,7 +94,17 @@ class NetworkManager
 		[[nodiscard]] static QByteArray getStatusMessage(int pStatus);
 		[[nodiscard]] static QString getFormattedStatusMessage(int pStatus);
 
-		virtual void clearConnections();
+		/*!
+		 * \brief Uses the connections of the scope for the request.
+		 *
+		 * Every scope has its own QNetworkAccessManager. So concurrent workflows
+		 * neither reuse nor clear the connections of each other. A null scope
+		 * uses the shared connections.
+		 */
+		static void setConnectionScope(QNetworkRequest& pRequest, const QUuid& pScope);
+		void releaseConnectionScope(const QUuid& pScope);
+
+		virtual void clearConnections(const QUuid& pScope = QUuid());
 		[[nodiscard]] virtual QSharedPointer<QNetworkReply> paos(QNetworkRequest& pRequest,
 				const QByteArray& pNamespace,
 				const QByteArray& pData,
@@ -104,6 +123,24 @@ class NetworkManager
 
 		[[nodiscard]] int getOpenConnectionCount() const;
 
+		/*!
+		 * \brief Sets the TLS session that was cached for the host of the request, if any.
+		 *
+		 * Connections are cleared by the workflows to receive QNetworkReply::encrypted() for
+		 * every new connection. A cached session keeps the handshake of such a connection short.
+		 * Do not use this for PSK connections, these are secured by the pre-shared key only.
+		 */
+		void resumeSslSession(QNetworkRequest& pRequest);
+		void cacheSslSession(const QUrl& pUrl, const QSslConfiguration& pConfiguration);
+
+		/*!
+		 * \brief Resolves the host of the url in the background.
+		 *
+		 * The result is kept by the host cache of Qt, so a later request to the host
+		 * does not wait for DNS. Nothing is resolved if a proxy is used for the url.
+		 */
+		void prefetch(const QUrl& pUrl);
+
 	Q_SIGNALS:
 		void fireProxyAuthenticationRequired(const QNetworkProxy& pProxy, QAuthenticator* pAuthenticator);
 		void fireShutdown();
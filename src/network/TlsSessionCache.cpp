@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "TlsSessionCache.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(network)
+
+
+const qsizetype TlsSessionCache::cMaxEntries = 16;
+const int TlsSessionCache::cDefaultLifetimeSeconds = 300;
+const int TlsSessionCache::cMaxLifetimeSeconds = 7200;
+
+
+TlsSessionCache::TlsSessionCache()
+	: mEntries()
+{
+}
+
+
+QString TlsSessionCache::getKey(const QUrl& pUrl)
+{
+	return pUrl.host().toLower() + QLatin1Char(':') + QString::number(pUrl.port(443));
+}
+
+
+qsizetype TlsSessionCache::indexOf(const QString& pKey) const
+{
+	for (qsizetype i = 0; i < mEntries.size(); ++i)
+	{
+		if (mEntries.at(i).mKey == pKey)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+
+void TlsSessionCache::insert(const QUrl& pUrl, const QSslConfiguration& pConfiguration)
+{
+	const auto& ticket = pConfiguration.sessionTicket();
+	if (ticket.isEmpty() || pUrl.host().isEmpty())
+	{
+		return;
+	}
+
+	const auto& key = getKey(pUrl);
+	if (const auto index = indexOf(key); index >= 0)
+	{
+		mEntries.removeAt(index);
+	}
+
+	mEntries.removeIf([](const Entry& pEntry){
+			return pEntry.mExpiry.hasExpired();
+		});
+
+	if (mEntries.size() >= cMaxEntries)
+	{
+		mEntries.removeFirst();
+	}
+
+	const int hint = pConfiguration.sessionTicketLifeTimeHint();
+	const int lifetime = hint > 0 ? std::min(hint, cMaxLifetimeSeconds) : cDefaultLifetimeSeconds;
+	mEntries += Entry {key, ticket, QDeadlineTimer(std::chrono::seconds(lifetime))};
+	qCDebug(network) << "Cached TLS session for" << key << "| lifetime:" << lifetime;
+}
+
+
+QByteArray TlsSessionCache::take(const QUrl& pUrl)
+{
+	const auto index = indexOf(getKey(pUrl));
+	if (index < 0)
+	{
+		return QByteArray();
+	}
+
+	const auto entry = mEntries.takeAt(index);
+	if (entry.mExpiry.hasExpired())
+	{
+		return QByteArray();
+	}
+
+	qCDebug(network) << "Resume cached TLS session for" << entry.mKey;
+	return entry.mTicket;
+}
+
+
+void TlsSessionCache::clear()
+{
+	mEntries.clear();
+}
+
+
+qsizetype TlsSessionCache::size() const
+{
+	return mEntries.size();
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Bounded cache of TLS session tickets per host and port.
+ *
+ * Every ticket is handed out once only, as a resumed handshake provides a new
+ * one. A ticket expires with the lifetime hint of the server and the oldest
+ * one is dropped if the cache is full.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QDeadlineTimer>
+#include <QList>
+#include <QSslConfiguration>
+#include <QString>
+#include <QUrl>
+
+
+class test_TlsSessionCache;
+
+
+namespace governikus
+{
+
+class TlsSessionCache
+{
+	friend class ::test_TlsSessionCache;
+
+	private:
+		struct Entry
+		{
+			QString mKey;
+			QByteArray mTicket;
+			QDeadlineTimer mExpiry;
+		};
+
+		static const qsizetype cMaxEntries;
+		static const int cDefaultLifetimeSeconds;
+		static const int cMaxLifetimeSeconds;
+
+		QList<Entry> mEntries;
+
+		[[nodiscard]] static QString getKey(const QUrl& pUrl);
+		[[nodiscard]] qsizetype indexOf(const QString& pKey) const;
+
+	public:
+		TlsSessionCache();
+
+		/*!
+		 * \brief Stores the session ticket of the established connection to the host of the url.
+		 */
+		void insert(const QUrl& pUrl, const QSslConfiguration& pConfiguration);
+
+		/*!
+		 * \brief Removes and returns the ticket for the host of the url.
+		 * \return Empty data if no ticket is cached or it has expired.
+		 */
+		[[nodiscard]] QByteArray take(const QUrl& pUrl);
+
+		void clear();
+		[[nodiscard]] qsizetype size() const;
+};
+
+} // namespace governikus
@@ -6,6 +6,7 @@
 
 #include "AppSettings.h"
 #include "Downloader.h"
+#include "NetworkManager.h"
 #include "SecureStorage.h"
 #include "VersionNumber.h"
 
@@ -188,6 +189,7 @@ void AppUpdater::handleVersionInfoDownloadFinished(const QByteArray& pData)
 		{
 			qCInfo(appupdate) << "Found new version:" << version << ", greater than old version" << QCoreApplication::applicationVersion();
 			Env::getSingleton<Downloader>()->download(mAppUpdateData.getNotesUrl());
+			Env::getSingleton<NetworkManager>()->prefetch(mAppUpdateData.getUrl());
 			return;
 		}
 		else
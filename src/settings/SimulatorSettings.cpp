@@ -13,6 +13,8 @@ namespace
 SETTINGS_NAME(SETTINGS_GROUP_NAME_SIMULATOR, "simulator")
 SETTINGS_NAME(SETTINGS_NAME_ENABLED, "enabled")
 SETTINGS_NAME(SETTINGS_NAME_BASIC_READER, "basicReader")
+SETTINGS_NAME(SETTINGS_NAME_APDU_LATENCY, "apduLatency")
+SETTINGS_NAME(SETTINGS_NAME_READER_PROFILES, "readerProfiles")
 } // namespace
 
 
@@ -63,3 +65,29 @@ void SimulatorSettings::setBasicReader(bool pBasicReader)
 	mStore->setValue(SETTINGS_NAME_BASIC_READER(), pBasicReader);
 	save(mStore);
 }
+
+
+ulong SimulatorSettings::getApduLatency() const
+{
+	return static_cast<ulong>(mStore->value(SETTINGS_NAME_APDU_LATENCY(), 0).toULongLong());
+}
+
+
+void SimulatorSettings::setApduLatency(ulong pMilliseconds)
+{
+	mStore->setValue(SETTINGS_NAME_APDU_LATENCY(), static_cast<qulonglong>(pMilliseconds));
+	save(mStore);
+}
+
+
+QString SimulatorSettings::getReaderProfiles() const
+{
+	return mStore->value(SETTINGS_NAME_READER_PROFILES(), QString()).toString();
+}
+
+
+void SimulatorSettings::setReaderProfiles(const QString& pFileName)
+{
+	mStore->setValue(SETTINGS_NAME_READER_PROFILES(), pFileName);
+	save(mStore);
+}
@@ -32,6 +32,12 @@ class SimulatorSettings
 		[[nodiscard]] bool isBasicReader() const;
 		void setBasicReader(bool pBasicReader);
 
+		[[nodiscard]] ulong getApduLatency() const;
+		void setApduLatency(ulong pMilliseconds);
+
+		[[nodiscard]] QString getReaderProfiles() const;
+		void setReaderProfiles(const QString& pFileName);
+
 	Q_SIGNALS:
 		void fireEnabledChanged();
 };
@@ -45,6 +45,73 @@ QString VolatileSettings::Messages::getSessionInProgress() const
 }
 
 
+bool VolatileSettings::Messages::operator==(const Messages& pOther) const
+{
+	return mSessionStarted == pOther.mSessionStarted
+		   && mSessionFailed == pOther.mSessionFailed
+		   && mSessionSucceeded == pOther.mSessionSucceeded
+		   && mSessionInProgress == pOther.mSessionInProgress;
+}
+
+
+VolatileSettings::WorkflowSettings::WorkflowSettings()
+	: WorkflowSettings(false, cHandleInterruptDefault, Messages())
+{
+}
+
+
+VolatileSettings::WorkflowSettings::WorkflowSettings(bool pDeveloperMode, bool pHandleInterrupt, const Messages& pMessages)
+	: mDeveloperMode(pDeveloperMode)
+	, mHandleInterrupt(pHandleInterrupt)
+	, mMessages(pMessages)
+{
+}
+
+
+bool VolatileSettings::WorkflowSettings::isDeveloperMode() const
+{
+	return mDeveloperMode;
+}
+
+
+void VolatileSettings::WorkflowSettings::setDeveloperMode(bool pMode)
+{
+	mDeveloperMode = pMode;
+}
+
+
+bool VolatileSettings::WorkflowSettings::handleInterrupt() const
+{
+	return mHandleInterrupt;
+}
+
+
+void VolatileSettings::WorkflowSettings::setHandleInterrupt(bool pScan)
+{
+	mHandleInterrupt = pScan;
+}
+
+
+const VolatileSettings::Messages& VolatileSettings::WorkflowSettings::getMessages() const
+{
+	return mMessages;
+}
+
+
+void VolatileSettings::WorkflowSettings::setMessages(const Messages& pMessages)
+{
+	mMessages = pMessages;
+}
+
+
+bool VolatileSettings::WorkflowSettings::operator==(const WorkflowSettings& pOther) const
+{
+	return mDeveloperMode == pOther.mDeveloperMode
+		   && mHandleInterrupt == pOther.mHandleInterrupt
+		   && mMessages == pOther.mMessages;
+}
+
+
 VolatileSettings::VolatileSettings()
 	: mLock()
 	, mUsedAsSdk(true)
@@ -118,6 +185,22 @@ VolatileSettings::Messages VolatileSettings::getMessages() const
 }
 
 
+VolatileSettings::WorkflowSettings VolatileSettings::getWorkflowSettings() const
+{
+	const QReadLocker locker(&mLock);
+	return WorkflowSettings(mDeveloperMode, mHandleInterrupt, mMessages);
+}
+
+
+void VolatileSettings::setWorkflowSettings(const WorkflowSettings& pSettings)
+{
+	const QWriteLocker locker(&mLock);
+	mDeveloperMode = pSettings.isDeveloperMode();
+	mHandleInterrupt = pSettings.handleInterrupt();
+	mMessages = pSettings.getMessages();
+}
+
+
 void VolatileSettings::setDelay(ulong pDelay)
 {
 	const QWriteLocker locker(&mLock);
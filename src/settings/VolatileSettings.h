@@ -55,6 +55,33 @@ class VolatileSettings
 				[[nodiscard]] QString getSessionFailed() const;
 				[[nodiscard]] QString getSessionSucceeded() const;
 				[[nodiscard]] QString getSessionInProgress() const;
+
+				[[nodiscard]] bool operator==(const Messages& pOther) const;
+		};
+
+		/*!
+		 * Settings a JSON session requests for its workflows.
+		 */
+		class WorkflowSettings
+		{
+			bool mDeveloperMode;
+			bool mHandleInterrupt;
+			Messages mMessages;
+
+			public:
+				WorkflowSettings();
+				WorkflowSettings(bool pDeveloperMode, bool pHandleInterrupt, const Messages& pMessages);
+
+				[[nodiscard]] bool isDeveloperMode() const;
+				void setDeveloperMode(bool pMode);
+
+				[[nodiscard]] bool handleInterrupt() const;
+				void setHandleInterrupt(bool pScan);
+
+				[[nodiscard]] const Messages& getMessages() const;
+				void setMessages(const Messages& pMessages);
+
+				[[nodiscard]] bool operator==(const WorkflowSettings& pOther) const;
 		};
 
 	private:
@@ -83,6 +110,9 @@ class VolatileSettings
 		void setMessages(const Messages& pMessages = Messages());
 		[[nodiscard]] Messages getMessages() const;
 
+		[[nodiscard]] WorkflowSettings getWorkflowSettings() const;
+		void setWorkflowSettings(const WorkflowSettings& pSettings);
+
 		void setDelay(ulong pDelay = 0);
 		[[nodiscard]] ulong getDelay() const;
 
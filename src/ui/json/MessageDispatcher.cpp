@@ -53,12 +53,13 @@ Q_DECLARE_LOGGING_CATEGORY(json)
 using namespace governikus;
 
 
-MessageDispatcher::MessageDispatcher()
+MessageDispatcher::MessageDispatcher(const QUuid& pSessionId)
 	: mContext()
 #ifndef QT_NO_DEBUG
 	, mSkipStateApprovedHook()
 #endif
 {
+	mContext.setSessionId(pSessionId);
 }
 
 
@@ -92,10 +93,16 @@ Msg MessageDispatcher::init(const QSharedPointer<WorkflowContext>& pWorkflowCont
 
 void MessageDispatcher::reset()
 {
+	// Concurrent workflows of other sessions still use the global settings.
+	const auto& context = mContext.getContext();
+	const bool resetGlobalSettings = mContext.getSessionId().isNull() || !context || !context->hasOtherRunningWorkflows();
+
 	mContext.clear();
-	Env::getSingleton<VolatileSettings>()->setMessages();
-	Env::getSingleton<VolatileSettings>()->setHandleInterrupt();
-	Env::getSingleton<VolatileSettings>()->setDeveloperMode();
+	mContext.setWorkflowSettings(VolatileSettings::WorkflowSettings());
+	if (resetGlobalSettings)
+	{
+		Env::getSingleton<VolatileSettings>()->setWorkflowSettings(VolatileSettings::WorkflowSettings());
+	}
 }
 
 
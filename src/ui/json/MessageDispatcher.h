@@ -46,7 +46,7 @@ class MessageDispatcher
 		MsgHandler handleInternalOnly(MsgCmdType pCmdType, const std::function<MsgHandler()>& pFunc) const;
 
 	public:
-		MessageDispatcher();
+		explicit MessageDispatcher(const QUuid& pSessionId = QUuid());
 
 		[[nodiscard]] Msg init(const QSharedPointer<WorkflowContext>& pWorkflowContext);
 		[[nodiscard]] Msg finish();
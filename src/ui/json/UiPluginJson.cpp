@@ -8,6 +8,7 @@
 #include "WorkflowRequest.h"
 #include "context/AuthContext.h"
 #include "context/ChangePinContext.h"
+#include "messages/MsgHandlerBadState.h"
 #include "messages/MsgTypes.h"
 
 #include <QLoggingCategory>
@@ -20,6 +21,7 @@ using namespace governikus;
 UiPluginJson::UiPluginJson()
 	: UiPlugin()
 	, mMessageDispatcher()
+	, mSessions()
 	, mEnabled(false)
 {
 }
@@ -57,7 +59,36 @@ bool UiPluginJson::isEnabled() const
 }
 
 
-void UiPluginJson::callFireMessage(const QByteArray& pMsg, bool pLogging)
+QUuid UiPluginJson::openSession()
+{
+	const auto sessionId = QUuid::createUuid();
+	mSessions.insert(sessionId, QSharedPointer<MessageDispatcher>::create(sessionId));
+	qCDebug(json) << "Open session:" << sessionId;
+	return sessionId;
+}
+
+
+void UiPluginJson::closeSession(const QUuid& pSessionId)
+{
+	if (mSessions.remove(pSessionId))
+	{
+		qCDebug(json) << "Close session:" << pSessionId;
+	}
+}
+
+
+MessageDispatcher* UiPluginJson::getMessageDispatcher(const QUuid& pSessionId)
+{
+	if (pSessionId.isNull())
+	{
+		return &mMessageDispatcher;
+	}
+
+	return mSessions.value(pSessionId).data();
+}
+
+
+void UiPluginJson::callFireMessage(const QUuid& pSessionId, const QByteArray& pMsg, bool pLogging)
 {
 	if (!pMsg.isEmpty())
 	{
@@ -65,7 +96,15 @@ void UiPluginJson::callFireMessage(const QByteArray& pMsg, bool pLogging)
 		{
 			qCDebug(json).noquote() << "Fire message:" << pMsg;
 		}
-		Q_EMIT fireMessage(pMsg);
+
+		if (pSessionId.isNull())
+		{
+			Q_EMIT fireMessage(pMsg);
+		}
+		else
+		{
+			Q_EMIT fireSessionMessage(pSessionId, pMsg);
+		}
 	}
 }
 
@@ -77,28 +116,74 @@ void UiPluginJson::onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pReq
 		return;
 	}
 
+	const auto sessionId = pRequest->getSessionId();
+	auto* dispatcher = getMessageDispatcher(sessionId);
+	if (!dispatcher)
+	{
+		qCWarning(json) << "Workflow of unknown session:" << sessionId;
+		return;
+	}
+
 	const auto& context = pRequest->getContext();
 	if (context.objectCast<AuthContext>() || context.objectCast<ChangePinContext>())
 	{
-		connect(context.data(), &WorkflowContext::fireStateChanged, this, &UiPluginJson::onStateChanged);
-		connect(context.data(), &WorkflowContext::fireProgressChanged, this, &UiPluginJson::onProgressChanged);
+		connect(context.data(), &WorkflowContext::fireStateChanged, this, [this, sessionId](const QString& pNewState){
+				onStateChanged(sessionId, pNewState);
+			});
+		connect(context.data(), &WorkflowContext::fireProgressChanged, this, [this, sessionId]{
+				onProgressChanged(sessionId);
+			});
 	}
 
-	callFireMessage(mMessageDispatcher.init(context));
+	callFireMessage(sessionId, dispatcher->init(context));
 }
 
 
 void UiPluginJson::onWorkflowFinished(const QSharedPointer<WorkflowRequest>& pRequest)
 {
-	Q_UNUSED(pRequest)
+	const auto sessionId = pRequest->getSessionId();
+	auto* dispatcher = getMessageDispatcher(sessionId);
+	if (!dispatcher)
+	{
+		return;
+	}
 
 	if (!mEnabled)
 	{
-		mMessageDispatcher.reset();
+		dispatcher->reset();
 		return;
 	}
 
-	callFireMessage(mMessageDispatcher.finish());
+	callFireMessage(sessionId, dispatcher->finish());
+}
+
+
+void UiPluginJson::onWorkflowUnhandled(const QSharedPointer<WorkflowRequest>& pRequest)
+{
+	const auto sessionId = pRequest->getSessionId();
+	if (!mEnabled || sessionId.isNull() || !mSessions.contains(sessionId))
+	{
+		return;
+	}
+
+	// The workflow of a session was rejected because too many workflows are running.
+	switch (pRequest->getAction())
+	{
+		case Action::AUTH:
+			callFireMessage(sessionId, MsgHandlerBadState(MsgCmdType::RUN_AUTH).toJson());
+			break;
+
+		case Action::PIN:
+			callFireMessage(sessionId, MsgHandlerBadState(MsgCmdType::RUN_CHANGE_PIN).toJson());
+			break;
+
+		case Action::PERSONALIZATION:
+			callFireMessage(sessionId, MsgHandlerBadState(MsgCmdType::RUN_PERSONALIZATION).toJson());
+			break;
+
+		default:
+			break;
+	}
 }
 
 
@@ -111,46 +196,95 @@ void UiPluginJson::onCardInfoChanged(const ReaderInfo& pInfo)
 }
 
 
-void UiPluginJson::onReaderEvent(const ReaderInfo& pInfo)
+void UiPluginJson::processReaderChange(const QUuid& pSessionId, MessageDispatcher& pDispatcher, const ReaderInfo& pInfo)
 {
-	const auto& messages = mMessageDispatcher.processReaderChange(pInfo);
+	const auto& messages = pDispatcher.processReaderChange(pInfo);
 	for (const auto& msg : messages)
 	{
-		callFireMessage(msg);
+		callFireMessage(pSessionId, msg);
+	}
+}
+
+
+void UiPluginJson::onReaderEvent(const ReaderInfo& pInfo)
+{
+	processReaderChange(QUuid(), mMessageDispatcher, pInfo);
+
+	for (auto iter = mSessions.constBegin(); iter != mSessions.constEnd(); ++iter)
+	{
+		processReaderChange(iter.key(), *iter.value(), pInfo);
 	}
 }
 
 
 void UiPluginJson::onCardInserted(const ReaderInfo& pInfo)
 {
-	if (pInfo.hasEid() || (pInfo.hasCard() && mMessageDispatcher.getApiLevel() > MsgLevel::v2))
+	if (pInfo.hasEid())
 	{
 		onReaderEvent(pInfo);
+		return;
+	}
+
+	if (!pInfo.hasCard())
+	{
+		return;
+	}
+
+	if (mMessageDispatcher.getApiLevel() > MsgLevel::v2)
+	{
+		processReaderChange(QUuid(), mMessageDispatcher, pInfo);
+	}
+
+	for (auto iter = mSessions.constBegin(); iter != mSessions.constEnd(); ++iter)
+	{
+		if (iter.value()->getApiLevel() > MsgLevel::v2)
+		{
+			processReaderChange(iter.key(), *iter.value(), pInfo);
+		}
 	}
 }
 
 
-void UiPluginJson::onStateChanged(const QString& pNewState)
+void UiPluginJson::onStateChanged(const QUuid& pSessionId, const QString& pNewState)
 {
-	callFireMessage(mMessageDispatcher.processStateChange(pNewState));
+	if (auto* dispatcher = getMessageDispatcher(pSessionId))
+	{
+		callFireMessage(pSessionId, dispatcher->processStateChange(pNewState));
+	}
 }
 
 
-void UiPluginJson::onProgressChanged()
+void UiPluginJson::onProgressChanged(const QUuid& pSessionId)
 {
-	callFireMessage(mMessageDispatcher.processProgressChange());
+	if (auto* dispatcher = getMessageDispatcher(pSessionId))
+	{
+		callFireMessage(pSessionId, dispatcher->processProgressChange());
+	}
 }
 
 
 void UiPluginJson::doMessageProcessing(const QByteArray& pMsg)
+{
+	doSessionMessageProcessing(QUuid(), pMsg);
+}
+
+
+void UiPluginJson::doSessionMessageProcessing(const QUuid& pSessionId, const QByteArray& pMsg)
 {
 	if (!mEnabled)
 	{
 		return;
 	}
 
-	const auto& msg = mMessageDispatcher.processCommand(pMsg);
-	callFireMessage(msg, msg != MsgType::LOG);
+	auto* dispatcher = getMessageDispatcher(pSessionId);
+	if (!dispatcher)
+	{
+		qCWarning(json) << "Message of unknown session:" << pSessionId;
+		return;
+	}
+
+	const auto& msg = dispatcher->processCommand(pMsg);
+	callFireMessage(pSessionId, msg, msg != MsgType::LOG);
 }
 
 
@@ -11,6 +11,9 @@
 #include "MessageDispatcher.h"
 #include "UiPlugin.h"
 
+#include <QHash>
+#include <QUuid>
+
 
 class test_UiPluginJson;
 class test_MsgHandlerAuth;
@@ -32,9 +35,14 @@ class UiPluginJson
 
 	private:
 		MessageDispatcher mMessageDispatcher;
+		QHash<QUuid, QSharedPointer<MessageDispatcher>> mSessions;
 		bool mEnabled;
 
-		inline void callFireMessage(const QByteArray& pMsg, bool pLogging = true);
+		inline void callFireMessage(const QUuid& pSessionId, const QByteArray& pMsg, bool pLogging = true);
+		[[nodiscard]] MessageDispatcher* getMessageDispatcher(const QUuid& pSessionId);
+		void processReaderChange(const QUuid& pSessionId, MessageDispatcher& pDispatcher, const ReaderInfo& pInfo);
+		void onStateChanged(const QUuid& pSessionId, const QString& pNewState);
+		void onProgressChanged(const QUuid& pSessionId);
 
 	public:
 		UiPluginJson();
@@ -43,21 +51,30 @@ class UiPluginJson
 		void setEnabled(bool pEnable = true);
 		[[nodiscard]] bool isEnabled() const;
 
+		/*!
+		 * A session has its own MessageDispatcher, so the workflows of several
+		 * sessions can run concurrently. Messages of the session are passed
+		 * by fireSessionMessage instead of fireMessage.
+		 */
+		[[nodiscard]] QUuid openSession();
+		void closeSession(const QUuid& pSessionId);
+
 	private Q_SLOTS:
 		void doShutdown() override;
 		void onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pRequest) override;
 		void onWorkflowFinished(const QSharedPointer<WorkflowRequest>& pRequest) override;
+		void onWorkflowUnhandled(const QSharedPointer<WorkflowRequest>& pRequest) override;
 		void onCardInfoChanged(const ReaderInfo& pInfo);
 		void onReaderEvent(const ReaderInfo& pInfo);
 		void onCardInserted(const ReaderInfo& pInfo);
-		void onStateChanged(const QString& pNewState);
-		void onProgressChanged();
 
 	public Q_SLOTS:
 		void doMessageProcessing(const QByteArray& pMsg);
+		void doSessionMessageProcessing(const QUuid& pSessionId, const QByteArray& pMsg);
 
 	Q_SIGNALS:
 		void fireMessage(const QByteArray& pMsg);
+		void fireSessionMessage(const QUuid& pSessionId, const QByteArray& pMsg);
 };
 
 } // namespace governikus
@@ -12,14 +12,28 @@ using namespace governikus;
 
 
 MsgContext::MsgContext()
-	: mApiLevel(MsgHandler::DEFAULT_MSG_LEVEL)
+	: mSessionId()
+	, mApiLevel(MsgHandler::DEFAULT_MSG_LEVEL)
 	, mStateMessages()
 	, mProgressStatus(true)
+	, mWorkflowSettings()
 	, mContext()
 {
 }
 
 
+const QUuid& MsgContext::getSessionId() const
+{
+	return mSessionId;
+}
+
+
+void MsgContext::setSessionId(const QUuid& pSessionId)
+{
+	mSessionId = pSessionId;
+}
+
+
 bool MsgContext::isActiveWorkflow() const
 {
 	return !mContext.isNull();
@@ -61,6 +75,18 @@ void MsgContext::setProgressStatus(bool pStatus)
 }
 
 
+const VolatileSettings::WorkflowSettings& MsgContext::getWorkflowSettings() const
+{
+	return mWorkflowSettings;
+}
+
+
+void MsgContext::setWorkflowSettings(const VolatileSettings::WorkflowSettings& pSettings)
+{
+	mWorkflowSettings = pSettings;
+}
+
+
 void MsgContext::setWorkflowContext(const QSharedPointer<WorkflowContext>& pContext)
 {
 	mContext = pContext;
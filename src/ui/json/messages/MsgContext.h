@@ -10,8 +10,11 @@
 
 #include "Msg.h"
 #include "MsgTypes.h"
+#include "VolatileSettings.h"
 #include "context/WorkflowContext.h"
 
+#include <QUuid>
+
 namespace governikus
 {
 
@@ -20,19 +23,24 @@ class MsgContext
 	Q_DISABLE_COPY(MsgContext)
 
 	private:
+		QUuid mSessionId;
 		MsgLevel mApiLevel;
 		QList<Msg> mStateMessages;
 		bool mProgressStatus;
+		VolatileSettings::WorkflowSettings mWorkflowSettings;
 		QSharedPointer<WorkflowContext> mContext;
 
 	protected:
 		void addStateMsg(const Msg& pMsg);
 		void clear();
 		void setWorkflowContext(const QSharedPointer<WorkflowContext>& pContext);
+		void setSessionId(const QUuid& pSessionId);
 
 	public:
 		MsgContext();
 
+		[[nodiscard]] const QUuid& getSessionId() const;
+
 		void setApiLevel(MsgLevel pApiLevel);
 		[[nodiscard]] MsgLevel getApiLevel() const;
 
@@ -41,6 +49,12 @@ class MsgContext
 		[[nodiscard]] bool provideProgressStatus() const;
 		void setProgressStatus(bool pStatus);
 
+		/*!
+		 * Workflow settings of a session. The default session uses VolatileSettings directly.
+		 */
+		[[nodiscard]] const VolatileSettings::WorkflowSettings& getWorkflowSettings() const;
+		void setWorkflowSettings(const VolatileSettings::WorkflowSettings& pSettings);
+
 		[[nodiscard]] bool isActiveWorkflow() const;
 
 		template<typename T = WorkflowContext>
@@ -80,6 +94,7 @@ class MsgDispatcherContext
 		using MsgContext::addStateMsg;
 		using MsgContext::clear;
 		using MsgContext::setWorkflowContext;
+		using MsgContext::setSessionId;
 };
 
 } // namespace governikus
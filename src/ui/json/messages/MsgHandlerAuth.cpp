@@ -37,7 +37,7 @@ MsgHandlerAuth::MsgHandlerAuth(const QJsonObject& pObj, MsgContext& pContext)
 		if (const auto& url = createUrl(jsonTcTokenUrl.toString()); url.isValid())
 		{
 			handleWorkflowProperties(pObj, pContext);
-			initAuth(url);
+			initAuth(url, pContext);
 			setVoid();
 			return;
 		}
@@ -89,9 +89,9 @@ QUrl MsgHandlerAuth::createUrl(const QString& pUrl)
 }
 
 
-void MsgHandlerAuth::initAuth(const QUrl& pTcTokenUrl) const
+void MsgHandlerAuth::initAuth(const QUrl& pTcTokenUrl, const MsgContext& pContext) const
 {
 	auto* ui = Env::getSingleton<UiLoader>()->getLoaded<UiPluginJson>();
 	Q_ASSERT(ui);
-	Q_EMIT ui->fireWorkflowRequested(AuthController::createWorkflowRequest(pTcTokenUrl));
+	Q_EMIT ui->fireWorkflowRequested(AuthController::createWorkflowRequest(pTcTokenUrl, getWorkflowData(pContext)));
 }
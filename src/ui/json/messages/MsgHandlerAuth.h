@@ -20,7 +20,7 @@ class MsgHandlerAuth
 {
 	private:
 		QUrl createUrl(const QString& pUrl);
-		void initAuth(const QUrl& pTcTokenUrl) const;
+		void initAuth(const QUrl& pTcTokenUrl, const MsgContext& pContext) const;
 
 	public:
 		MsgHandlerAuth();
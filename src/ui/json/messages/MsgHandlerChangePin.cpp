@@ -26,7 +26,7 @@ MsgHandlerChangePin::MsgHandlerChangePin(const QJsonObject& pObj, MsgContext& pC
 
 	auto* ui = Env::getSingleton<UiLoader>()->getLoaded<UiPluginJson>();
 	Q_ASSERT(ui);
-	Q_EMIT ui->fireWorkflowRequested(ChangePinController::createWorkflowRequest());
+	Q_EMIT ui->fireWorkflowRequested(ChangePinController::createWorkflowRequest(false, true, getWorkflowData(pContext)));
 }
 
 
@@ -35,7 +35,7 @@ MsgHandlerPersonalization::MsgHandlerPersonalization(const QJsonObject& pObj, Ms
 		if (const auto& url = createUrl(jsonUrl.toString()); !url.isEmpty())
 		{
 			handleWorkflowProperties(pObj, pContext);
-			initPersonalization(url);
+			initPersonalization(url, pContext);
 			setVoid();
 			return;
 		}
@@ -64,11 +64,11 @@ QString MsgHandlerPersonalization::createUrl(const QString& pUrl)
 }
 
 
-void MsgHandlerPersonalization::initPersonalization(const QString& pAppletServiceURL)
+void MsgHandlerPersonalization::initPersonalization(const QString& pAppletServiceURL, const MsgContext& pContext)
 {
 	auto* ui = Env::getSingleton<UiLoader>()->getLoaded<UiPluginJson>();
 	Q_ASSERT(ui);
-	Q_EMIT ui->fireWorkflowRequested(PersonalizationController::createWorkflowRequest(pAppletServiceURL));
+	Q_EMIT ui->fireWorkflowRequested(PersonalizationController::createWorkflowRequest(pAppletServiceURL, getWorkflowData(pContext)));
 }
 
 
@@ -22,7 +22,7 @@ class MsgHandlerPersonalization
 {
 	private:
 		QString createUrl(const QString& pUrl);
-		void initPersonalization(const QString& pAppletServiceURL);
+		void initPersonalization(const QString& pAppletServiceURL, const MsgContext& pContext);
 
 	public:
 		MsgHandlerPersonalization();
@@ -5,20 +5,42 @@
 #include "MsgHandlerWorkflows.h"
 
 #include "VolatileSettings.h"
+#include "WorkflowRequest.h"
 
 using namespace governikus;
 
 
 void MsgHandlerWorkflows::handleWorkflowProperties(const QJsonObject& pObj, MsgContext& pContext)
 {
-	initMessages(pObj[QLatin1String("messages")].toObject());
-	initDeveloperMode(pObj[QLatin1String("developerMode")]);
-	initHandleInterrupt(pObj[QLatin1String("handleInterrupt")], pContext);
+	// Workflows of other sessions may run, so a session keeps its settings until its workflow starts.
+	const bool isDefaultSession = pContext.getSessionId().isNull();
+	auto settings = isDefaultSession ? Env::getSingleton<VolatileSettings>()->getWorkflowSettings() : pContext.getWorkflowSettings();
+
+	initMessages(pObj[QLatin1String("messages")].toObject(), settings);
+	initDeveloperMode(pObj[QLatin1String("developerMode")], settings);
+	initHandleInterrupt(pObj[QLatin1String("handleInterrupt")], pContext, settings);
 	initProgressStatus(pObj[QLatin1String("status")], pContext);
+
+	if (isDefaultSession)
+	{
+		Env::getSingleton<VolatileSettings>()->setWorkflowSettings(settings);
+	}
+	else
+	{
+		pContext.setWorkflowSettings(settings);
+	}
+}
+
+
+QVariant MsgHandlerWorkflows::getWorkflowData(const MsgContext& pContext)
+{
+	// Bind the workflow to the session of the request.
+	const auto& sessionId = pContext.getSessionId();
+	return sessionId.isNull() ? QVariant() : QVariant::fromValue(WorkflowSession(sessionId, pContext.getWorkflowSettings()));
 }
 
 
-void MsgHandlerWorkflows::initMessages(const QJsonObject& pUi) const
+void MsgHandlerWorkflows::initMessages(const QJsonObject& pUi, VolatileSettings::WorkflowSettings& pSettings) const
 {
 	if (!pUi.isEmpty())
 	{
@@ -27,26 +49,26 @@ void MsgHandlerWorkflows::initMessages(const QJsonObject& pUi) const
 				pUi[QLatin1String("sessionSucceeded")].toString(),
 				pUi[QLatin1String("sessionInProgress")].toString());
 
-		Env::getSingleton<VolatileSettings>()->setMessages(messages);
+		pSettings.setMessages(messages);
 	}
 }
 
 
-void MsgHandlerWorkflows::initHandleInterrupt(const QJsonValue& pValue, const MsgContext& pContext) const
+void MsgHandlerWorkflows::initHandleInterrupt(const QJsonValue& pValue, const MsgContext& pContext, VolatileSettings::WorkflowSettings& pSettings) const
 {
 	if (pContext.getApiLevel() < MsgLevel::v2)
 	{
-		Env::getSingleton<VolatileSettings>()->setHandleInterrupt(pValue.isBool() ? pValue.toBool() : true);
+		pSettings.setHandleInterrupt(pValue.isBool() ? pValue.toBool() : true);
 	}
 }
 
 
-void MsgHandlerWorkflows::initDeveloperMode(const QJsonValue& pValue) const
+void MsgHandlerWorkflows::initDeveloperMode(const QJsonValue& pValue, VolatileSettings::WorkflowSettings& pSettings) const
 {
 	if (pValue.isBool())
 	{
-		Env::getSingleton<VolatileSettings>()->setDeveloperMode(pValue.toBool());
-		qDebug() << "Using Developer Mode on SDK:" << Env::getSingleton<VolatileSettings>()->isDeveloperMode();
+		pSettings.setDeveloperMode(pValue.toBool());
+		qDebug() << "Using Developer Mode on SDK:" << pSettings.isDeveloperMode();
 	}
 }
 
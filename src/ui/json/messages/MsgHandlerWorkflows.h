@@ -11,6 +11,8 @@
 #include "MsgHandler.h"
 #include "messages/MsgContext.h"
 
+#include <QVariant>
+
 namespace governikus
 {
 
@@ -19,10 +21,11 @@ class MsgHandlerWorkflows
 {
 	protected:
 		void handleWorkflowProperties(const QJsonObject& pObj, MsgContext& pContext);
+		[[nodiscard]] static QVariant getWorkflowData(const MsgContext& pContext);
 
-		void initMessages(const QJsonObject& pUi) const;
-		void initDeveloperMode(const QJsonValue& pValue) const;
-		void initHandleInterrupt(const QJsonValue& pValue, const MsgContext& pContext) const;
+		void initMessages(const QJsonObject& pUi, VolatileSettings::WorkflowSettings& pSettings) const;
+		void initDeveloperMode(const QJsonValue& pValue, VolatileSettings::WorkflowSettings& pSettings) const;
+		void initHandleInterrupt(const QJsonValue& pValue, const MsgContext& pContext, VolatileSettings::WorkflowSettings& pSettings) const;
 		void initProgressStatus(const QJsonValue& pValue, MsgContext& pContext) const;
 		void setError(const QLatin1String pError);
 
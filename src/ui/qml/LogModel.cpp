@@ -5,6 +5,7 @@
 #include "LogModel.h"
 
 #include "ApplicationModel.h"
+#include "BinaryLog.h"
 #include "LanguageLoader.h"
 #include "LogHandler.h"
 #include "Randomizer.h"
@@ -25,6 +26,7 @@ LogModel::LogModel()
 	, mLogFiles()
 	, mSelectedLogFile(-1)
 	, mLogEntries()
+	, mLogFileIndex()
 	, mLevels()
 	, mCategories()
 {
@@ -49,24 +51,28 @@ void LogModel::reset()
 void LogModel::addLogEntry(const QString& pEntry)
 {
 	const QString re = QStringLiteral(R"(^[a-z\._ ]{%1} \d{4}\.\d{2}\.\d{2} \d{2}:\d{2}:\d{2}\.\d{3} \d{3,} )").arg(LogHandler::MAX_CATEGORY_LENGTH);
-	if (!QRegularExpression(re).match(pEntry).hasMatch() && !mLogEntries.isEmpty())
+	if (!QRegularExpression(re).match(pEntry).hasMatch() && !mLogEntries.isEmpty() && mLogEntries.last().isText())
 	{
-		mLogEntries.last().append(QLatin1String("\n")).append(pEntry); // clazy:exclude=detaching-member
+		mLogEntries.last().appendText(pEntry); // clazy:exclude=detaching-member
 		return;
 	}
 
-	mLogEntries.append(pEntry);
+	addLogEntry(LogEntry::fromText(pEntry));
+}
 
-	QModelIndex idx = index(static_cast<int>(mLogEntries.size()) - 1, 0);
 
-	const auto& level = data(idx, LogModel::LogModelRoles::LevelRole).toString();
+void LogModel::addLogEntry(const LogEntry& pEntry)
+{
+	mLogEntries.append(pEntry);
+
+	const auto& level = pEntry.getLevel();
 	if (!mLevels.contains(level))
 	{
 		mLevels.insert(level);
 		Q_EMIT fireLevelsChanged();
 	}
 
-	const auto& category = data(idx, LogModel::LogModelRoles::CategoryRole).toString();
+	const auto& category = pEntry.getCategory();
 	if (!mCategories.contains(category))
 	{
 		mCategories.insert(category);
@@ -79,6 +85,7 @@ void LogModel::setLogEntries(QTextStream& pTextStream)
 {
 	beginResetModel();
 
+	mLogFileIndex.close();
 	mLevels.clear();
 	mCategories.clear();
 	mLogEntries.clear();
@@ -98,13 +105,57 @@ void LogModel::setLogEntries(QTextStream& pTextStream)
 }
 
 
-void LogModel::onNewLogMsg(const QString& pMsg)
+void LogModel::setLogEntries(const QList<LogEntry>& pEntries)
+{
+	beginResetModel();
+
+	mLogFileIndex.close();
+	mLevels.clear();
+	mCategories.clear();
+	mLogEntries.clear();
+	mLogEntries.reserve(pEntries.size());
+
+	{
+		const QSignalBlocker blocker(this);
+		for (const auto& entry : pEntries)
+		{
+			addLogEntry(entry);
+		}
+	}
+
+	endResetModel();
+
+	Q_EMIT fireLevelsChanged();
+	Q_EMIT fireCategoriesChanged();
+}
+
+
+void LogModel::setLogFileIndex(const QString& pFileName)
+{
+	beginResetModel();
+
+	mLogEntries.clear();
+	mLogFileIndex.open(pFileName);
+
+	const auto& levels = mLogFileIndex.getLevels();
+	mLevels = QSet<QString>(levels.constBegin(), levels.constEnd());
+	const auto& categories = mLogFileIndex.getCategories();
+	mCategories = QSet<QString>(categories.constBegin(), categories.constEnd());
+
+	endResetModel();
+
+	Q_EMIT fireLevelsChanged();
+	Q_EMIT fireCategoriesChanged();
+}
+
+
+void LogModel::onNewLogEntry(const LogEntry& pEntry)
 {
 	if (mSelectedLogFile == 0)
 	{
 		const auto size = static_cast<int>(mLogEntries.size());
 		beginInsertRows(QModelIndex(), size, size);
-		addLogEntry(pMsg);
+		addLogEntry(pEntry);
 		endInsertRows();
 		Q_EMIT fireNewLogMsg();
 	}
@@ -160,6 +211,16 @@ QDateTime LogModel::getCurrentLogFileDate() const
 
 void LogModel::removeOtherLogFiles()
 {
+	// A selected older logfile is mapped by the index and cannot be removed on every platform.
+	if (mLogFileIndex.isOpen())
+	{
+		beginResetModel();
+		mLogFileIndex.close();
+		mLevels.clear();
+		mCategories.clear();
+		endResetModel();
+	}
+
 	if (Env::getSingleton<LogHandler>()->removeOtherLogFiles())
 	{
 		reset();
@@ -186,20 +247,29 @@ void LogModel::setLogFile(int pIndex)
 
 	if (pIndex == 0)
 	{
-		QTextStream in(logHandler->useLogFile() ? logHandler->getBacklog() : tr("The logfile is disabled.").toUtf8());
-		setLogEntries(in);
-		connect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
+		if (logHandler->useLogFile() && logHandler->isBinaryLog())
+		{
+			setLogEntries(logHandler->getBacklogEntries());
+		}
+		else
+		{
+			QTextStream in(logHandler->useLogFile() ? logHandler->getBacklog() : tr("The logfile is disabled.").toUtf8());
+			setLogEntries(in);
+		}
+		connect(logHandler->getEventHandler(), &LogEventHandler::fireLogEntry, this, &LogModel::onNewLogEntry);
 	}
 	else
 	{
-		disconnect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
-		QFile inputFile(mLogFiles.value(pIndex));
-		if (inputFile.open(QIODevice::ReadOnly))
+		disconnect(logHandler->getEventHandler(), &LogEventHandler::fireLogEntry, this, &LogModel::onNewLogEntry);
+		const auto& fileName = mLogFiles.value(pIndex);
+		if (QFile inputFile(fileName); inputFile.open(QIODevice::ReadOnly) && BinaryLog::isBinary(inputFile.peek(BinaryLog::getHeader().size())))
 		{
-			QTextStream in(&inputFile);
-			setLogEntries(in);
-			inputFile.close();
+			setLogEntries(BinaryLog::read(inputFile.readAll()));
+			return;
 		}
+
+		// A text logfile can be very large, so the rows are read from the file on demand.
+		setLogFileIndex(fileName);
 	}
 }
 
@@ -246,7 +316,7 @@ void LogModel::saveDummyLogFile(const QDateTime& pTimestamp)
 int LogModel::rowCount(const QModelIndex& pIndex) const
 {
 	Q_UNUSED(pIndex)
-	return static_cast<int>(mLogEntries.size());
+	return static_cast<int>(mLogFileIndex.isOpen() ? mLogFileIndex.size() : mLogEntries.size());
 }
 
 
@@ -264,42 +334,50 @@ QHash<int, QByteArray> LogModel::roleNames() const
 
 QVariant LogModel::data(const QModelIndex& pIndex, int pRole) const
 {
-	static const auto splitToken = QLatin1String(" : ");
-
 	if (!pIndex.isValid())
 	{
 		return QVariant();
 	}
 
-	const auto& logMessage = mLogEntries.at(pIndex.row());
+	const auto row = pIndex.row();
+	if (mLogFileIndex.isOpen())
+	{
+		// The filter uses only the level and the category, so the entry is not read for them.
+		switch (pRole)
+		{
+			case LevelRole:
+				return mLogFileIndex.getLevel(row);
+
+			case CategoryRole:
+				return mLogFileIndex.getCategory(row);
 
+			default:
+				return getData(mLogFileIndex.at(row), pRole);
+		}
+	}
+
+	return getData(mLogEntries.at(row), pRole);
+}
+
+
+QVariant LogModel::getData(const LogEntry& pLogEntry, int pRole)
+{
 	switch (pRole)
 	{
 		case Qt::DisplayRole:
-			return logMessage;
+			return pLogEntry.toString();
 
 		case OriginRole:
-			return logMessage.section(splitToken, 0, 0).trimmed();
+			return pLogEntry.getOrigin();
 
 		case LevelRole:
-		{
-			const QRegularExpression re(QStringLiteral("[0-9]{3,} ([A-Z]) "));
-			const auto& match = re.match(logMessage);
-			if (match.hasMatch())
-			{
-				return match.captured(1);
-			}
-
-			return QStringLiteral("D");
-		}
+			return pLogEntry.getLevel();
 
 		case CategoryRole:
-		{
-			return logMessage.left(logMessage.indexOf(QLatin1Char(' ')));
-		}
+			return pLogEntry.getCategory();
 
 		case MessageRole:
-			return logMessage.section(splitToken, 1, -1).trimmed();
+			return pLogEntry.getMessage();
 
 		default:
 			return QVariant();
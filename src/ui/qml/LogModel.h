@@ -5,6 +5,8 @@
 #pragma once
 
 #include "Env.h"
+#include "LogEntry.h"
+#include "LogFileIndex.h"
 #include "SingletonCreator.h"
 
 #include <QAbstractListModel>
@@ -39,7 +41,8 @@ class LogModel
 	private:
 		QStringList mLogFiles;
 		int mSelectedLogFile;
-		QStringList mLogEntries;
+		QList<LogEntry> mLogEntries;
+		LogFileIndex mLogFileIndex;
 
 		QSet<QString> mLevels;
 		QSet<QString> mCategories;
@@ -49,10 +52,14 @@ class LogModel
 
 		void reset();
 		void addLogEntry(const QString& pEntry);
+		void addLogEntry(const LogEntry& pEntry);
 		void setLogEntries(QTextStream& pTextStream);
+		void setLogEntries(const QList<LogEntry>& pEntries);
+		void setLogFileIndex(const QString& pFileName);
+		[[nodiscard]] static QVariant getData(const LogEntry& pLogEntry, int pRole);
 
 	private Q_SLOTS:
-		void onNewLogMsg(const QString& pMsg);
+		void onNewLogEntry(const LogEntry& pEntry);
 
 	public Q_SLOTS:
 		void onTranslationChanged();
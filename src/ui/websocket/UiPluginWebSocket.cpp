@@ -11,13 +11,14 @@
 #include "WorkflowRequest.h"
 
 #include <QCoreApplication>
-#include <QFile>
-#include <QHostAddress>
 #include <QLoggingCategory>
 #include <QPluginLoader>
 #include <QRegularExpression>
 #include <QSignalBlocker>
 
+#include <algorithm>
+#include <utility>
+
 
 Q_DECLARE_LOGGING_CATEGORY(websocket)
 
@@ -27,10 +28,10 @@ using namespace governikus;
 UiPluginWebSocket::UiPluginWebSocket()
 	: UiPlugin()
 	, mServer(QCoreApplication::applicationName() + QLatin1Char('/') + QCoreApplication::applicationVersion(), QWebSocketServer::NonSecureMode)
-	, mConnection(nullptr)
-	, mRequest()
+	, mPendingRequests()
+	, mClients()
 	, mJson(nullptr)
-	, mContext()
+	, mMaxConnections(1)
 	, mUiDomination(false)
 	, mUiDominationPrevUsedAsSDK(false)
 {
@@ -58,7 +59,14 @@ bool UiPluginWebSocket::initialize()
 		return false;
 	}
 
-	qCDebug(websocket) << "Enable WebSocket...";
+	bool ok = false;
+	const int maxConnections = qEnvironmentVariableIntValue("AUSWEISAPP2_WEBSOCKET_CONNECTIONS", &ok);
+	if (ok && maxConnections > 0)
+	{
+		mMaxConnections = maxConnections;
+	}
+
+	qCDebug(websocket) << "Enable WebSocket... | Connections:" << mMaxConnections;
 	connect(mHttpServer.data(), &HttpServer::fireNewWebSocketRequest, this, &UiPluginWebSocket::onNewWebSocketRequest);
 	connect(mHttpServer.data(), &HttpServer::fireRebound, this, [this]{
 			if (!mHttpServer->isListening())
@@ -69,26 +77,102 @@ bool UiPluginWebSocket::initialize()
 			}
 		});
 	connect(&mServer, &QWebSocketServer::newConnection, this, &UiPluginWebSocket::onNewConnection);
+	connect(mJson, &UiPluginJson::fireMessage, this, &UiPluginWebSocket::onJsonMessage);
+	connect(mJson, &UiPluginJson::fireSessionMessage, this, &UiPluginWebSocket::onJsonSessionMessage);
 	return true;
 }
 
 
+bool UiPluginWebSocket::hasSessions() const
+{
+	return mMaxConnections > 1;
+}
+
+
+QSharedPointer<WebSocketClient> UiPluginWebSocket::getClient(const QUuid& pSessionId) const
+{
+	const auto iter = std::find_if(mClients.constBegin(), mClients.constEnd(), [&pSessionId](const auto& pClient){
+			return pClient->getSessionId() == pSessionId;
+		});
+	return iter == mClients.constEnd() ? QSharedPointer<WebSocketClient>() : *iter;
+}
+
+
+void UiPluginWebSocket::addClient(QWebSocket* pSocket)
+{
+	const auto sessionId = hasSessions() ? mJson->openSession() : QUuid();
+	const QSharedPointer<WebSocketClient> client(new WebSocketClient(pSocket, sessionId), &QObject::deleteLater);
+	mClients += client;
+	qCDebug(websocket) << "Client connected... | Session:" << sessionId << "| Connections:" << mClients.size();
+
+	const auto* clientPtr = client.data();
+	connect(clientPtr, &WebSocketClient::fireMessageReceived, this, [this, sessionId](const QByteArray& pMessage){
+			mJson->doSessionMessageProcessing(sessionId, pMessage);
+		});
+	connect(clientPtr, &WebSocketClient::fireDisconnected, this, [this, clientPtr]{
+			removeClient(clientPtr);
+		});
+	mJson->setEnabled();
+}
+
+
+void UiPluginWebSocket::removeClient(const WebSocketClient* pClient)
+{
+	const auto iter = std::find_if(mClients.constBegin(), mClients.constEnd(), [pClient](const auto& pEntry){
+			return pEntry.data() == pClient;
+		});
+	if (iter == mClients.constEnd())
+	{
+		return;
+	}
+
+	// Remove the client first, so no message of its workflow is sent anymore.
+	const auto client = *iter;
+	mClients.erase(iter);
+	client->disconnect(this);
+	qCDebug(websocket) << "Client disconnected... | Session:" << client->getSessionId() << "| Connections:" << mClients.size();
+
+	if (client->getContext() && mUiDomination)
+	{
+		const QSignalBlocker blocker(mJson);
+		client->getContext()->killWorkflow();
+	}
+
+	if (!client->getSessionId().isNull())
+	{
+		mJson->closeSession(client->getSessionId());
+	}
+
+	if (mClients.isEmpty() && mPendingRequests.isEmpty())
+	{
+		Q_EMIT fireUiDominationRelease();
+	}
+}
+
+
 void UiPluginWebSocket::onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pRequest)
 {
-	if (mUiDomination)
+	if (!mUiDomination)
+	{
+		return;
+	}
+
+	if (const auto& client = getClient(pRequest->getSessionId()))
 	{
-		mContext = pRequest->getContext();
-		mContext->claim(this);
-		mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR});
+		const auto& context = pRequest->getContext();
+		context->claim(this);
+		context->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR});
+		client->setContext(context);
 	}
 }
 
 
 void UiPluginWebSocket::onWorkflowFinished(const QSharedPointer<WorkflowRequest>& pRequest)
 {
-	Q_UNUSED(pRequest)
-
-	mContext.clear();
+	if (const auto& client = getClient(pRequest->getSessionId()))
+	{
+		client->setContext(QSharedPointer<WorkflowContext>());
+	}
 }
 
 
@@ -101,19 +185,25 @@ void UiPluginWebSocket::onUiDomination(const UiPlugin* pUi, const QString& pInfo
 		return;
 	}
 
+	const auto requests = std::exchange(mPendingRequests, QList<QSharedPointer<HttpRequest>>());
 	if (pAccepted)
 	{
-		Q_ASSERT(!mConnection);
+		Q_ASSERT(mClients.isEmpty());
 		mUiDomination = true;
 		mUiDominationPrevUsedAsSDK = Env::getSingleton<VolatileSettings>()->isUsedAsSDK();
 		Env::getSingleton<VolatileSettings>()->setUsedAsSDK(true);
 		Env::getSingleton<ReaderManager>()->startScanAll();
-		mServer.handleConnection(mRequest->take());
+		for (const auto& request : requests)
+		{
+			mServer.handleConnection(request->take());
+		}
 	}
 	else
 	{
-		mRequest->send(HTTP_STATUS_CONFLICT);
-		mRequest.reset();
+		for (const auto& request : requests)
+		{
+			request->send(HTTP_STATUS_CONFLICT);
+		}
 	}
 }
 
@@ -142,79 +232,75 @@ void UiPluginWebSocket::onNewWebSocketRequest(const QSharedPointer<HttpRequest>&
 		return;
 	}
 
-	if (mRequest)
+	if (mClients.size() + mPendingRequests.size() >= mMaxConnections)
 	{
 		qCDebug(websocket) << "Client is already connected...";
 		pRequest->send(HTTP_STATUS_TOO_MANY_REQUESTS);
 		return;
 	}
 
-	mRequest = pRequest;
-	Q_EMIT fireUiDominationRequest(this, QString::fromLatin1(pRequest->getHeader().value(QByteArrayLiteral("user-agent"))).toHtmlEscaped());
-}
-
-
-void UiPluginWebSocket::onNewConnection()
-{
-	if (mServer.hasPendingConnections())
+	if (mUiDomination)
 	{
-		mConnection.reset(mServer.nextPendingConnection());
-		connect(mJson, &UiPluginJson::fireMessage, this, &UiPluginWebSocket::onJsonMessage);
-		connect(mConnection.data(), &QWebSocket::textMessageReceived, this, &UiPluginWebSocket::onTextMessageReceived);
-		connect(mConnection.data(), &QWebSocket::disconnected, this, &UiPluginWebSocket::onClientDisconnected);
-		mJson->setEnabled();
+		mServer.handleConnection(pRequest->take());
+		return;
 	}
-	else
+
+	mPendingRequests += pRequest;
+	if (mPendingRequests.size() == 1)
 	{
-		mConnection.reset();
-		mRequest.reset();
-		Q_EMIT fireUiDominationRelease();
+		Q_EMIT fireUiDominationRequest(this, QString::fromLatin1(pRequest->getHeader(QByteArrayLiteral("user-agent"))).toHtmlEscaped());
 	}
 }
 
 
-void UiPluginWebSocket::onClientDisconnected()
+void UiPluginWebSocket::onNewConnection()
 {
-	qCDebug(websocket) << "Client disconnected...";
-
-	if (mContext && mUiDomination)
+	while (mServer.hasPendingConnections())
 	{
-		const QSignalBlocker blocker(mJson);
-		mContext->killWorkflow();
+		auto* socket = mServer.nextPendingConnection();
+		if (mClients.size() >= mMaxConnections)
+		{
+			qCDebug(websocket) << "Client is already connected...";
+			socket->close(QWebSocketProtocol::CloseCodePolicyViolated);
+			socket->deleteLater();
+			continue;
+		}
+
+		addClient(socket);
 	}
 
-	mConnection.reset();
-	mRequest.reset();
-	disconnect(mJson, &UiPluginJson::fireMessage, this, &UiPluginWebSocket::onJsonMessage);
-	Q_EMIT fireUiDominationRelease();
+	if (mClients.isEmpty())
+	{
+		Q_EMIT fireUiDominationRelease();
+	}
 }
 
 
-void UiPluginWebSocket::onTextMessageReceived(const QString& pMessage)
+void UiPluginWebSocket::onJsonMessage(const QByteArray& pMessage)
 {
-	if (mConnection)
+	if (const auto& client = getClient(QUuid()))
 	{
-		mJson->doMessageProcessing(pMessage.toUtf8());
+		client->sendMessage(pMessage);
 	}
 }
 
 
-void UiPluginWebSocket::onJsonMessage(const QByteArray& pMessage)
+void UiPluginWebSocket::onJsonSessionMessage(const QUuid& pSessionId, const QByteArray& pMessage)
 {
-	if (mConnection)
+	if (const auto& client = getClient(pSessionId))
 	{
-		mConnection->sendTextMessage(QString::fromUtf8(pMessage));
+		client->sendMessage(pMessage);
 	}
 }
 
 
 void UiPluginWebSocket::doShutdown()
 {
-	if (mConnection)
+	const auto clients = std::exchange(mClients, QList<QSharedPointer<WebSocketClient>>());
+	for (const auto& client : clients)
 	{
-		mConnection->close(QWebSocketProtocol::CloseCodeGoingAway);
-		mConnection->disconnect(this);
-		mConnection.reset();
+		client->disconnect(this);
+		client->close(QWebSocketProtocol::CloseCodeGoingAway);
 	}
 
 	if (mHttpServer)
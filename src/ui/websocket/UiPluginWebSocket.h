@@ -4,6 +4,10 @@
 
 /*!
  * \brief UiPlugin implementation of the Websocket.
+ *
+ * By default a single client is accepted that uses the default session of the JSON API.
+ * If the environment variable AUSWEISAPP2_WEBSOCKET_CONNECTIONS allows more connections,
+ * every client gets its own session of the JSON API and can run its own workflow.
  */
 
 #pragma once
@@ -12,11 +16,12 @@
 #include "HttpServer.h"
 #include "UiPlugin.h"
 #include "UiPluginJson.h"
+#include "WebSocketClient.h"
 
-#include <QDir>
-#include <QMap>
-#include <QScopedPointer>
-#include <QWebSocket>
+#include <QList>
+#include <QPointer>
+#include <QSharedPointer>
+#include <QUuid>
 #include <QWebSocketServer>
 
 namespace governikus
@@ -32,13 +37,18 @@ class UiPluginWebSocket
 	private:
 		QSharedPointer<HttpServer> mHttpServer;
 		QWebSocketServer mServer;
-		QScopedPointer<QWebSocket, QScopedPointerDeleteLater> mConnection;
-		QSharedPointer<HttpRequest> mRequest;
+		QList<QSharedPointer<HttpRequest>> mPendingRequests;
+		QList<QSharedPointer<WebSocketClient>> mClients;
 		QPointer<UiPluginJson> mJson;
-		QSharedPointer<WorkflowContext> mContext;
+		int mMaxConnections;
 		bool mUiDomination;
 		bool mUiDominationPrevUsedAsSDK;
 
+		[[nodiscard]] bool hasSessions() const;
+		[[nodiscard]] QSharedPointer<WebSocketClient> getClient(const QUuid& pSessionId) const;
+		void addClient(QWebSocket* pSocket);
+		void removeClient(const WebSocketClient* pClient);
+
 	private Q_SLOTS:
 		void doShutdown() override;
 		void onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pRequest) override;
@@ -47,9 +57,8 @@ class UiPluginWebSocket
 		void onUiDominationReleased() override;
 		void onNewWebSocketRequest(const QSharedPointer<HttpRequest>& pRequest);
 		void onNewConnection();
-		void onClientDisconnected();
-		void onTextMessageReceived(const QString& pMessage);
 		void onJsonMessage(const QByteArray& pMessage);
+		void onJsonSessionMessage(const QUuid& pSessionId, const QByteArray& pMessage);
 
 	public:
 		UiPluginWebSocket();
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "WebSocketClient.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+
+Q_DECLARE_LOGGING_CATEGORY(websocket)
+
+using namespace governikus;
+
+
+WebSocketClient::WebSocketClient(QWebSocket* pSocket, const QUuid& pSessionId)
+	: QObject()
+	, mSocket(pSocket)
+	, mSessionId(pSessionId)
+	, mContext()
+	, mReceivedMessages()
+	, mBytesToWrite(0)
+{
+	Q_ASSERT(mSocket);
+
+	connect(mSocket.data(), &QWebSocket::textMessageReceived, this, &WebSocketClient::onTextMessageReceived);
+	connect(mSocket.data(), &QWebSocket::bytesWritten, this, &WebSocketClient::onBytesWritten);
+	connect(mSocket.data(), &QWebSocket::disconnected, this, &WebSocketClient::fireDisconnected);
+}
+
+
+bool WebSocketClient::isCongested() const
+{
+	return mBytesToWrite > MAX_BYTES_TO_WRITE;
+}
+
+
+void WebSocketClient::processReceivedMessages()
+{
+	while (!isCongested() && !mReceivedMessages.isEmpty())
+	{
+		Q_EMIT fireMessageReceived(mReceivedMessages.dequeue());
+	}
+}
+
+
+void WebSocketClient::onTextMessageReceived(const QString& pMessage)
+{
+	if (mReceivedMessages.size() >= MAX_RECEIVED_MESSAGES)
+	{
+		qCWarning(websocket) << "Too many pending messages, disconnect client:" << mSessionId;
+		close(QWebSocketProtocol::CloseCodePolicyViolated, QStringLiteral("Too many pending messages"));
+		return;
+	}
+
+	mReceivedMessages.enqueue(pMessage.toUtf8());
+	if (isCongested())
+	{
+		qCDebug(websocket) << "Client is congested, hold back message:" << mSessionId << '|' << mBytesToWrite;
+	}
+
+	processReceivedMessages();
+}
+
+
+void WebSocketClient::onBytesWritten(qint64 pBytes)
+{
+	// The written bytes include the frame headers, so the counter must not become negative.
+	mBytesToWrite = std::max<qint64>(0, mBytesToWrite - pBytes);
+	processReceivedMessages();
+}
+
+
+const QUuid& WebSocketClient::getSessionId() const
+{
+	return mSessionId;
+}
+
+
+const QSharedPointer<WorkflowContext>& WebSocketClient::getContext() const
+{
+	return mContext;
+}
+
+
+void WebSocketClient::setContext(const QSharedPointer<WorkflowContext>& pContext)
+{
+	mContext = pContext;
+}
+
+
+void WebSocketClient::sendMessage(const QByteArray& pMessage)
+{
+	mBytesToWrite += mSocket->sendTextMessage(QString::fromUtf8(pMessage));
+}
+
+
+void WebSocketClient::close(QWebSocketProtocol::CloseCode pCode, const QString& pReason)
+{
+	mReceivedMessages.clear();
+	mSocket->close(pCode, pReason);
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Connection of a client to the WebSocket of the SDK.
+ *
+ * Received messages are held back as long as too many bytes of sent
+ * messages are not written to the client. A client that sends too many
+ * messages without reading the answers will be disconnected.
+ */
+
+#pragma once
+
+#include "context/WorkflowContext.h"
+
+#include <QByteArray>
+#include <QQueue>
+#include <QScopedPointer>
+#include <QSharedPointer>
+#include <QUuid>
+#include <QWebSocket>
+
+
+class test_WebSocketClient;
+
+
+namespace governikus
+{
+
+class WebSocketClient
+	: public QObject
+{
+	Q_OBJECT
+	friend class ::test_WebSocketClient;
+
+	private:
+		QScopedPointer<QWebSocket, QScopedPointerDeleteLater> mSocket;
+		const QUuid mSessionId;
+		QSharedPointer<WorkflowContext> mContext;
+		QQueue<QByteArray> mReceivedMessages;
+		qint64 mBytesToWrite;
+
+		[[nodiscard]] bool isCongested() const;
+		void processReceivedMessages();
+
+	private Q_SLOTS:
+		void onTextMessageReceived(const QString& pMessage);
+		void onBytesWritten(qint64 pBytes);
+
+	public:
+		static constexpr qint64 MAX_BYTES_TO_WRITE = 1024 * 1024;
+		static constexpr qsizetype MAX_RECEIVED_MESSAGES = 32;
+
+		WebSocketClient(QWebSocket* pSocket, const QUuid& pSessionId);
+		~WebSocketClient() override = default;
+
+		[[nodiscard]] const QUuid& getSessionId() const;
+		[[nodiscard]] const QSharedPointer<WorkflowContext>& getContext() const;
+		void setContext(const QSharedPointer<WorkflowContext>& pContext);
+
+		void sendMessage(const QByteArray& pMessage);
+		void close(QWebSocketProtocol::CloseCode pCode, const QString& pReason = QString());
+
+	Q_SIGNALS:
+		void fireMessageReceived(const QByteArray& pMessage);
+		void fireDisconnected();
+};
+
+} // namespace governikus
@@ -13,6 +13,25 @@ INIT_FUNCTION([] {
 		})
 
 
+WorkflowSession::WorkflowSession(const QUuid& pId, const VolatileSettings::WorkflowSettings& pSettings)
+	: mId(pId)
+	, mSettings(pSettings)
+{
+}
+
+
+const QUuid& WorkflowSession::getId() const
+{
+	return mId;
+}
+
+
+const VolatileSettings::WorkflowSettings& WorkflowSession::getSettings() const
+{
+	return mSettings;
+}
+
+
 WorkflowRequest::WorkflowRequest(const std::function<QSharedPointer<WorkflowController>(const QSharedPointer<WorkflowContext>&)>& pGeneratorController,
 		const std::function<QSharedPointer<WorkflowContext>()>& pGeneratorContext,
 		const BusyHandler& pHandler,
@@ -66,6 +85,29 @@ QVariant WorkflowRequest::getData() const
 }
 
 
+QUuid WorkflowRequest::getSessionId() const
+{
+	// Requests of an UI session carry the session as data.
+	if (mData.metaType() == QMetaType::fromType<WorkflowSession>())
+	{
+		return mData.value<WorkflowSession>().getId();
+	}
+
+	return QUuid();
+}
+
+
+std::optional<VolatileSettings::WorkflowSettings> WorkflowRequest::getSessionSettings() const
+{
+	if (mData.metaType() == QMetaType::fromType<WorkflowSession>())
+	{
+		return mData.value<WorkflowSession>().getSettings();
+	}
+
+	return std::nullopt;
+}
+
+
 WorkflowControl WorkflowRequest::handleBusyWorkflow(const QSharedPointer<WorkflowRequest>& pActiveWorkflow, const QSharedPointer<WorkflowRequest>& pWaitingWorkflow) const
 {
 	return mBusyHandler ? mBusyHandler(pActiveWorkflow, pWaitingWorkflow) : WorkflowControl::UNHANDLED;
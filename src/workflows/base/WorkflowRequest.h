@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include "VolatileSettings.h"
 #include "context/WorkflowContext.h"
 
 #include <QPair>
+#include <QUuid>
 #include <QVariant>
 
 #include <functional>
+#include <optional>
 #include <utility>
 
 namespace governikus
@@ -22,6 +25,22 @@ defineEnumType(WorkflowControl
 
 class WorkflowController;
 
+/*!
+ * Data of a request of an UI session. The settings are used while the workflow runs.
+ */
+class WorkflowSession
+{
+	private:
+		QUuid mId;
+		VolatileSettings::WorkflowSettings mSettings;
+
+	public:
+		WorkflowSession(const QUuid& pId = QUuid(), const VolatileSettings::WorkflowSettings& pSettings = VolatileSettings::WorkflowSettings());
+
+		[[nodiscard]] const QUuid& getId() const;
+		[[nodiscard]] const VolatileSettings::WorkflowSettings& getSettings() const;
+};
+
 class WorkflowRequest final
 {
 	Q_GADGET
@@ -86,6 +105,8 @@ class WorkflowRequest final
 		[[nodiscard]] QSharedPointer<WorkflowController> getController() const;
 		[[nodiscard]] QSharedPointer<WorkflowContext> getContext() const;
 		[[nodiscard]] QVariant getData() const;
+		[[nodiscard]] QUuid getSessionId() const;
+		[[nodiscard]] std::optional<VolatileSettings::WorkflowSettings> getSessionSettings() const;
 		[[nodiscard]] WorkflowControl handleBusyWorkflow(const QSharedPointer<WorkflowRequest>& pActiveWorkflow, const QSharedPointer<WorkflowRequest>& pWaitingWorkflow) const;
 };
 
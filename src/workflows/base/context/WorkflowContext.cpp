@@ -4,16 +4,29 @@
 
 #include "WorkflowContext.h"
 
+#include "NetworkManager.h"
 #include "ReaderManager.h"
 
 #if defined(Q_OS_ANDROID) || defined(Q_OS_IOS)
 	#include "VolatileSettings.h"
 #endif
 
+#include <QMutex>
+#include <QSet>
 #include <QWeakPointer>
 
+#include <algorithm>
+
 using namespace governikus;
 
+
+namespace
+{
+Q_GLOBAL_STATIC(QMutex, cContextMutex)
+Q_GLOBAL_STATIC(QSet<const WorkflowContext*>, cContexts)
+} // namespace
+
+
 WorkflowContext::WorkflowContext(const Action pAction, bool pActivateUi)
 	: QObject()
 	, mAction(pAction)
@@ -23,6 +36,7 @@ WorkflowContext::WorkflowContext(const Action pAction, bool pActivateUi)
 	, mCurrentState()
 	, mReaderPluginTypes()
 	, mReaderName()
+	, mConnectionScope()
 	, mCardConnection()
 	, mCardVanishedDuringPacePinCount(0)
 	, mCardVanishedDuringPacePinTimer()
@@ -50,11 +64,24 @@ WorkflowContext::WorkflowContext(const Action pAction, bool pActivateUi)
 	, mInitialInputErrorShown(false)
 {
 	connect(this, &WorkflowContext::fireCancelWorkflow, this, &WorkflowContext::onWorkflowCancelled);
+
+	const QMutexLocker locker(cContextMutex());
+	cContexts()->insert(this);
 }
 
 
 WorkflowContext::~WorkflowContext()
 {
+	{
+		const QMutexLocker locker(cContextMutex());
+		cContexts()->remove(this);
+	}
+
+	if (!mConnectionScope.isNull())
+	{
+		Env::getSingleton<NetworkManager>()->releaseConnectionScope(mConnectionScope);
+	}
+
 #ifndef QT_NO_DEBUG
 	if (!QCoreApplication::applicationName().startsWith(QLatin1String("Test")))
 	{
@@ -176,6 +203,36 @@ const QString& WorkflowContext::getReaderName() const
 }
 
 
+bool WorkflowContext::isReaderUsedByOtherWorkflow(const QString& pReaderName) const
+{
+	const QMutexLocker locker(cContextMutex());
+	return std::any_of(cContexts()->constBegin(), cContexts()->constEnd(), [this, &pReaderName](const WorkflowContext* pContext){
+			return pContext != this && pContext->wasClaimed() && !pContext->isWorkflowFinished() && pContext->getReaderName() == pReaderName;
+		});
+}
+
+
+bool WorkflowContext::hasOtherRunningWorkflows() const
+{
+	const QMutexLocker locker(cContextMutex());
+	return std::any_of(cContexts()->constBegin(), cContexts()->constEnd(), [this](const WorkflowContext* pContext){
+			return pContext != this && pContext->wasClaimed() && !pContext->isWorkflowFinished();
+		});
+}
+
+
+const QUuid& WorkflowContext::getConnectionScope() const
+{
+	return mConnectionScope;
+}
+
+
+void WorkflowContext::setConnectionScope(const QUuid& pScope)
+{
+	mConnectionScope = pScope;
+}
+
+
 void WorkflowContext::setReaderName(const QString& pReaderName)
 {
 	if (mReaderName != pReaderName)
@@ -18,6 +18,7 @@
 #include <QElapsedTimer>
 #include <QSharedPointer>
 #include <QString>
+#include <QUuid>
 #include <optional>
 
 namespace governikus
@@ -42,6 +43,7 @@ class WorkflowContext
 		QString mCurrentState;
 		QList<ReaderManagerPluginType> mReaderPluginTypes;
 		QString mReaderName;
+		QUuid mConnectionScope;
 		QSharedPointer<CardConnection> mCardConnection;
 		int mCardVanishedDuringPacePinCount;
 		QElapsedTimer mCardVanishedDuringPacePinTimer;
@@ -131,6 +133,20 @@ class WorkflowContext
 		[[nodiscard]] const QString& getReaderName() const;
 		void setReaderName(const QString& pReaderName);
 
+		/*!
+		 * Concurrent workflows must not share a reader. Finished workflows release their reader.
+		 */
+		[[nodiscard]] bool isReaderUsedByOtherWorkflow(const QString& pReaderName) const;
+		[[nodiscard]] bool hasOtherRunningWorkflows() const;
+
+		/*!
+		 * Network requests of the workflow use the connections of this scope, so
+		 * concurrent workflows do not share connections. The scope is released
+		 * with the context.
+		 */
+		[[nodiscard]] const QUuid& getConnectionScope() const;
+		void setConnectionScope(const QUuid& pScope);
+
 		[[nodiscard]] const QSharedPointer<CardConnection>& getCardConnection() const;
 		void setCardConnection(const QSharedPointer<CardConnection>& pCardConnection);
 		void resetCardConnection();
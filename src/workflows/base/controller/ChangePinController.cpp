@@ -65,7 +65,7 @@ ChangePinController::ChangePinController(QSharedPointer<ChangePinContext> pConte
 }
 
 
-QSharedPointer<WorkflowRequest> ChangePinController::createWorkflowRequest(bool pRequestTransportPin, bool pActivateUi)
+QSharedPointer<WorkflowRequest> ChangePinController::createWorkflowRequest(bool pRequestTransportPin, bool pActivateUi, const QVariant& pData)
 {
 	const auto& handler = [](const QSharedPointer<WorkflowRequest>& pActiveWorkflow, const QSharedPointer<WorkflowRequest>& pWaitingWorkflow){
 				Q_UNUSED(pActiveWorkflow)
@@ -78,5 +78,5 @@ QSharedPointer<WorkflowRequest> ChangePinController::createWorkflowRequest(bool
 				return WorkflowControl::SKIP;
 			};
 
-	return WorkflowRequest::createHandler<ChangePinController, ChangePinContext>(handler, pRequestTransportPin, pActivateUi);
+	return WorkflowRequest::createHandler<ChangePinController, ChangePinContext>(handler, pData, pRequestTransportPin, pActivateUi);
 }
@@ -23,7 +23,7 @@ class ChangePinController
 	Q_OBJECT
 
 	public:
-		static QSharedPointer<WorkflowRequest> createWorkflowRequest(bool pRequestTransportPin = false, bool pActivateUi = true);
+		static QSharedPointer<WorkflowRequest> createWorkflowRequest(bool pRequestTransportPin = false, bool pActivateUi = true, const QVariant& pData = QVariant());
 
 		explicit ChangePinController(QSharedPointer<ChangePinContext> pContext);
 		~ChangePinController() override = default;
@@ -41,9 +41,9 @@ void ElementDetector::detectStartElements(const QStringList& pStartElementNames)
 
 bool ElementDetector::handleStartElements(const QStringList& pStartElementNames)
 {
-	const QString name = mReader.name().toString();
-	if (pStartElementNames.contains(name))
+	if (pStartElementNames.contains(mReader.name()))
 	{
+		const QString name = mReader.name().toString();
 		QXmlStreamAttributes attributes = mReader.attributes();
 		QString value;
 		if (mReader.readNext() == QXmlStreamReader::TokenType::Characters && !mReader.isWhitespace())
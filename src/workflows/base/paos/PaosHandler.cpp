@@ -19,112 +19,170 @@ Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
 PaosHandler::PaosHandler(const QByteArray& pXmlData)
-	: ElementDetector(pXmlData)
+	: PaosParser(QString())
 	, mXmlData(pXmlData)
 	, mDetectedType(PaosType::UNKNOWN)
 	, mParsedObject()
 {
-	detect();
-	parse();
-}
+	PaosMessage* message = parse(mXmlData);
 
+	if (getXmlReader()->hasError())
+	{
+		qCWarning(paos) << "Error parsing PAOS message:" << getXmlReader()->errorString();
+		delete message;
+		message = nullptr;
+	}
 
-void PaosHandler::parse()
-{
-	if (mDetectedType == PaosType::INITIALIZE_FRAMEWORK)
+	if (mDetectedType != PaosType::UNKNOWN)
 	{
-		setParsedObject(new InitializeFramework(mXmlData));
+		setParsedObject(message);
 	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC1)
+	else
 	{
-		setParsedObject(DidAuthenticateEac1Parser().parse(mXmlData));
+		delete message;
 	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC2)
+}
+
+
+PaosMessage* PaosHandler::parseMessage()
+{
+	const auto& name = getElementName();
+	if (name == QLatin1String("InitializeFramework"))
 	{
-		setParsedObject(DidAuthenticateEac2Parser().parse(mXmlData));
+		mDetectedType = PaosType::INITIALIZE_FRAMEWORK;
+		skipCurrentElement();
+		return new InitializeFramework();
 	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE)
+
+	if (name == QLatin1String("DIDAuthenticate"))
 	{
-		setParsedObject(DidAuthenticateEacAdditionalParser().parse(mXmlData));
+		return parseDidAuthenticate();
 	}
-	else if (mDetectedType == PaosType::TRANSMIT)
+
+	if (name == QLatin1String("Transmit"))
 	{
-		setParsedObject(TransmitParser().parse(mXmlData));
+		mDetectedType = PaosType::TRANSMIT;
+		TransmitParser parser(getXmlReader());
+		auto* message = parser.parseElement();
+		if (parser.parserFailed())
+		{
+			setParserFailed();
+		}
+		return message;
 	}
-	else if (mDetectedType == PaosType::STARTPAOS_RESPONSE)
+
+	if (name == QLatin1String("StartPAOSResponse"))
 	{
-		setParsedObject(new StartPaosResponse(mXmlData));
+		// The response is small and parses its own result elements.
+		mDetectedType = PaosType::STARTPAOS_RESPONSE;
+		skipCurrentElement();
+		return new StartPaosResponse(mXmlData);
 	}
+
+	skipCurrentElement();
+	return nullptr;
 }
 
 
-void PaosHandler::setParsedObject(PaosMessage* pParsedObject)
+PaosMessage* PaosHandler::parseDidAuthenticate()
 {
-	if (pParsedObject == nullptr)
-	{
-		qCCritical(paos) << "Error parsing message. This is not a valid" << mDetectedType;
-		mDetectedType = PaosType::UNKNOWN;
-	}
-	else
+	PaosMessage* message = nullptr;
+	ConnectionHandle connectionHandle;
+	bool isConnectionHandleNotSet = true;
+	QString didName;
+
+	while (readNextStartElement())
 	{
-		mParsedObject = QSharedPointer<PaosMessage>(pParsedObject);
+		const auto& name = getElementName();
+		if (message != nullptr && (name == QLatin1String("ConnectionHandle") || name == QLatin1String("DIDName")))
+		{
+			// The message is created by the AuthenticationProtocolData.
+			qCWarning(paos) << "Element" << name << "after AuthenticationProtocolData";
+			setParserFailed();
+		}
+		else if (name == QLatin1String("ConnectionHandle"))
+		{
+			if (assertNoDuplicateElement(isConnectionHandleNotSet))
+			{
+				isConnectionHandleNotSet = false;
+				connectionHandle = parseConnectionHandle();
+			}
+		}
+		else if (name == QLatin1String("DIDName"))
+		{
+			readUniqueElementText(didName);
+		}
+		else if (name == QLatin1String("AuthenticationProtocolData"))
+		{
+			if (assertNoDuplicateElement(message == nullptr))
+			{
+				message = parseAuthenticationProtocolData(connectionHandle, didName);
+			}
+		}
+		else
+		{
+			qCWarning(paos) << "Unknown element:" << name;
+			skipCurrentElement();
+		}
 	}
+
+	return message;
 }
 
 
-bool PaosHandler::handleFoundElement(QStringView pElementName, const QString&, const QXmlStreamAttributes& pAttributes)
+PaosMessage* PaosHandler::parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName)
 {
-	if (pElementName == QLatin1String("InitializeFramework"))
+	PaosMessage* message = nullptr;
+	bool failed = false;
+
+	const auto type = getElementType();
+	if (type.endsWith(QLatin1String("EAC1InputType")))
 	{
-		mDetectedType = PaosType::INITIALIZE_FRAMEWORK;
+		mDetectedType = PaosType::DID_AUTHENTICATE_EAC1;
+		DidAuthenticateEac1Parser parser(getXmlReader());
+		message = parser.parseAuthenticationProtocolData(pConnectionHandle, pDidName);
+		failed = parser.parserFailed();
 	}
-	else if (pElementName == QLatin1String("DIDAuthenticate"))
+	else if (type.endsWith(QLatin1String("EAC2InputType")))
 	{
-		detectStartElements({QStringLiteral("AuthenticationProtocolData")});
+		mDetectedType = PaosType::DID_AUTHENTICATE_EAC2;
+		DidAuthenticateEac2Parser parser(getXmlReader());
+		message = parser.parseAuthenticationProtocolData(pConnectionHandle, pDidName);
+		failed = parser.parserFailed();
 	}
-	else if (pElementName == QLatin1String("AuthenticationProtocolData"))
+	else if (type.endsWith(QLatin1String("EACAdditionalInputType")))
 	{
-		for (const auto& attribute : pAttributes)
-		{
-			if (attribute.value().endsWith(QLatin1String("EAC1InputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC1;
-			}
-			else if (attribute.value().endsWith(QLatin1String("EAC2InputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC2;
-			}
-			else if (attribute.value().endsWith(QLatin1String("EACAdditionalInputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE;
-			}
-		}
+		mDetectedType = PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE;
+		DidAuthenticateEacAdditionalParser parser(getXmlReader());
+		message = parser.parseAuthenticationProtocolData(pConnectionHandle, pDidName);
+		failed = parser.parserFailed();
 	}
-	else if (pElementName == QLatin1String("Transmit"))
+	else
 	{
-		mDetectedType = PaosType::TRANSMIT;
+		qCWarning(paos) << "Unknown AuthenticationProtocolData:" << type;
+		skipCurrentElement();
 	}
-	else if (pElementName == QLatin1String("StartPAOSResponse"))
+
+	if (failed)
 	{
-		mDetectedType = PaosType::STARTPAOS_RESPONSE;
+		setParserFailed();
 	}
 
-	return mDetectedType == PaosType::UNKNOWN;
+	return message;
 }
 
 
-void PaosHandler::detect()
+void PaosHandler::setParsedObject(PaosMessage* pParsedObject)
 {
-	const QStringList expectedElements({
-				QStringLiteral("InitializeFramework"),
-				QStringLiteral("DIDList"),
-				QStringLiteral("DIDAuthenticate"),
-				QStringLiteral("Transmit"),
-				QStringLiteral("Disconnect"),
-				QStringLiteral("StartPAOSResponse")
-			});
-
-	detectStartElements(expectedElements);
+	if (pParsedObject == nullptr)
+	{
+		qCCritical(paos) << "Error parsing message. This is not a valid" << mDetectedType;
+		mDetectedType = PaosType::UNKNOWN;
+	}
+	else
+	{
+		mParsedObject = QSharedPointer<PaosMessage>(pParsedObject);
+	}
 }
 
 
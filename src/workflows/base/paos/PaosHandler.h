@@ -4,21 +4,23 @@
 
 /*!
  * \brief Generic Handler to detect and parse paos types.
+ *
+ * The message is read in a single pass. The type is detected by the element
+ * of the body and the matching parser continues on the same reader.
  */
 
 #pragma once
 
-#include "paos/ElementDetector.h"
 #include "paos/PaosMessage.h"
+#include "paos/retrieve/PaosParser.h"
 
 #include <QSharedPointer>
-#include <QXmlStreamReader>
 
 namespace governikus
 {
 
 class PaosHandler
-	: private ElementDetector
+	: private PaosParser
 {
 	Q_DISABLE_COPY(PaosHandler)
 
@@ -27,11 +29,12 @@ class PaosHandler
 		PaosType mDetectedType;
 		QSharedPointer<PaosMessage> mParsedObject;
 
-		void detect();
-		void parse();
 		void setParsedObject(PaosMessage* pParsedObject);
+		PaosMessage* parseDidAuthenticate();
+		PaosMessage* parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName);
 
-		bool handleFoundElement(QStringView pElementName, const QString& pValue, const QXmlStreamAttributes& pAttributes) override;
+	protected:
+		PaosMessage* parseMessage() override;
 
 	public:
 		explicit PaosHandler(const QByteArray& pXmlData);
@@ -52,6 +52,40 @@ QString ElementParser::readElementText()
 }
 
 
+QByteArray ElementParser::readElementHex()
+{
+	QByteArray hex;
+
+	while (mXmlReader->error() == QXmlStreamReader::NoError && !mXmlReader->isEndElement())
+	{
+		const auto token = mXmlReader->readNext();
+		if (token == QXmlStreamReader::TokenType::StartElement)
+		{
+			// Like QXmlStreamReader::readElementText() a child element is not allowed.
+			mXmlReader->raiseError(QStringLiteral("Expected character data."));
+		}
+		else if (token == QXmlStreamReader::TokenType::Characters && !mXmlReader->isWhitespace())
+		{
+			// Invalid characters like whitespace are skipped by QByteArray::fromHex.
+			const auto text = mXmlReader->text();
+			hex.reserve(hex.size() + text.size());
+			for (const auto character : text)
+			{
+				hex += character.toLatin1();
+			}
+		}
+	}
+
+	if (mXmlReader->error() != QXmlStreamReader::NoError)
+	{
+		return QByteArray();
+	}
+
+	const auto& data = QByteArray::fromHex(hex);
+	return data.isNull() ? QByteArray("") : data;
+}
+
+
 bool ElementParser::assertNoDuplicateElement(bool pNotYetSeen)
 {
 	if (!pNotYetSeen)
@@ -106,6 +140,12 @@ QStringView ElementParser::getElementTypeByNamespace(const QString& pNamespace)
 }
 
 
+const QSharedPointer<QXmlStreamReader>& ElementParser::getXmlReader() const
+{
+	return mXmlReader;
+}
+
+
 void ElementParser::initData(const QByteArray& pXmlData)
 {
 	mParseError = false;
@@ -49,6 +49,15 @@ class ElementParser
 		 */
 		QString readElementText();
 
+		/*!
+		 * \brief Returns the hex decoded text between the current start element and the corresponding end element.
+		 *
+		 * The text is collected without building an intermediate QString, so large payloads
+		 * like certificates are only copied once. A child element is an error of the reader.
+		 * \return The decoded element text on success (may be isEmpty(), but not isNull()), QByteArray() on error.
+		 */
+		QByteArray readElementHex();
+
 		/*!
 		 * \brief Issues a log warning and sets the error when the element has not been set, i.e. the element is null.
 		 * \param pValue the elements value to check.
@@ -101,6 +110,8 @@ class ElementParser
 
 		[[nodiscard]] QStringView getElementTypeByNamespace(const QString& pNamespace) const;
 
+		[[nodiscard]] const QSharedPointer<QXmlStreamReader>& getXmlReader() const;
+
 	private:
 		QSharedPointer<QXmlStreamReader> mXmlReader;
 		bool mParseError;
@@ -8,6 +8,8 @@
 
 #include <QDebug>
 
+#include <algorithm>
+
 
 using namespace governikus;
 
@@ -37,8 +39,9 @@ const QMap<PaosCreator::Namespace, QString> PaosCreator::mNamespace = {
 
 PaosCreator::PaosCreator()
 	: mContent()
+	, mBody()
 	, mRelatedMessageId()
-	, mWriter(&mContent)
+	, mWriter(&mBody)
 {
 	mWriter.setAutoFormatting(true);
 }
@@ -88,7 +91,7 @@ QByteArray PaosCreator::marshall()
 {
 	if (mContent.isNull())
 	{
-		createEnvelopeElement();
+		createEnvelope();
 	}
 	return mContent;
 }
@@ -100,77 +103,132 @@ void PaosCreator::setRelatedMessageId(const QString& pId)
 }
 
 
-void PaosCreator::createHeaderElement()
+QByteArray PaosCreator::createEnvelopeHead()
 {
-	mWriter.writeStartElement(getNamespacePrefix(Namespace::SOAP, QStringLiteral("Header")));
-
-	mWriter.writeStartElement(getNamespacePrefix(Namespace::PAOS, QStringLiteral("PAOS")));
+	QByteArray data;
+	QXmlStreamWriter writer(&data);
+	writer.setAutoFormatting(true);
+	writer.writeStartDocument();
+
+	writer.writeStartElement(getNamespacePrefix(Namespace::SOAP, QStringLiteral("Envelope")));
+	writer.writeAttribute(getNamespacePrefix(Namespace::SOAP), getNamespace(Namespace::SOAP));
+	writer.writeAttribute(getNamespacePrefix(Namespace::XSD), getNamespace(Namespace::XSD));
+	writer.writeAttribute(getNamespacePrefix(Namespace::XSI), getNamespace(Namespace::XSI));
+	writer.writeAttribute(getNamespacePrefix(Namespace::PAOS), getNamespace(Namespace::PAOS));
+	writer.writeAttribute(getNamespacePrefix(Namespace::ADDRESSING), getNamespace(Namespace::ADDRESSING));
+	writer.writeAttribute(getNamespacePrefix(Namespace::DSS), getNamespace(Namespace::DSS));
+	writer.writeAttribute(getNamespacePrefix(Namespace::ECARD), getNamespace(Namespace::ECARD));
+	writer.writeAttribute(getNamespacePrefix(Namespace::TECHSCHEMA), getNamespace(Namespace::TECHSCHEMA));
+
+	writer.writeStartElement(getNamespacePrefix(Namespace::SOAP, QStringLiteral("Header")));
+
+	writer.writeStartElement(getNamespacePrefix(Namespace::PAOS, QStringLiteral("PAOS")));
 	{
-		mWriter.writeAttribute(getNamespacePrefix(Namespace::SOAP, QStringLiteral("mustUnderstand")), QStringLiteral("1"));
-		mWriter.writeAttribute(getNamespacePrefix(Namespace::SOAP, QStringLiteral("actor")), QStringLiteral("http://schemas.xmlsoap.org/soap/actor/next"));
-		mWriter.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("Version")), getNamespace(Namespace::PAOS));
+		writer.writeAttribute(getNamespacePrefix(Namespace::SOAP, QStringLiteral("mustUnderstand")), QStringLiteral("1"));
+		writer.writeAttribute(getNamespacePrefix(Namespace::SOAP, QStringLiteral("actor")), QStringLiteral("http://schemas.xmlsoap.org/soap/actor/next"));
+		writer.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("Version")), getNamespace(Namespace::PAOS));
 
-		mWriter.writeStartElement(getNamespaceType(Namespace::PAOS, QStringLiteral("EndpointReference")));
+		writer.writeStartElement(getNamespaceType(Namespace::PAOS, QStringLiteral("EndpointReference")));
 		{
-			mWriter.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("Address")), QStringLiteral("http://www.projectliberty.org/2006/01/role/paos"));
+			writer.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("Address")), QStringLiteral("http://www.projectliberty.org/2006/01/role/paos"));
 
-			mWriter.writeStartElement(getNamespaceType(Namespace::PAOS, QStringLiteral("MetaData")));
+			writer.writeStartElement(getNamespaceType(Namespace::PAOS, QStringLiteral("MetaData")));
 			{
-				mWriter.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("ServiceType")), QStringLiteral("http://www.bsi.bund.de/ecard/api/1.1/PAOS/GetNextCommand"));
+				writer.writeTextElement(getNamespaceType(Namespace::PAOS, QStringLiteral("ServiceType")), QStringLiteral("http://www.bsi.bund.de/ecard/api/1.1/PAOS/GetNextCommand"));
 			}
-			mWriter.writeEndElement(); // MetaData
+			writer.writeEndElement(); // MetaData
 		}
-		mWriter.writeEndElement(); // EndpointReference
+		writer.writeEndElement(); // EndpointReference
 	}
-	mWriter.writeEndElement(); // PAOS
+	writer.writeEndElement(); // PAOS
 
-	mWriter.writeStartElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("ReplyTo")));
+	writer.writeStartElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("ReplyTo")));
 	{
-		mWriter.writeTextElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("Address")), QStringLiteral("http://www.projectliberty.org/2006/02/role/paos"));
+		writer.writeTextElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("Address")), QStringLiteral("http://www.projectliberty.org/2006/02/role/paos"));
 	}
-	mWriter.writeEndElement(); // ReplyTo
+	writer.writeEndElement(); // ReplyTo
 
-	if (!mRelatedMessageId.isNull())
-	{
-		mWriter.writeTextElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("RelatesTo")), mRelatedMessageId);
-	}
+	return data;
+}
 
-	const auto& id = QStringLiteral("urn:uuid:") + Randomizer::getInstance().createUuid().toString(QUuid::WithoutBraces);
-	mWriter.writeTextElement(getNamespaceType(Namespace::ADDRESSING, QStringLiteral("MessageID")), id);
 
-	mWriter.writeEndElement(); // Header
+const QByteArray& PaosCreator::getEnvelopeHead()
+{
+	static const QByteArray head = createEnvelopeHead();
+	return head;
 }
 
 
-void PaosCreator::writeTextElement(const QString& pQualifiedName, const QByteArray& pText)
+bool PaosCreator::isPlainText(QByteArrayView pText)
 {
-	mWriter.writeTextElement(pQualifiedName, QString::fromLatin1(pText));
+	return std::all_of(pText.begin(), pText.end(), [](char pChar){
+				return pChar >= 0x20 && pChar <= 0x7E && pChar != '<' && pChar != '>' && pChar != '&' && pChar != '"';
+			});
 }
 
 
-void PaosCreator::createEnvelopeElement()
+void PaosCreator::appendText(QByteArray& pContent, const QString& pText)
 {
-	mWriter.writeStartDocument();
+	const auto& text = pText.toUtf8();
+	if (isPlainText(text))
+	{
+		pContent += text;
+		return;
+	}
+
+	QByteArray escaped;
+	QXmlStreamWriter writer(&escaped);
+	writer.writeCharacters(pText);
+	pContent += escaped;
+}
 
-	mWriter.writeStartElement(getNamespacePrefix(Namespace::SOAP, QStringLiteral("Envelope")));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::SOAP), getNamespace(Namespace::SOAP));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::XSD), getNamespace(Namespace::XSD));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::XSI), getNamespace(Namespace::XSI));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::PAOS), getNamespace(Namespace::PAOS));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::ADDRESSING), getNamespace(Namespace::ADDRESSING));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::DSS), getNamespace(Namespace::DSS));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::ECARD), getNamespace(Namespace::ECARD));
-	mWriter.writeAttribute(getNamespacePrefix(Namespace::TECHSCHEMA), getNamespace(Namespace::TECHSCHEMA));
 
-	createHeaderElement();
+void PaosCreator::createEnvelope()
+{
+	// The parts around the head and the body match the auto formatting of QXmlStreamWriter.
+	const auto& head = getEnvelopeHead();
+	mContent.reserve(head.size() + 512);
+	mContent += head;
 
-	mWriter.writeStartElement(getNamespacePrefix(Namespace::SOAP, QStringLiteral("Body")));
+	if (!mRelatedMessageId.isNull())
+	{
+		mContent += "\n        <wsa:RelatesTo>";
+		appendText(mContent, mRelatedMessageId);
+		mContent += "</wsa:RelatesTo>";
+	}
+
+	mContent += "\n        <wsa:MessageID>urn:uuid:";
+	mContent += Randomizer::getInstance().createUuid().toByteArray(QUuid::WithoutBraces);
+	mContent += "</wsa:MessageID>"
+				"\n    </soap:Header>"
+				"\n    <soap:Body>";
+
+	appendBodyElement(mContent);
+
+	mContent += "</soap:Body>"
+				"\n</soap:Envelope>"
+				"\n";
+}
+
+
+void PaosCreator::appendBodyElement(QByteArray& pContent)
+{
+	// Same depth as in the envelope to get the same indentation.
+	mWriter.writeStartElement(QStringLiteral("Envelope"));
+	mWriter.writeStartElement(QStringLiteral("Body"));
 	createBodyElement(mWriter);
 	mWriter.writeEndElement(); // Body
-
 	mWriter.writeEndElement(); // Envelope
 
-	mWriter.writeEndDocument();
+	const auto start = mBody.indexOf("<Body>") + 6;
+	const auto end = mBody.lastIndexOf("</Body>");
+	pContent += QByteArrayView(mBody).sliced(start, end - start);
+}
+
+
+void PaosCreator::writeTextElement(const QString& pQualifiedName, const QByteArray& pText)
+{
+	mWriter.writeTextElement(pQualifiedName, QString::fromLatin1(pText));
 }
 
 
@@ -30,16 +30,37 @@ class PaosCreator
 		static const QMap<Namespace, QString> mNamespace;
 
 		QByteArray mContent;
+		QByteArray mBody;
 		QString mRelatedMessageId;
 		QXmlStreamWriter mWriter;
 
-		void createEnvelopeElement();
-		void createHeaderElement();
+		void createEnvelope();
+		[[nodiscard]] static QByteArray createEnvelopeHead();
+		[[nodiscard]] static const QByteArray& getEnvelopeHead();
 
 	protected:
 		void writeTextElement(const QString& pQualifiedName, const QByteArray& pText);
 		virtual void createBodyElement(QXmlStreamWriter& pWriter) = 0;
 
+		/*!
+		 * \brief Appends the body element including the whitespace around it.
+		 *
+		 * The envelope is copied from a precomputed template, only the body is written
+		 * by createBodyElement(). Subclasses may override this to copy their body from
+		 * templates as well.
+		 */
+		virtual void appendBodyElement(QByteArray& pContent);
+
+		/*!
+		 * \brief Returns true if the text can be copied without XML escaping, like hex data and URIs.
+		 */
+		[[nodiscard]] static bool isPlainText(QByteArrayView pText);
+
+		/*!
+		 * \brief Appends the text with the same XML escaping as QXmlStreamWriter.
+		 */
+		static void appendText(QByteArray& pContent, const QString& pText);
+
 		void createResultElement(const ResponseType& pResponse);
 
 		PaosCreator();
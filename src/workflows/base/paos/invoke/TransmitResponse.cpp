@@ -9,6 +9,8 @@ using namespace governikus;
 TransmitResponse::TransmitResponse()
 	: ResponseType(PaosType::TRANSMIT_RESPONSE)
 	, mOutputApdus()
+	, mOutputApduElements()
+	, mOutputApdusPlainText(true)
 {
 }
 
@@ -30,7 +32,70 @@ void TransmitResponse::createBodyElement(QXmlStreamWriter& pWriter)
 }
 
 
+void TransmitResponse::appendBodyElement(QByteArray& pContent)
+{
+	// The OutputAPDU elements are rendered by appendOutputApdu() already, copy them without QXmlStreamWriter.
+	// A ResultMessage contains arbitrary text and is rare, so leave it to the writer.
+	const ECardApiResult& result = getResult();
+	if (!result.getMessage().isNull() || !mOutputApdusPlainText)
+	{
+		PaosCreator::appendBodyElement(pContent);
+		return;
+	}
+
+	static const QByteArray bodyStart = QStringLiteral("\n        <TransmitResponse xmlns=\"%1\" Profile=\"%2\">"
+													   "\n            <Result xmlns=\"%3\">"
+													   "\n                <ResultMajor>").arg(
+			getNamespace(Namespace::TECHSCHEMA),
+			getNamespace(Namespace::ECARD),
+			getNamespace(Namespace::DSS)).toUtf8();
+
+	pContent.reserve(pContent.size() + bodyStart.size() + mOutputApduElements.size() + 256);
+
+	pContent += bodyStart;
+	appendText(pContent, result.getMajorString());
+	pContent += "</ResultMajor>";
+	if (result.getMinor() != ECardApiResult::Minor::null)
+	{
+		pContent += "\n                <ResultMinor>";
+		appendText(pContent, result.getMinorString());
+		pContent += "</ResultMinor>";
+	}
+	pContent += "\n            </Result>";
+	pContent += mOutputApduElements;
+	pContent += "\n        </TransmitResponse>"
+				"\n    ";
+}
+
+
+const QByteArrayList& TransmitResponse::getOutputApdus() const
+{
+	return mOutputApdus;
+}
+
+
 void TransmitResponse::setOutputApdus(const QByteArrayList& outputApdus)
 {
-	mOutputApdus = outputApdus;
+	mOutputApdus.clear();
+	mOutputApduElements.clear();
+	mOutputApdusPlainText = true;
+	for (const auto& apdu : outputApdus)
+	{
+		appendOutputApdu(apdu);
+	}
+}
+
+
+void TransmitResponse::appendOutputApdu(const QByteArray& pOutputApdu)
+{
+	mOutputApdus += pOutputApdu;
+	if (!mOutputApdusPlainText || !isPlainText(pOutputApdu))
+	{
+		mOutputApdusPlainText = false;
+		return;
+	}
+
+	mOutputApduElements += "\n            <OutputAPDU>";
+	mOutputApduElements += pOutputApdu;
+	mOutputApduElements += "</OutputAPDU>";
 }
@@ -22,13 +22,23 @@ class TransmitResponse
 
 	private:
 		QByteArrayList mOutputApdus;
+		QByteArray mOutputApduElements;
+		bool mOutputApdusPlainText;
 
 		void createBodyElement(QXmlStreamWriter& pWriter) override;
+		void appendBodyElement(QByteArray& pContent) override;
 
 	public:
 		TransmitResponse();
 
+		[[nodiscard]] const QByteArrayList& getOutputApdus() const;
 		void setOutputApdus(const QByteArrayList& outputApdus);
+
+		/*!
+		 * \brief Appends a response of the card and renders its element, so
+		 * that the body is already prepared when the last response arrives.
+		 */
+		void appendOutputApdu(const QByteArray& pOutputApdu);
 };
 
 } // namespace governikus
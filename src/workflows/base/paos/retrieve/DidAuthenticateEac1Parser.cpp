@@ -17,12 +17,23 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
-DidAuthenticateEac1Parser::DidAuthenticateEac1Parser()
-	: PaosParser(QStringLiteral("DIDAuthenticate"))
+DidAuthenticateEac1Parser::DidAuthenticateEac1Parser(QSharedPointer<QXmlStreamReader> pXmlReader)
+	: PaosParser(QStringLiteral("DIDAuthenticate"), pXmlReader)
 {
 }
 
 
+PaosMessage* DidAuthenticateEac1Parser::parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName)
+{
+	mDidAuthenticateEac1.reset(new DIDAuthenticateEAC1());
+	mDidAuthenticateEac1->setConnectionHandle(pConnectionHandle);
+	mDidAuthenticateEac1->setDidName(pDidName);
+	mDidAuthenticateEac1->setEac1InputType(parseEac1InputType());
+
+	return parserFailed() ? nullptr : mDidAuthenticateEac1.release();
+}
+
+
 PaosMessage* DidAuthenticateEac1Parser::parseMessage()
 {
 	mDidAuthenticateEac1.reset(new DIDAuthenticateEAC1());
@@ -129,9 +140,9 @@ void DidAuthenticateEac1Parser::parseCertificateDescription(Eac1InputType& pEac1
 {
 	if (readUniqueElementText(pCertificateDescription))
 	{
-		const QByteArray certDesc = pCertificateDescription.toLatin1();
-		pEac1.setCertificateDescriptionAsBinary(QByteArray::fromHex(certDesc));
-		pEac1.setCertificateDescription(CertificateDescription::fromHex(certDesc));
+		const auto& certDesc = QByteArray::fromHex(pCertificateDescription.toLatin1());
+		pEac1.setCertificateDescriptionAsBinary(certDesc);
+		pEac1.setCertificateDescription(CertificateDescription::decode(certDesc));
 		if (pEac1.getCertificateDescription() == nullptr)
 		{
 			qCCritical(paos) << "Cannot parse CertificateDescription";
@@ -181,9 +192,9 @@ void DidAuthenticateEac1Parser::parseAuthenticatedAuxiliaryData(Eac1InputType& p
 {
 	if (readUniqueElementText(pAuthenticatedAuxiliaryData))
 	{
-		const QByteArray data = pAuthenticatedAuxiliaryData.toUtf8();
-		pEac1.setAuthenticatedAuxiliaryDataAsBinary(QByteArray::fromHex(data));
-		pEac1.setAuthenticatedAuxiliaryData(AuthenticatedAuxiliaryData::fromHex(data));
+		const auto& data = QByteArray::fromHex(pAuthenticatedAuxiliaryData.toUtf8());
+		pEac1.setAuthenticatedAuxiliaryDataAsBinary(data);
+		pEac1.setAuthenticatedAuxiliaryData(AuthenticatedAuxiliaryData::decode(data));
 		if (pEac1.getAuthenticatedAuxiliaryData() == nullptr)
 		{
 			qCCritical(paos) << "Cannot parse AuthenticatedAuxiliaryData";
@@ -204,7 +215,7 @@ void DidAuthenticateEac1Parser::parseTransactionInfo(Eac1InputType& pEac1, QStri
 
 void DidAuthenticateEac1Parser::parseCertificate(Eac1InputType& pEac1)
 {
-	if (auto cvc = CVCertificate::fromRaw(QByteArray::fromHex(readElementText().toLatin1())))
+	if (auto cvc = CVCertificate::fromRaw(readElementHex()))
 	{
 		qCDebug(paos) << "Linked Certificate (Authority):" << cvc->getBody().getCertificationAuthorityReference();
 		qCDebug(paos) << "Certificate Name (Holder):" << cvc->getBody().getCertificateHolderReference();
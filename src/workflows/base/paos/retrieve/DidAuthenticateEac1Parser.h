@@ -20,7 +20,13 @@ class DidAuthenticateEac1Parser
 	: public PaosParser
 {
 	public:
-		DidAuthenticateEac1Parser();
+		explicit DidAuthenticateEac1Parser(QSharedPointer<QXmlStreamReader> pXmlReader = QSharedPointer<QXmlStreamReader>::create());
+
+		/*!
+		 * \brief Creates the message from the AuthenticationProtocolData at the current position of the reader.
+		 * Used by \ref PaosHandler after it detected the type of the DIDAuthenticate.
+		 */
+		PaosMessage* parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName);
 
 	protected:
 		PaosMessage* parseMessage() override;
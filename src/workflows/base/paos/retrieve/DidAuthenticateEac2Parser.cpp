@@ -17,12 +17,23 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
-DidAuthenticateEac2Parser::DidAuthenticateEac2Parser()
-	: PaosParser(QStringLiteral("DIDAuthenticate"))
+DidAuthenticateEac2Parser::DidAuthenticateEac2Parser(QSharedPointer<QXmlStreamReader> pXmlReader)
+	: PaosParser(QStringLiteral("DIDAuthenticate"), pXmlReader)
 {
 }
 
 
+PaosMessage* DidAuthenticateEac2Parser::parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName)
+{
+	mDidAuthenticateEac2.reset(new DIDAuthenticateEAC2());
+	mDidAuthenticateEac2->setConnectionHandle(pConnectionHandle);
+	mDidAuthenticateEac2->setDidName(pDidName);
+	mDidAuthenticateEac2->setEac2InputType(parseEac2InputType());
+
+	return parserFailed() ? nullptr : mDidAuthenticateEac2.release();
+}
+
+
 PaosMessage* DidAuthenticateEac2Parser::parseMessage()
 {
 	mDidAuthenticateEac2.reset(new DIDAuthenticateEAC2());
@@ -103,8 +114,7 @@ Eac2InputType DidAuthenticateEac2Parser::parseEac2InputType()
 
 void DidAuthenticateEac2Parser::parseCertificate(Eac2InputType& pEac2)
 {
-	const QByteArray hexCvc = readElementText().toLatin1();
-	if (auto cvc = CVCertificate::fromRaw(QByteArray::fromHex(hexCvc)))
+	if (auto cvc = CVCertificate::fromRaw(readElementHex()))
 	{
 		pEac2.appendCvcert(cvc);
 	}
@@ -23,9 +23,11 @@ class DidAuthenticateEac2Parser
 	: public PaosParser
 {
 	public:
-		DidAuthenticateEac2Parser();
+		explicit DidAuthenticateEac2Parser(QSharedPointer<QXmlStreamReader> pXmlReader = QSharedPointer<QXmlStreamReader>::create());
 		~DidAuthenticateEac2Parser() override = default;
 
+		PaosMessage* parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName);
+
 	protected:
 		PaosMessage* parseMessage() override;
 
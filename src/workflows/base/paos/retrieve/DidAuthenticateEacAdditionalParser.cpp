@@ -17,12 +17,23 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
-DidAuthenticateEacAdditionalParser::DidAuthenticateEacAdditionalParser()
-	: PaosParser(QStringLiteral("DIDAuthenticate"))
+DidAuthenticateEacAdditionalParser::DidAuthenticateEacAdditionalParser(QSharedPointer<QXmlStreamReader> pXmlReader)
+	: PaosParser(QStringLiteral("DIDAuthenticate"), pXmlReader)
 {
 }
 
 
+PaosMessage* DidAuthenticateEacAdditionalParser::parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName)
+{
+	mDidAuthenticateEacAdditional.reset(new DIDAuthenticateEACAdditional());
+	mDidAuthenticateEacAdditional->setConnectionHandle(pConnectionHandle);
+	mDidAuthenticateEacAdditional->setDidName(pDidName);
+	mDidAuthenticateEacAdditional->setSignature(parseEacAdditionalInputType());
+
+	return parserFailed() ? nullptr : mDidAuthenticateEacAdditional.release();
+}
+
+
 PaosMessage* DidAuthenticateEacAdditionalParser::parseMessage()
 {
 	mDidAuthenticateEacAdditional.reset(new DIDAuthenticateEACAdditional());
@@ -23,9 +23,11 @@ class DidAuthenticateEacAdditionalParser
 	: public PaosParser
 {
 	public:
-		DidAuthenticateEacAdditionalParser();
+		explicit DidAuthenticateEacAdditionalParser(QSharedPointer<QXmlStreamReader> pXmlReader = QSharedPointer<QXmlStreamReader>::create());
 		~DidAuthenticateEacAdditionalParser() override = default;
 
+		PaosMessage* parseAuthenticationProtocolData(const ConnectionHandle& pConnectionHandle, const QString& pDidName);
+
 	protected:
 		PaosMessage* parseMessage() override;
 
@@ -11,6 +11,13 @@
 
 using namespace governikus;
 
+InitializeFramework::InitializeFramework()
+	: PaosMessage(PaosType::INITIALIZE_FRAMEWORK)
+	, ElementDetector(QByteArray())
+{
+}
+
+
 InitializeFramework::InitializeFramework(const QByteArray& pXmlData)
 	: PaosMessage(PaosType::INITIALIZE_FRAMEWORK)
 	, ElementDetector(pXmlData)
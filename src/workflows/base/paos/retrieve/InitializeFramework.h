@@ -23,6 +23,7 @@ class InitializeFramework
 		bool handleFoundElement(QStringView pElementName, const QString& pValue, const QXmlStreamAttributes& pAttributes) override;
 
 	public:
+		InitializeFramework();
 		explicit InitializeFramework(const QByteArray& pXmlData);
 };
 
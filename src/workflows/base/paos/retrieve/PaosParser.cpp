@@ -16,8 +16,8 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
-PaosParser::PaosParser(const QString& pMessageName)
-	: ElementParser(QSharedPointer<QXmlStreamReader>::create())
+PaosParser::PaosParser(const QString& pMessageName, QSharedPointer<QXmlStreamReader> pXmlReader)
+	: ElementParser(pXmlReader)
 	, mMessageName(pMessageName)
 	, mMessageID()
 	, mRelatesTo()
@@ -66,8 +66,28 @@ PaosMessage* PaosParser::parse(const QByteArray& pXmlData)
 
 	if (message != nullptr)
 	{
-		message->setMessageId(mMessageID);
-		message->setRelatesTo(mRelatesTo);
+		// Keep the values of messages that parse the header on their own.
+		if (!mMessageID.isNull())
+		{
+			message->setMessageId(mMessageID);
+		}
+		if (!mRelatesTo.isNull())
+		{
+			message->setRelatesTo(mRelatesTo);
+		}
+	}
+
+	return message;
+}
+
+
+PaosMessage* PaosParser::parseElement()
+{
+	PaosMessage* message = parseMessage();
+	if (parserFailed())
+	{
+		delete message;
+		return nullptr;
 	}
 
 	return message;
@@ -76,7 +96,7 @@ PaosMessage* PaosParser::parse(const QByteArray& pXmlData)
 
 QStringView PaosParser::getElementType() const
 {
-	QString ns = PaosCreator::getNamespace(PaosCreator::Namespace::XSI);
+	static const QString ns = PaosCreator::getNamespace(PaosCreator::Namespace::XSI);
 	return getElementTypeByNamespace(ns);
 }
 
@@ -84,14 +104,16 @@ QStringView PaosParser::getElementType() const
 PaosMessage* PaosParser::parseEnvelope()
 {
 	PaosMessage* message = nullptr;
+	bool isBodyNotSet = true;
 
 	while (readNextStartElement())
 	{
 		const auto& name = getElementName();
 		if (name == QLatin1String("Body"))
 		{
-			if (assertNoDuplicateElement(message == nullptr))
+			if (assertNoDuplicateElement(isBodyNotSet))
 			{
+				isBodyNotSet = false;
 				message = parseBody();
 			}
 		}
@@ -105,7 +127,7 @@ PaosMessage* PaosParser::parseEnvelope()
 		}
 	}
 
-	if (!parserFailed() && message == nullptr)
+	if (!parserFailed() && isBodyNotSet)
 	{
 		qCWarning(paos) << "Element Body not found";
 	}
@@ -141,7 +163,7 @@ PaosMessage* PaosParser::parseBody()
 
 	while (readNextStartElement())
 	{
-		if (getElementName() == mMessageName)
+		if (mMessageName.isEmpty() || getElementName() == mMessageName)
 		{
 			if (assertNoDuplicateElement(message == nullptr))
 			{
@@ -154,7 +176,7 @@ PaosMessage* PaosParser::parseBody()
 		}
 	}
 
-	if (!parserFailed() && message == nullptr)
+	if (!parserFailed() && message == nullptr && !mMessageName.isEmpty())
 	{
 		qCWarning(paos) << "Element" << mMessageName << "not found";
 	}
@@ -18,11 +18,21 @@ class PaosParser
 	: public ElementParser
 {
 	public:
-		explicit PaosParser(const QString& pMessageName);
+		explicit PaosParser(const QString& pMessageName, QSharedPointer<QXmlStreamReader> pXmlReader = QSharedPointer<QXmlStreamReader>::create());
 		~PaosParser() override;
 
+		/*!
+		 * \brief Parses the envelope and the message element named like the message name.
+		 * If the message name is empty, every element of the body is passed to parseMessage().
+		 */
 		PaosMessage* parse(const QByteArray& pXmlData);
 
+		/*!
+		 * \brief Parses the message element at the current position of a shared reader.
+		 * Used if the envelope has already been parsed by the caller.
+		 */
+		PaosMessage* parseElement();
+
 	protected:
 		virtual PaosMessage* parseMessage() = 0;
 
@@ -14,8 +14,8 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(paos)
 
 
-TransmitParser::TransmitParser()
-	: PaosParser(QStringLiteral("Transmit"))
+TransmitParser::TransmitParser(QSharedPointer<QXmlStreamReader> pXmlReader)
+	: PaosParser(QStringLiteral("Transmit"), pXmlReader)
 {
 }
 
@@ -60,14 +60,20 @@ void TransmitParser::parseInputApduInfo()
 {
 	InputAPDUInfo inputApduInfo;
 
-	QString inputApdu;
+	QByteArray inputApdu;
 
 	while (readNextStartElement())
 	{
 		const auto& name = getElementName();
 		if (name == QLatin1String("InputAPDU"))
 		{
-			if (!readUniqueElementText(inputApdu))
+			if (!assertNoDuplicateElement(inputApdu.isNull()))
+			{
+				return;
+			}
+
+			inputApdu = readElementHex();
+			if (inputApdu.isNull())
 			{
 				return;
 			}
@@ -90,7 +96,7 @@ void TransmitParser::parseInputApduInfo()
 		return;
 	}
 
-	inputApduInfo.setInputApdu(QByteArray::fromHex(inputApdu.toUtf8()));
+	inputApduInfo.setInputApdu(inputApdu);
 
 	mTransmit->appendInputApduInfo(inputApduInfo);
 }
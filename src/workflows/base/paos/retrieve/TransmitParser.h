@@ -22,7 +22,7 @@ class TransmitParser
 	: public PaosParser
 {
 	public:
-		TransmitParser();
+		explicit TransmitParser(QSharedPointer<QXmlStreamReader> pXmlReader = QSharedPointer<QXmlStreamReader>::create());
 		~TransmitParser() override = default;
 
 	protected:
@@ -5,6 +5,7 @@
 #include "StateCertificateDescriptionCheck.h"
 
 #include "AppSettings.h"
+#include "NetworkManager.h"
 #include "UrlUtil.h"
 #include "asn1/Oid.h"
 
@@ -92,5 +93,6 @@ void StateCertificateDescriptionCheck::run()
 		}
 	}
 
+	Env::getSingleton<NetworkManager>()->prefetch(QUrl(subjectUrlString));
 	Q_EMIT fireContinue();
 }
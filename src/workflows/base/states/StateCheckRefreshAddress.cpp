@@ -85,7 +85,7 @@ void StateCheckRefreshAddress::run()
 		// When the tcToken provided a psk, it is necessary to clear
 		// all connections to force new connections without psk settings
 		// after we finished the authentication communication.
-		Env::getSingleton<NetworkManager>()->clearConnections();
+		Env::getSingleton<NetworkManager>()->clearConnections(getContext()->getConnectionScope());
 	}
 
 	mUrl = tcToken->getRefreshAddress();
@@ -160,6 +160,7 @@ void StateCheckRefreshAddress::sendGetRequest()
 {
 	qDebug() << "Send GET request to URL:" << mUrl.toString();
 	QNetworkRequest request(mUrl);
+	NetworkManager::setConnectionScope(request, getContext()->getConnectionScope());
 	mReply = Env::getSingleton<NetworkManager>()->get(request);
 
 	*this << connect(mReply.data(), &QNetworkReply::sslErrors, this, &StateCheckRefreshAddress::onSslErrors);
@@ -386,12 +387,13 @@ void StateCheckRefreshAddress::fetchServerCertificate()
 
 	qDebug() << "Fetch TLS certificate for URL" << mUrl;
 	QNetworkRequest request(mUrl);
+	NetworkManager::setConnectionScope(request, getContext()->getConnectionScope());
 
 	// Clear all connections to ensure a fresh connection is established and the
 	// encrypted signal is emitted, see Qt documentation QNetworkReply::encrypted():
 	//
 	// "...This means that you are only guaranteed to receive this signal for the first connection to a site in the lifespan of the QNetworkAccessManager."
-	Env::getSingleton<NetworkManager>()->clearConnections();
+	Env::getSingleton<NetworkManager>()->clearConnections(getContext()->getConnectionScope());
 	mReply = Env::getSingleton<NetworkManager>()->head(request);
 
 	*this << connect(mReply.data(), &QNetworkReply::encrypted, this, &StateCheckRefreshAddress::onSslHandshakeDoneFetchingServerCertificate);
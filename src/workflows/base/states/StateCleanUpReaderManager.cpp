@@ -40,7 +40,11 @@ void StateCleanUpReaderManager::run()
 	const auto& status = context->getStatus();
 	auto* readerManager = Env::getSingleton<ReaderManager>();
 	const auto* volatileSettings = Env::getSingleton<VolatileSettings>();
-	if (volatileSettings->isUsedAsSDK())
+	if (context->hasOtherRunningWorkflows())
+	{
+		qDebug() << "Keep readers of concurrent workflows";
+	}
+	else if (volatileSettings->isUsedAsSDK())
 	{
 #ifdef Q_OS_IOS
 		readerManager->stopScan(ReaderManagerPluginType::NFC, status.isError() ? volatileSettings->getMessages().getSessionFailed() : QString());
@@ -42,6 +42,7 @@ void StateGenericProviderCommunication::run()
 	const QByteArray payload = getPayload();
 
 	QNetworkRequest request(address);
+	NetworkManager::setConnectionScope(request, getContext()->getConnectionScope());
 	if (payload.isEmpty())
 	{
 		mReply = Env::getSingleton<NetworkManager>()->get(request);
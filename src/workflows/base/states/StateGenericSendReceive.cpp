@@ -266,6 +266,7 @@ void StateGenericSendReceive::run()
 	}
 
 	QNetworkRequest request(serverAddress);
+	NetworkManager::setConnectionScope(request, getContext()->getConnectionScope());
 	request.setRawHeader("requestid", token->getSessionIdentifier());
 	const QByteArray& data = getAsCreator()->marshall();
 	Q_ASSERT(!data.isEmpty());
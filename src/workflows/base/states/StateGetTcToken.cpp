@@ -44,7 +44,7 @@ void StateGetTcToken::run()
 	// At this time we start the first network communication in a
 	// workflow. Therefore it is necessary to clear all connections
 	// to force new connections with the expected security settings.
-	Env::getSingleton<NetworkManager>()->clearConnections();
+	Env::getSingleton<NetworkManager>()->clearConnections(getContext()->getConnectionScope());
 	sendRequest(url);
 }
 
@@ -89,7 +89,10 @@ void StateGetTcToken::sendRequest(const QUrl& pUrl)
 {
 	qCDebug(network) << "Fetch TCToken URL:" << pUrl;
 	QNetworkRequest request(pUrl);
-	mReply = Env::getSingleton<NetworkManager>()->get(request);
+	NetworkManager::setConnectionScope(request, getContext()->getConnectionScope());
+	auto* networkManager = Env::getSingleton<NetworkManager>();
+	networkManager->resumeSslSession(request);
+	mReply = networkManager->get(request);
 	*this << connect(mReply.data(), &QNetworkReply::sslErrors, this, &StateGetTcToken::onSslErrors);
 	*this << connect(mReply.data(), &QNetworkReply::encrypted, this, &StateGetTcToken::onSslHandshakeDone);
 	*this << connect(mReply.data(), &QNetworkReply::finished, this, &StateGetTcToken::onNetworkReply);
@@ -149,6 +152,7 @@ void StateGetTcToken::onSslHandshakeDone()
 	auto context = getContext();
 	context->addCertificateData(mReply->request().url(), cfg.peerCertificate());
 	context->setSslSession(cfg.sessionTicket());
+	Env::getSingleton<NetworkManager>()->cacheSslSession(mReply->request().url(), cfg);
 }
 
 
@@ -243,11 +247,16 @@ void StateGetTcToken::parseTcToken()
 
 	if (tcToken->isValid())
 	{
+		// Resolve the hosts of the trusted channel and the redirect while the workflow proceeds.
+		auto* networkManager = Env::getSingleton<NetworkManager>();
+		networkManager->prefetch(tcToken->getServerAddress());
+		networkManager->prefetch(tcToken->getRefreshAddress());
+
 		if (tcToken->usePsk())
 		{
 			// When the tcToken provides a psk, it is necessary to clear
 			// all connections to force new connections with psk settings.
-			Env::getSingleton<NetworkManager>()->clearConnections();
+			Env::getSingleton<NetworkManager>()->clearConnections(getContext()->getConnectionScope());
 		}
 		Q_EMIT fireContinue();
 		return;
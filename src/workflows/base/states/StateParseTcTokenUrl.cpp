@@ -8,6 +8,8 @@
 
 #include "StateParseTcTokenUrl.h"
 
+#include "NetworkManager.h"
+
 #include <QUrlQuery>
 
 using namespace governikus;
@@ -26,6 +28,7 @@ void StateParseTcTokenUrl::run()
 	if (tcTokenURL.isValid())
 	{
 		getContext()->setTcTokenUrl(tcTokenURL);
+		Env::getSingleton<NetworkManager>()->prefetch(tcTokenURL);
 		Q_EMIT fireContinue();
 	}
 	else
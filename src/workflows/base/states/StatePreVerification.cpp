@@ -71,7 +71,7 @@ void StatePreVerification::run()
 		Q_EMIT fireAbort(FailureCode::Reason::Pre_Verification_Invalid_Certificate_Chain);
 		return;
 	}
-	else if (!SignatureChecker(certificateChain).check())
+	else if (!SignatureChecker(certificateChain, mValidationDateTime).check())
 	{
 		qCritical() << "Pre-verification failed: signature check failed";
 		updateStatus(GlobalStatus::Code::Workflow_Preverification_Error);
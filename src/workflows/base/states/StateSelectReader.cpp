@@ -57,6 +57,12 @@ void StateSelectReader::onReaderInfoChanged()
 
 	for (const auto& info : allReaders)
 	{
+		if (context->isReaderUsedByOtherWorkflow(info.getName()))
+		{
+			qCDebug(statemachine) << "Skip reader of concurrent workflow:" << info.getName();
+			continue;
+		}
+
 		if (info.hasEid())
 		{
 			if (info.insufficientApduLength())
@@ -24,22 +24,41 @@ void StateTransmit::run()
 
 	auto cardConnection = getContext()->getCardConnection();
 	Q_ASSERT(cardConnection != nullptr);
+	*this << connect(cardConnection.data(), &CardConnection::fireTransmitOutputApdu, this, &StateTransmit::onOutputApdu);
 	*this << cardConnection->callTransmitCommand(this, &StateTransmit::onCardCommandDone, transmit->getInputApduInfos());
 }
 
 
+void StateTransmit::onOutputApdu(const QByteArray& pOutputApduAsHex) const
+{
+	getContext()->getTransmitResponse()->appendOutputApdu(pOutputApduAsHex);
+}
+
+
+void StateTransmit::setOutputApdus(const QByteArrayList& pOutputApdusAsHex) const
+{
+	// The responses were appended while the card was busy, so this is only
+	// a fallback if the command did not announce all of them.
+	const auto& transmitResponse = getContext()->getTransmitResponse();
+	if (transmitResponse->getOutputApdus() != pOutputApdusAsHex)
+	{
+		transmitResponse->setOutputApdus(pOutputApdusAsHex);
+	}
+}
+
+
 void StateTransmit::onCardCommandDone(QSharedPointer<BaseCardCommand> pCommand)
 {
 	auto transmitCommand = pCommand.staticCast<TransmitCommand>();
 	auto returnCode = transmitCommand->getReturnCode();
 	if (returnCode == CardReturnCode::OK)
 	{
-		getContext()->getTransmitResponse()->setOutputApdus(transmitCommand->getOutputApduAsHex());
+		setOutputApdus(transmitCommand->getOutputApduAsHex());
 		Q_EMIT fireContinue();
 	}
 	else if (returnCode == CardReturnCode::UNEXPECTED_TRANSMIT_STATUS)
 	{
-		getContext()->getTransmitResponse()->setOutputApdus(transmitCommand->getOutputApduAsHex());
+		setOutputApdus(transmitCommand->getOutputApduAsHex());
 		updateStatus(CardReturnCodeUtil::toGlobalStatus(returnCode)); // set the result to the model so it is written to the PAOS response
 		Q_EMIT fireContinue();
 	}
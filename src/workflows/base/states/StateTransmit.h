@@ -4,6 +4,9 @@
 
 /*!
  * \brief Process received transmits. Send it to the card and create a response.
+ *
+ * The response is assembled while the card is busy, every OutputAPDU is appended
+ * as soon as the card returns it.
  */
 
 #pragma once
@@ -28,8 +31,10 @@ class StateTransmit
 	private:
 		explicit StateTransmit(const QSharedPointer<WorkflowContext>& pContext);
 		void run() override;
+		void setOutputApdus(const QByteArrayList& pOutputApdusAsHex) const;
 
 	private Q_SLOTS:
+		void onOutputApdu(const QByteArray& pOutputApduAsHex) const;
 		void onCardCommandDone(QSharedPointer<BaseCardCommand> pCommand);
 
 	public:
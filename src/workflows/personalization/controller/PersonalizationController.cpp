@@ -165,7 +165,7 @@ PersonalizationController::PersonalizationController(QSharedPointer<Personalizat
 }
 
 
-QSharedPointer<WorkflowRequest> PersonalizationController::createWorkflowRequest(const QString& pAppletServiceUrl)
+QSharedPointer<WorkflowRequest> PersonalizationController::createWorkflowRequest(const QString& pAppletServiceUrl, const QVariant& pData)
 {
-	return WorkflowRequest::create<PersonalizationController, PersonalizationContext>(pAppletServiceUrl);
+	return WorkflowRequest::createHandler<PersonalizationController, PersonalizationContext>(nullptr, pData, pAppletServiceUrl);
 }
@@ -22,7 +22,7 @@ class PersonalizationController
 	Q_OBJECT
 
 	public:
-		static QSharedPointer<WorkflowRequest> createWorkflowRequest(const QString& pAppletServiceUrl);
+		static QSharedPointer<WorkflowRequest> createWorkflowRequest(const QString& pAppletServiceUrl, const QVariant& pData = QVariant());
 
 		explicit PersonalizationController(QSharedPointer<PersonalizationContext> pContext);
 		~PersonalizationController() override = default;
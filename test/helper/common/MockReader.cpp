@@ -68,12 +68,18 @@ MockCard* MockReader::setCard(const MockCardConfig& pCardConfig, const QByteArra
 
 
 MockCard* MockReader::setCard(const MockCardConfig& pCardConfig, const QSharedPointer<EFCardAccess>& pEfCardAccess, CardType pType, const FileRef& pApplication)
+{
+	return setCard(new MockCard(pCardConfig), pEfCardAccess, pType, pApplication);
+}
+
+
+MockCard* MockReader::setCard(MockCard* pCard, const QSharedPointer<EFCardAccess>& pEfCardAccess, CardType pType, const FileRef& pApplication)
 {
 	// some unit tests uses MockReader without ReaderManager. So avoid a deadlock here.
 	Qt::ConnectionType type = QThread::currentThread() == QObject::thread() ? Qt::DirectConnection : Qt::BlockingQueuedConnection;
 
-	QMetaObject::invokeMethod(this, [this, pCardConfig, pEfCardAccess, pType, pApplication] {
-			mCard.reset(new MockCard(pCardConfig));
+	QMetaObject::invokeMethod(this, [this, pCard, pEfCardAccess, pType, pApplication] {
+			mCard.reset(pCard);
 			setInfoCardInfo(CardInfo(pType, pApplication, pEfCardAccess));
 			Q_EMIT fireReaderPropertiesUpdated(getReaderInfo());
 		}, type);
@@ -44,6 +44,7 @@ class MockReader
 
 		MockCard* setCard(const MockCardConfig& pCardConfig, const QByteArray& pEfCardAccess, CardType pType = CardType::EID_CARD);
 		MockCard* setCard(const MockCardConfig& pCardConfig, const QSharedPointer<EFCardAccess>& pEfCardAccess = QSharedPointer<EFCardAccess>(), CardType pType = CardType::EID_CARD, const FileRef& pApplication = FileRef());
+		MockCard* setCard(MockCard* pCard, const QSharedPointer<EFCardAccess>& pEfCardAccess, CardType pType = CardType::EID_CARD, const FileRef& pApplication = FileRef());
 
 		void setReaderInfo(const ReaderInfo& pReaderInfo);
 		void setInfoBasicReader(bool pBasicReader);
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReplayCard.h"
+
+#include "pinpad/EstablishPaceChannel.h"
+
+#include <QDebug>
+#include <QThread>
+
+
+using namespace governikus;
+
+
+ReplayCard::ReplayCard(const QList<ApduRecorder::Record>& pRecords, double pTimeScale)
+	: MockCard(MockCardConfig())
+	, mRecords(pRecords)
+	, mTimeScale(pTimeScale)
+{
+}
+
+
+std::optional<ApduRecorder::Record> ReplayCard::takeRecord(ApduRecordOperation pOperation, const QByteArray& pCommand)
+{
+	if (mRecords.isEmpty())
+	{
+		qWarning() << "No (more) recorded response APDU, but a(nother) command transmitted:" << pOperation << pCommand.toHex();
+		return std::nullopt;
+	}
+
+	const auto record = mRecords.takeFirst();
+	if (record.mOperation != pOperation || record.mCommand != pCommand)
+	{
+		qWarning() << "Command differs from the recording. Expected:" << record.mOperation << record.mCommand.toHex() << "got:" << pOperation << pCommand.toHex();
+		return std::nullopt;
+	}
+
+	const auto delay = static_cast<qint64>(static_cast<double>(record.mDuration) * mTimeScale);
+	if (delay > 0)
+	{
+		QThread::usleep(static_cast<unsigned long>(delay));
+	}
+
+	return record;
+}
+
+
+ResponseApduResult ReplayCard::transmit(const CommandApdu& pCmd)
+{
+	const auto record = takeRecord(ApduRecordOperation::TRANSMIT, pCmd);
+	if (!record.has_value())
+	{
+		return {CardReturnCode::COMMAND_FAILED};
+	}
+
+	return {record->mReturnCode, ResponseApdu(record->mResponse)};
+}
+
+
+EstablishPaceChannelOutput ReplayCard::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription)
+{
+	Q_UNUSED(pPreferredPinLength)
+
+	const EstablishPaceChannel input(pPasswordId, pChat, pCertificateDescription);
+	const auto record = takeRecord(ApduRecordOperation::ESTABLISH_PACE_CHANNEL, input.createASN1StructCcid());
+	if (!record.has_value())
+	{
+		return EstablishPaceChannelOutput(CardReturnCode::COMMAND_FAILED);
+	}
+
+	EstablishPaceChannelOutput output;
+	if (!output.parseFromCcid(record->mResponse))
+	{
+		qWarning() << "Cannot parse the recorded EstablishPaceChannelOutput";
+	}
+	output.setPaceReturnCode(record->mReturnCode);
+	return output;
+}
+
+
+CardReturnCode ReplayCard::destroyPaceChannel()
+{
+	const auto record = takeRecord(ApduRecordOperation::DESTROY_PACE_CHANNEL, QByteArray());
+	return record.has_value() ? record->mReturnCode : CardReturnCode::COMMAND_FAILED;
+}
+
+
+ResponseApduResult ReplayCard::setEidPin(quint8 pTimeoutSeconds)
+{
+	const auto record = takeRecord(ApduRecordOperation::SET_EID_PIN, QByteArray(1, static_cast<char>(pTimeoutSeconds)));
+	if (!record.has_value())
+	{
+		return {CardReturnCode::COMMAND_FAILED};
+	}
+
+	return {record->mReturnCode, ResponseApdu(record->mResponse)};
+}
+
+
+qsizetype ReplayCard::getRemainingRecords() const
+{
+	return mRecords.size();
+}
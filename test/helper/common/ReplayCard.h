@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Card that plays back a recording of \ref ApduRecorder
+ *
+ * Every transmitted command has to match the next recorded command. The
+ * PACE channel and PIN commands of a comfort reader are played back the same
+ * way. The recorded duration is multiplied by the time scale, so a scale of 0 plays
+ * the recording as fast as possible.
+ */
+
+#pragma once
+
+#include "ApduRecorder.h"
+#include "MockCard.h"
+
+#include <QList>
+
+#include <optional>
+
+
+namespace governikus
+{
+
+class ReplayCard
+	: public MockCard
+{
+	Q_OBJECT
+
+	private:
+		QList<ApduRecorder::Record> mRecords;
+		double mTimeScale;
+
+		std::optional<ApduRecorder::Record> takeRecord(ApduRecordOperation pOperation, const QByteArray& pCommand);
+
+	public:
+		explicit ReplayCard(const QList<ApduRecorder::Record>& pRecords, double pTimeScale = 1.0);
+
+		ResponseApduResult transmit(const CommandApdu& pCmd) override;
+		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription) override;
+		CardReturnCode destroyPaceChannel() override;
+		ResponseApduResult setEidPin(quint8 pTimeoutSeconds) override;
+
+		[[nodiscard]] qsizetype getRemainingRecords() const;
+};
+
+
+} // namespace governikus
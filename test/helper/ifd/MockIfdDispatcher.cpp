@@ -71,7 +71,7 @@ void MockIfdDispatcher::send(const QSharedPointer<const IfdMessage>& pMessage)
 		bool withCard = (mState == DispatcherState::ReaderWithCard || mState == DispatcherState::ReaderWithCardError);
 		ReaderInfo info(QStringLiteral("NFC Reader"), ReaderManagerPluginType::PCSC, CardInfo(withCard ? CardType::EID_CARD : CardType::NONE));
 		const QSharedPointer<IfdMessage> message(new IfdStatus(info));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), IfdMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 		return;
 	}
 
@@ -82,7 +82,7 @@ void MockIfdDispatcher::send(const QSharedPointer<const IfdMessage>& pMessage)
 		const QSharedPointer<const IfdConnect> request = pMessage.staticCast<const IfdConnect>();
 		const QString readerName = request->getSlotName();
 		const QSharedPointer<IfdMessage> message(new IfdConnectResponse(readerName, resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), IfdMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 
 	if (pMessage->getType() == IfdMessageType::IFDTransmit)
@@ -90,7 +90,7 @@ void MockIfdDispatcher::send(const QSharedPointer<const IfdMessage>& pMessage)
 		const QSharedPointer<const IfdTransmit> request = pMessage.staticCast<const IfdTransmit>();
 		const QString readerName = request->getSlotHandle();
 		const QSharedPointer<IfdMessage> message(new IfdTransmitResponse(readerName, resultMinor == ECardApiResult::Minor::null ? QByteArray("pong") : QByteArray(), resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), IfdMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 
 	if (pMessage->getType() == IfdMessageType::IFDDisconnect)
@@ -98,7 +98,7 @@ void MockIfdDispatcher::send(const QSharedPointer<const IfdMessage>& pMessage)
 		const QSharedPointer<const IfdDisconnect> request = pMessage.staticCast<const IfdDisconnect>();
 		const QString readerName = request->getSlotHandle();
 		const QSharedPointer<IfdMessage> message(new IfdDisconnectResponse(readerName, resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), IfdMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 }
 
@@ -123,5 +123,5 @@ void MockIfdDispatcher::onClosed()
 
 void MockIfdDispatcher::onReceived(const QSharedPointer<const IfdMessage>& pMessage)
 {
-	Q_EMIT fireReceived(pMessage->getType(), QJsonDocument::fromJson(pMessage->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+	Q_EMIT fireReceived(pMessage->getType(), IfdMessage::parseByteArray(pMessage->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 }
@@ -5,6 +5,10 @@
 #include "pcscmock.h"
 
 #include <QByteArray>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
 #include <QtGlobal>
 #include <winscard.h>
 #ifndef Q_OS_WIN
@@ -14,6 +18,11 @@
 struct MockSCardCommandData
 {
 	LONG mSCardGetStatusChange = 0;
+	QMutex mMutex;
+	QWaitCondition mStateChanged;
+	QStringList mReaderNames;
+	QMap<QString, DWORD> mReaderStates;
+	quint64 mCancelCounter = 0;
 }
 mMockData;
 
@@ -30,6 +39,22 @@ LONG governikus::getResultGetCardStatus()
 }
 
 
+void governikus::setReaderNames(const QStringList& pReaderNames)
+{
+	const QMutexLocker locker(&mMockData.mMutex);
+	mMockData.mReaderNames = pReaderNames;
+	mMockData.mStateChanged.wakeAll();
+}
+
+
+void governikus::setReaderState(const QString& pReaderName, DWORD pState)
+{
+	const QMutexLocker locker(&mMockData.mMutex);
+	mMockData.mReaderStates.insert(pReaderName, pState);
+	mMockData.mStateChanged.wakeAll();
+}
+
+
 LONG SCardEstablishContext(DWORD dwScope, LPCVOID pvReserved1, LPCVOID pvReserved2, LPSCARDCONTEXT phContext)
 {
 	Q_UNUSED(dwScope)
@@ -79,14 +104,105 @@ LONG SCardDisconnect(SCARDHANDLE hCard, DWORD dwDisposition)
 }
 
 
+LONG SCardListReaders(SCARDCONTEXT hContext, LPCSTR mszGroups, LPSTR mszReaders, LPDWORD pcchReaders)
+{
+	Q_ASSERT(hContext == 4);
+	Q_UNUSED(mszGroups)
+
+	const QMutexLocker locker(&mMockData.mMutex);
+	if (mMockData.mReaderNames.isEmpty())
+	{
+		return SCARD_E_NO_READERS_AVAILABLE;
+	}
+
+	QByteArray readers;
+	for (const auto& readerName : std::as_const(mMockData.mReaderNames))
+	{
+		readers += readerName.toUtf8() + '\0';
+	}
+	readers += '\0';
+
+	const auto size = static_cast<DWORD>(readers.size());
+	if (mszReaders != nullptr)
+	{
+		if (*pcchReaders < size)
+		{
+			return SCARD_E_INSUFFICIENT_BUFFER;
+		}
+		memcpy(mszReaders, readers.data(), static_cast<size_t>(size));
+	}
+	*pcchReaders = size;
+
+	return SCARD_S_SUCCESS;
+}
+
+
 LONG SCardGetStatusChange(SCARDCONTEXT hContext, DWORD dwTimeout, SCARD_READERSTATE* rgReaderStates, DWORD cReaders)
 {
 	Q_ASSERT(hContext == 4);
-	Q_UNUSED(dwTimeout)
-	Q_UNUSED(rgReaderStates)
-	Q_UNUSED(cReaders)
 
-	return governikus::getResultGetCardStatus();
+	const auto result = governikus::getResultGetCardStatus();
+	if (result != SCARD_S_SUCCESS)
+	{
+		return result;
+	}
+
+	QMutexLocker locker(&mMockData.mMutex);
+	const auto cancelCounter = mMockData.mCancelCounter;
+	for (;;)
+	{
+		bool changed = false;
+		for (DWORD i = 0; i < cReaders; ++i)
+		{
+			auto& state = rgReaderStates[i];
+			const auto& readerName = QString::fromUtf8(state.szReader);
+
+			DWORD eventState = SCARD_STATE_UNAWARE;
+			if (readerName == QLatin1String("\\\\?PnP?\\Notification"))
+			{
+				eventState = static_cast<DWORD>(mMockData.mReaderNames.size()) << 16;
+			}
+			else if (!mMockData.mReaderNames.contains(readerName))
+			{
+				eventState = SCARD_STATE_UNKNOWN | SCARD_STATE_IGNORE;
+			}
+			else
+			{
+				eventState = mMockData.mReaderStates.value(readerName, SCARD_STATE_EMPTY);
+			}
+
+			if (eventState != (state.dwCurrentState & ~static_cast<DWORD>(SCARD_STATE_CHANGED)))
+			{
+				eventState |= SCARD_STATE_CHANGED;
+				changed = true;
+			}
+			state.dwEventState = eventState;
+		}
+
+		if (changed)
+		{
+			return SCARD_S_SUCCESS;
+		}
+
+		if (cancelCounter != mMockData.mCancelCounter)
+		{
+			return SCARD_E_CANCELLED;
+		}
+
+		if (dwTimeout == 0)
+		{
+			return SCARD_E_TIMEOUT;
+		}
+
+		if (dwTimeout == INFINITE)
+		{
+			mMockData.mStateChanged.wait(&mMockData.mMutex);
+		}
+		else if (!mMockData.mStateChanged.wait(&mMockData.mMutex, dwTimeout))
+		{
+			return SCARD_E_TIMEOUT;
+		}
+	}
 }
 
 
@@ -94,6 +210,10 @@ LONG SCardCancel(SCARDCONTEXT hContext)
 {
 	Q_ASSERT(hContext == 4);
 
+	const QMutexLocker locker(&mMockData.mMutex);
+	++mMockData.mCancelCounter;
+	mMockData.mStateChanged.wakeAll();
+
 	return SCARD_S_SUCCESS;
 }
 
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <QString>
+#include <QStringList>
+
 #ifndef Q_OS_WIN
 	#include <wintypes.h>
 #endif
@@ -14,4 +17,16 @@ namespace governikus
 void setResultGetCardStatus(LONG pReturnCode);
 LONG getResultGetCardStatus();
 
+/*!
+ * Changes the readers returned by SCardListReaders and wakes up
+ * any blocking call of SCardGetStatusChange.
+ */
+void setReaderNames(const QStringList& pReaderNames);
+
+/*!
+ * Changes the event state of a reader reported by SCardGetStatusChange
+ * and wakes up any blocking call of SCardGetStatusChange.
+ */
+void setReaderState(const QString& pReaderName, DWORD pState);
+
 } // namespace governikus
@@ -27,6 +27,7 @@ class test_UiPluginWebSocket
 
 		QScopedPointer<QProcess> mApp2;
 		QScopedPointer<WebSocketHelper> mHelper;
+		quint16 mPort = 0;
 
 	private Q_SLOTS:
 		void initTestCase()
@@ -54,6 +55,12 @@ class test_UiPluginWebSocket
 			mApp2->setProgram(app);
 			mApp2->setWorkingDirectory(path);
 			mApp2->setArguments(args);
+			if (QTest::currentTestFunction() == QByteArrayLiteral("multipleConnections"))
+			{
+				auto env = QProcessEnvironment::systemEnvironment();
+				env.insert(QStringLiteral("AUSWEISAPP2_WEBSOCKET_CONNECTIONS"), QStringLiteral("2"));
+				mApp2->setProcessEnvironment(env);
+			}
 
 			mApp2->start();
 			mApp2->waitForStarted(PROCESS_TIMEOUT);
@@ -69,6 +76,7 @@ class test_UiPluginWebSocket
 
 			mHelper.reset(new WebSocketHelper(webSocketPort));
 			QTRY_VERIFY_WITH_TIMEOUT(mHelper->isConnected(), PROCESS_TIMEOUT);
+			mPort = webSocketPort;
 		}
 
 
@@ -148,6 +156,26 @@ class test_UiPluginWebSocket
 		}
 
 
+		void multipleConnections()
+		{
+			WebSocketHelper secondHelper(mPort);
+			QTRY_VERIFY_WITH_TIMEOUT(secondHelper.isConnected(), PROCESS_TIMEOUT);
+
+			WebSocketHelper thirdHelper(mPort);
+			QTRY_COMPARE_WITH_TIMEOUT(thirdHelper.getState(), QAbstractSocket::UnconnectedState, PROCESS_TIMEOUT); // clazy:exclude=qstring-allocations
+
+			secondHelper.sendMessage("{\"cmd\": \"GET_API_LEVEL\", \"requestId\": \"second\"}"_L1);
+			QVERIFY(secondHelper.waitForMessage([](const QJsonObject& pMessage){
+					return pMessage["msg"_L1] == "API_LEVEL"_L1 && pMessage["requestId"_L1] == "second"_L1;
+				}));
+
+			mHelper->sendMessage("{\"cmd\": \"GET_API_LEVEL\", \"requestId\": \"first\"}"_L1);
+			QVERIFY(mHelper->waitForMessage([](const QJsonObject& pMessage){
+					return pMessage["msg"_L1] == "API_LEVEL"_L1 && pMessage["requestId"_L1] == "first"_L1;
+				}));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_UiPluginWebSocket)
@@ -41,11 +41,23 @@ class test_ChainBuilder
 		return pChild.at(0) == pParent.at(1);
 	}
 
+
+	static QByteArray getIssuer(const QByteArray& pElement)
+	{
+		return pElement.left(1);
+	}
+
+
+	static QByteArray getSubject(const QByteArray& pElement)
+	{
+		return pElement.mid(1, 1);
+	}
+
 	private Q_SLOTS:
 		void testEmpty()
 		{
 			const QList<QByteArray> allElements;
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QVERIFY(chainBuilder.getChains().isEmpty());
 		}
@@ -54,7 +66,7 @@ class test_ChainBuilder
 		void testOneShortChain()
 		{
 			const QList<QByteArray> allElements({"AB"});
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 1);
 			QCOMPARE(chainBuilder.getChains().at(0).size(), 1);
@@ -64,7 +76,7 @@ class test_ChainBuilder
 		void testManyShortChain()
 		{
 			const QList<QByteArray> allElements({"AB", "AC", "AD", "AE"});
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 4);
 			QCOMPARE(chainBuilder.getChains().at(0).size(), 1);
@@ -77,7 +89,7 @@ class test_ChainBuilder
 		void testShortChainWithDuplicates()
 		{
 			const QList<QByteArray> allElements({"AB", "AC", "AB", "AC", "AC", "AB"});
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 2);
 			QCOMPARE(chainBuilder.getChains().at(0).size(), 1);
@@ -88,7 +100,7 @@ class test_ChainBuilder
 		void testOneLongChain()
 		{
 			const QList<QByteArray> allElements({"AB", "BC", "CD", "DE", "EF", "FG"});
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 1);
 			QCOMPARE(chainBuilder.getChains().at(0).size(), 6);
@@ -98,7 +110,7 @@ class test_ChainBuilder
 		void testOneLongChainWithDuplicates()
 		{
 			const QList<QByteArray> allElements({"AB", "BC", "BC", "CD", "BC", "CD", "DE", "DE", "EF", "BC", "FG"});
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 1);
 			QCOMPARE(chainBuilder.getChains().at(0).size(), 6);
@@ -120,7 +132,7 @@ class test_ChainBuilder
 			 */
 			const QList<QByteArray> allElements({"AA", "AB", "BC", "CD", "DE", "BB"});
 
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 2);
 			QVERIFY(chainBuilder.getChains().contains(QList<QByteArray>({"AA", "AB", "BC", "CD", "DE"})));
@@ -143,7 +155,7 @@ class test_ChainBuilder
 			 */
 			const QList<QByteArray> allElements({"AA", "AB", "BC", "CD", "DE", "CF"});
 
-			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 			QCOMPARE(chainBuilder.getChains().size(), 2);
 			QVERIFY(chainBuilder.getChains().contains(QList<QByteArray>({"AA", "AB", "BC", "CD", "DE"})));
@@ -151,6 +163,59 @@ class test_ChainBuilder
 		}
 
 
+		void testCycle()
+		{
+			const QList<QByteArray> allElements({"AB", "BC", "CA"});
+			ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
+
+			QCOMPARE(chainBuilder.getChains().size(), 1);
+			QCOMPARE(chainBuilder.getChains().at(0), QList<QByteArray>({"AB", "BC", "CA"}));
+		}
+
+
+		void testLongChainWithManyRoots()
+		{
+			/*
+			 * 80   81   ...   FF
+			 * |  /          /
+			 * 01
+			 * |
+			 * 12
+			 * |
+			 * ...
+			 * |
+			 * 7E7F
+			 */
+			const auto element = [](int pIssuer, int pSubject){
+						return QByteArray(1, static_cast<char>(pIssuer)) + static_cast<char>(pSubject);
+					};
+
+			QList<QByteArray> allElements;
+			for (int i = 0x01; i < 0x7F; ++i)
+			{
+				allElements += element(i, i + 1);
+			}
+			for (int i = 0x80; i <= 0xFF; ++i)
+			{
+				allElements += element(i, 0x01);
+			}
+			std::reverse(allElements.begin(), allElements.end());
+
+			QBENCHMARK
+			{
+				ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
+
+				QCOMPARE(chainBuilder.getChains().size(), 0x80);
+				for (const auto& chain : chainBuilder.getChains())
+				{
+					QCOMPARE(chain.size(), 0x7F);
+					QCOMPARE(chain.at(1), element(0x01, 0x02));
+					QCOMPARE(chain.last(), element(0x7E, 0x7F));
+				}
+			}
+		}
+
+
 		void testAllCombinations()
 		{
 			/*
@@ -174,7 +239,7 @@ class test_ChainBuilder
 
 				do
 				{
-					ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild);
+					ChainBuilder<QByteArray> chainBuilder(allElements, &test_ChainBuilder::isChild, &test_ChainBuilder::getIssuer, &test_ChainBuilder::getSubject);
 
 					QCOMPARE(chainBuilder.getChains().size(), 4);
 					QVERIFY(chainBuilder.getChains().contains(chain1));
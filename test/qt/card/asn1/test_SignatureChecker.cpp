@@ -50,6 +50,7 @@ class test_SignatureChecker
 			cvcs.append(load(":/card/cvdv-DEDVeIDDPST00035.hex"_L1));
 			cvcs.append(load(":/card/cvat-DEDEMODEV00038.hex"_L1));
 			ERR_clear_error();
+			SignatureChecker::clearCache();
 		}
 
 
@@ -106,6 +107,39 @@ class test_SignatureChecker
 			SignatureChecker checker(cvcs);
 
 			QVERIFY(checker.check());
+			QCOMPARE(SignatureChecker::getCacheCount(), 0);
+		}
+
+
+		void verifyCachedChain()
+		{
+			// Only the link certificate, the DV and the AT certificate are valid on this date
+			const QDateTime validationDate(QDate(2014, 4, 1), QTime(12, 0));
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			QCOMPARE(SignatureChecker::getCacheCount(), 3);
+
+			QTest::ignoreMessage(QtDebugMsg, "Signature already verified: \"DETESTeID00004\"");
+			QTest::ignoreMessage(QtDebugMsg, "Signature already verified: \"DEDVeIDDPST00035\"");
+			QTest::ignoreMessage(QtDebugMsg, "Signature already verified: \"DEDEMODEV00038\"");
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			QCOMPARE(SignatureChecker::getCacheCount(), 3);
+
+			// The AT certificate expired
+			QVERIFY(SignatureChecker(cvcs, validationDate.addMonths(1)).check());
+			QCOMPARE(SignatureChecker::getCacheCount(), 2);
+		}
+
+
+		void verifyCachedChainWithOtherSignature()
+		{
+			const QDateTime validationDate(QDate(2014, 4, 1), QTime(12, 0));
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			QCOMPARE(SignatureChecker::getCacheCount(), 3);
+
+			// A cached DV certificate must not verify an AT certificate of another chain
+			QList<QSharedPointer<const CVCertificate>> certs(cvcs);
+			certs.replace(4, load(":/card/cvat-DEDEVDEMO00020.hex"_L1));
+			QVERIFY(!SignatureChecker(certs, validationDate).check());
 		}
 
 
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref CardCommandQueue
+ */
+
+#include "command/CardCommandQueue.h"
+
+#include "command/BaseCardCommand.h"
+
+#include "MockReader.h"
+
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class QueuedCommand
+	: public BaseCardCommand
+{
+	Q_OBJECT
+
+	private:
+		const QString mName;
+		const Priority mPriority;
+		QStringList& mExecuted;
+
+	public:
+		QueuedCommand(const QSharedPointer<CardConnectionWorker>& pWorker, const QString& pName, Priority pPriority, QStringList& pExecuted)
+			: BaseCardCommand(pWorker)
+			, mName(pName)
+			, mPriority(pPriority)
+			, mExecuted(pExecuted)
+		{
+		}
+
+
+		void internalExecute() override
+		{
+			mExecuted += mName;
+			setReturnCode(CardReturnCode::OK);
+		}
+
+
+		[[nodiscard]] Priority getPriority() const override
+		{
+			return mPriority;
+		}
+
+
+};
+
+
+class StatusCommand
+	: public QueuedCommand
+{
+	Q_OBJECT
+
+	public:
+		using QueuedCommand::QueuedCommand;
+
+		[[nodiscard]] bool isCoalescable() const override
+		{
+			return true;
+		}
+
+
+};
+
+
+class test_CardCommandQueue
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		int mDone = 0;
+
+		BaseCardCommand* countDone(BaseCardCommand* pCommand)
+		{
+			connect(pCommand, &BaseCardCommand::commandDone, this, [this](QSharedPointer<BaseCardCommand> pDone){
+					QCOMPARE(pDone->getReturnCode(), CardReturnCode::OK);
+					++mDone;
+				});
+			return pCommand;
+		}
+
+
+		void run(BaseCardCommand* pCommand)
+		{
+			countDone(pCommand)->run();
+		}
+
+	private Q_SLOTS:
+		void init()
+		{
+			mDone = 0;
+		}
+
+
+		void priorityAndCoalescing()
+		{
+			MockReader reader("dummy reader"_L1);
+			const auto& worker = CardConnectionWorker::create(&reader);
+			QStringList executed;
+
+			run(new StatusCommand(worker, "status 1"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			run(new StatusCommand(worker, "status 2"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			run(new QueuedCommand(worker, "transmit 1"_L1, BaseCardCommand::Priority::INTERACTIVE, executed));
+			run(new QueuedCommand(worker, "transmit 2"_L1, BaseCardCommand::Priority::INTERACTIVE, executed));
+
+			QTRY_COMPARE(mDone, 4); // clazy:exclude=qstring-allocations
+			QCOMPARE(executed, QStringList({"transmit 1"_L1, "transmit 2"_L1, "status 1"_L1}));
+			QVERIFY(reader.getCommandQueue().isEmpty());
+
+			const auto& metrics = reader.getCommandQueue().getMetrics();
+			QCOMPARE(metrics.mExecuted, 3);
+			QCOMPARE(metrics.mCoalesced, 1);
+			QCOMPARE(metrics.mMaxDepth, 3);
+			QVERIFY(metrics.mMaxWait >= 0);
+			QVERIFY(metrics.mTotalWait >= metrics.mMaxWait);
+		}
+
+
+		void noCoalescingOfExecutedCommand()
+		{
+			MockReader reader("dummy reader"_L1);
+			const auto& worker = CardConnectionWorker::create(&reader);
+			QStringList executed;
+
+			run(new StatusCommand(worker, "status 1"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			QTRY_COMPARE(mDone, 1); // clazy:exclude=qstring-allocations
+
+			run(new StatusCommand(worker, "status 2"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			QTRY_COMPARE(mDone, 2); // clazy:exclude=qstring-allocations
+
+			QCOMPARE(executed, QStringList({"status 1"_L1, "status 2"_L1}));
+			QCOMPARE(reader.getCommandQueue().getMetrics().mCoalesced, 0);
+			QCOMPARE(reader.getCommandQueue().getMetrics().mMaxDepth, 1);
+		}
+
+
+		void noCoalescingOfOtherTypes()
+		{
+			MockReader reader("dummy reader"_L1);
+			const auto& worker = CardConnectionWorker::create(&reader);
+			QStringList executed;
+
+			run(new QueuedCommand(worker, "transmit"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			run(new StatusCommand(worker, "status"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+
+			QTRY_COMPARE(mDone, 2); // clazy:exclude=qstring-allocations
+			QCOMPARE(executed, QStringList({"transmit"_L1, "status"_L1}));
+		}
+
+
+		void sharedByConnections()
+		{
+			MockReader reader("dummy reader"_L1);
+			QStringList executed;
+
+			run(new StatusCommand(CardConnectionWorker::create(&reader), "status 1"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+			run(new QueuedCommand(CardConnectionWorker::create(&reader), "transmit"_L1, BaseCardCommand::Priority::INTERACTIVE, executed));
+			run(new StatusCommand(CardConnectionWorker::create(&reader), "status 2"_L1, BaseCardCommand::Priority::BACKGROUND, executed));
+
+			QTRY_COMPARE(mDone, 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(executed, QStringList({"transmit"_L1, "status 1"_L1}));
+			QCOMPARE(reader.getCommandQueue().getMetrics().mCoalesced, 1);
+		}
+
+
+		void backgroundJobs()
+		{
+			MockReader reader("dummy reader"_L1);
+			const auto& worker = CardConnectionWorker::create(&reader);
+			QStringList executed;
+
+			auto& queue = reader.getCommandQueue();
+			queue.enqueue(CardCommandQueue::Priority::BACKGROUND, "KeepAlive", [&executed] {
+					executed += "keep alive 1"_L1;
+				});
+			queue.enqueue(CardCommandQueue::Priority::BACKGROUND, "KeepAlive", [&executed] {
+					executed += "keep alive 2"_L1;
+				});
+			queue.enqueue(CardCommandQueue::Priority::BACKGROUND, "SCardStatus", [&executed] {
+					executed += "status"_L1;
+				});
+			queue.enqueue(countDone(new QueuedCommand(worker, "transmit"_L1, BaseCardCommand::Priority::INTERACTIVE, executed)));
+
+			QTRY_VERIFY(queue.isEmpty()); // clazy:exclude=qstring-allocations
+			QCOMPARE(mDone, 1);
+			QCOMPARE(executed, QStringList({"transmit"_L1, "keep alive 1"_L1, "status"_L1}));
+			QCOMPARE(queue.getMetrics().mExecuted, 3);
+			QCOMPARE(queue.getMetrics().mCoalesced, 1);
+		}
+
+
+		void pendingCommandsOnReaderRemoval()
+		{
+			auto* reader = new MockReader("dummy reader"_L1);
+			const auto& worker = CardConnectionWorker::create(reader);
+			QStringList executed;
+
+			auto* command = new QueuedCommand(worker, "transmit"_L1, BaseCardCommand::Priority::INTERACTIVE, executed);
+			QSharedPointer<BaseCardCommand> done;
+			connect(command, &BaseCardCommand::commandDone, this, [&done](QSharedPointer<BaseCardCommand> pDone){
+					done = pDone;
+				});
+			reader->getCommandQueue().enqueue(command);
+			reader->getCommandQueue().enqueue(CardCommandQueue::Priority::BACKGROUND, "KeepAlive", [&executed] {
+					executed += "keep alive"_L1;
+				});
+
+			delete reader;
+			QVERIFY(done);
+			QCOMPARE(done->getReturnCode(), CardReturnCode::CARD_NOT_FOUND);
+
+			QCoreApplication::processEvents();
+			QVERIFY(executed.isEmpty());
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_CardCommandQueue)
+#include "test_CardCommandQueue.moc"
@@ -153,11 +153,14 @@ class test_TransmitCommand
 			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
 			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
 			TransmitCommand command(worker, inputApduInfos, QStringLiteral("slotname"));
+			QSignalSpy spyOutputApdu(&command, &TransmitCommand::fireOutputApdu);
 			command.internalExecute();
 			QCOMPARE(command.getOutputApduAsHex().size(), 2);
 			QCOMPARE(command.getOutputApduAsHex()[0], QByteArray("9000"));
 			QCOMPARE(command.getOutputApduAsHex()[1], QByteArray("9000"));
 			QCOMPARE(command.getReturnCode(), CardReturnCode::OK);
+			QCOMPARE(spyOutputApdu.count(), 2);
+			QCOMPARE(spyOutputApdu.at(0).at(0).toByteArray(), QByteArray("9000"));
 		}
 
 
@@ -171,18 +174,22 @@ class test_TransmitCommand
 			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
 			worker->addResponse(CardReturnCode::PROTOCOL_ERROR, QByteArray::fromHex("1919"));
 			TransmitCommand command1(worker, inputApduInfos, QStringLiteral("slotname"));
+			QSignalSpy spyOutputApdu1(&command1, &TransmitCommand::fireOutputApdu);
 			command1.internalExecute();
 			QCOMPARE(command1.getOutputApduAsHex().size(), 1);
 			QCOMPARE(command1.getOutputApduAsHex()[0], QByteArray("9000"));
 			QCOMPARE(command1.getReturnCode(), CardReturnCode::PROTOCOL_ERROR);
+			QCOMPARE(spyOutputApdu1.count(), 1);
 			QVERIFY(logSpy.takeFirst().at(0).toString().contains("Transmit unsuccessful. Return code"_L1));
 
 			worker->addResponse(CardReturnCode::PROTOCOL_ERROR, QByteArray::fromHex("1919"));
 			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
 			TransmitCommand command2(worker, inputApduInfos, QStringLiteral("slotname"));
+			QSignalSpy spyOutputApdu2(&command2, &TransmitCommand::fireOutputApdu);
 			command2.internalExecute();
 			QCOMPARE(command2.getOutputApduAsHex().size(), 0);
 			QCOMPARE(command2.getReturnCode(), CardReturnCode::PROTOCOL_ERROR);
+			QCOMPARE(spyOutputApdu2.count(), 0);
 			QVERIFY(logSpy.takeFirst().at(0).toString().contains("Transmit unsuccessful. Return code"_L1));
 		}
 
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref ApduRecorder
+ */
+
+#include "ApduRecorder.h"
+
+#include "CardConnectionWorker.h"
+#include "MockReader.h"
+#include "ReplayCard.h"
+#include "pinpad/EstablishPaceChannel.h"
+
+#include <QTemporaryFile>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_ApduRecorder
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void lines()
+		{
+			const ApduRecorder::Record record {1234, CardReturnCode::OK, QByteArray::fromHex("00a4020c02011c"), QByteArray::fromHex("9000")};
+			const auto& line = ApduRecorder::toLine(record);
+			QCOMPARE(line, "1234 OK 00a4020c02011c 9000\n"_ba);
+
+			const auto& parsed = ApduRecorder::fromLine(line);
+			QVERIFY(parsed);
+			QCOMPARE(parsed->mDuration, 1234);
+			QCOMPARE(parsed->mReturnCode, CardReturnCode::OK);
+			QCOMPARE(parsed->mCommand, record.mCommand);
+			QCOMPARE(parsed->mResponse, record.mResponse);
+
+			const auto& failed = ApduRecorder::fromLine("42 COMMAND_FAILED 00b0000000");
+			QVERIFY(failed);
+			QCOMPARE(failed->mReturnCode, CardReturnCode::COMMAND_FAILED);
+			QVERIFY(failed->mResponse.isEmpty());
+			QCOMPARE(ApduRecorder::toLine(*failed), "42 COMMAND_FAILED 00b0000000\n"_ba);
+		}
+
+
+		void operationLines()
+		{
+			const ApduRecorder::Record record {5, CardReturnCode::OK, QByteArray(1, 60), QByteArray::fromHex("9000"), ApduRecordOperation::SET_EID_PIN};
+			const auto& line = ApduRecorder::toLine(record);
+			QCOMPARE(line, "5 OK SET_EID_PIN:3c 9000\n"_ba);
+
+			const auto& parsed = ApduRecorder::fromLine(line);
+			QVERIFY(parsed);
+			QCOMPARE(parsed->mOperation, ApduRecordOperation::SET_EID_PIN);
+			QCOMPARE(parsed->mCommand, record.mCommand);
+			QCOMPARE(parsed->mResponse, record.mResponse);
+
+			const auto& destroyed = ApduRecorder::fromLine("7 OK DESTROY_PACE_CHANNEL:");
+			QVERIFY(destroyed);
+			QCOMPARE(destroyed->mOperation, ApduRecordOperation::DESTROY_PACE_CHANNEL);
+			QVERIFY(destroyed->mCommand.isEmpty());
+			QVERIFY(destroyed->mResponse.isEmpty());
+			QCOMPARE(ApduRecorder::toLine(*destroyed), "7 OK DESTROY_PACE_CHANNEL:\n"_ba);
+		}
+
+
+		void invalidLines_data()
+		{
+			QTest::addColumn<QByteArray>("line");
+
+			QTest::newRow("empty") << QByteArray();
+			QTest::newRow("command missing") << "1234 OK"_ba;
+			QTest::newRow("too many fields") << "1234 OK 00b0000000 9000 9000"_ba;
+			QTest::newRow("negative duration") << "-1 OK 00b0000000 9000"_ba;
+			QTest::newRow("no duration") << "abc OK 00b0000000 9000"_ba;
+			QTest::newRow("unknown return code") << "1234 FOO 00b0000000 9000"_ba;
+			QTest::newRow("unknown operation") << "1234 OK FOO:00b0000000 9000"_ba;
+			QTest::newRow("explicit transmit") << "1234 OK TRANSMIT:00b0000000 9000"_ba;
+		}
+
+
+		void invalidLines()
+		{
+			QFETCH(QByteArray, line);
+
+			QVERIFY(!ApduRecorder::fromLine(line));
+		}
+
+
+		void disabled()
+		{
+			ApduRecorder recorder{QString()};
+			QVERIFY(!recorder.isEnabled());
+			recorder.record(CommandApdu(QByteArray::fromHex("00b0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 1);
+		}
+
+
+		void recordAndLoad()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			QVERIFY(file.write("# recorded by a test\n\n") > 0);
+			QVERIFY(file.flush());
+
+			{
+				QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Recording APDUs with personal data to .*"_L1));
+				ApduRecorder recorder(file.fileName());
+				QVERIFY(recorder.isEnabled());
+				recorder.record(CommandApdu(QByteArray::fromHex("00a4020c02011c")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 100);
+				recorder.record(CommandApdu(QByteArray::fromHex("00b0000000")), {CardReturnCode::CARD_NOT_FOUND}, 200);
+			}
+
+			QVERIFY(file.seek(file.size()));
+			QVERIFY(file.write("invalid\n") > 0);
+			QVERIFY(file.flush());
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Skipping invalid line 5 of APDU recording: .*"_L1));
+			const auto& records = ApduRecorder::load(file.fileName());
+			QCOMPARE(records.size(), 2);
+			QCOMPARE(records.at(0).mDuration, 100);
+			QCOMPARE(records.at(0).mCommand, QByteArray::fromHex("00a4020c02011c"));
+			QCOMPARE(records.at(0).mResponse, QByteArray::fromHex("9000"));
+			QCOMPARE(records.at(1).mDuration, 200);
+			QCOMPARE(records.at(1).mReturnCode, CardReturnCode::CARD_NOT_FOUND);
+			QVERIFY(records.at(1).mResponse.isEmpty());
+		}
+
+
+		void missingFile()
+		{
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Cannot open APDU recording: .*"_L1));
+			QVERIFY(ApduRecorder::load(u"/does/not/exist.apdu"_s).isEmpty());
+		}
+
+
+		void replay()
+		{
+			const QList<ApduRecorder::Record> records {
+				{1000, CardReturnCode::OK, QByteArray::fromHex("00a4020c02011c"), QByteArray::fromHex("9000")},
+				{1000, CardReturnCode::OK, QByteArray::fromHex("00b0000000"), QByteArray::fromHex("31149000")}
+			};
+
+			MockReader reader;
+			auto* card = static_cast<ReplayCard*>(reader.setCard(new ReplayCard(records), QSharedPointer<EFCardAccess>()));
+			const auto& worker = CardConnectionWorker::create(&reader);
+
+			QElapsedTimer timer;
+			timer.start();
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00a4020c02011c"))), ResponseApduResult({CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}));
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00b0000000"))), ResponseApduResult({CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("31149000"))}));
+			QVERIFY(timer.nsecsElapsed() >= 2000 * 1000);
+			QCOMPARE(card->getRemainingRecords(), 0);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^No \\(more\\) recorded response APDU.*"_L1));
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00b0000000"))), ResponseApduResult({CardReturnCode::COMMAND_FAILED}));
+		}
+
+
+		void replayMismatch()
+		{
+			const QList<ApduRecorder::Record> records {
+				{1000, CardReturnCode::OK, QByteArray::fromHex("00a4020c02011c"), QByteArray::fromHex("9000")}
+			};
+
+			MockReader reader;
+			reader.setCard(new ReplayCard(records, 0), QSharedPointer<EFCardAccess>());
+			const auto& worker = CardConnectionWorker::create(&reader);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Command differs from the recording.*"_L1));
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00b0000000"))), ResponseApduResult({CardReturnCode::COMMAND_FAILED}));
+		}
+
+
+		void replayComfortReader()
+		{
+			EstablishPaceChannelOutput paceOutput(CardReturnCode::OK);
+			paceOutput.setStatusMseSetAt(QByteArray::fromHex("9000"));
+			paceOutput.setCarCurr("DECVCAeID00103"_ba);
+
+			const QList<ApduRecorder::Record> records {
+				{1000, CardReturnCode::OK, EstablishPaceChannel(PacePasswordId::PACE_PIN).createASN1StructCcid(), paceOutput.toCcid(), ApduRecordOperation::ESTABLISH_PACE_CHANNEL},
+				{1000, CardReturnCode::OK, QByteArray(1, 60), QByteArray::fromHex("9000"), ApduRecordOperation::SET_EID_PIN},
+				{1000, CardReturnCode::OK, QByteArray(), QByteArray(), ApduRecordOperation::DESTROY_PACE_CHANNEL}
+			};
+
+			MockReader reader;
+			reader.setInfoBasicReader(false);
+			auto* card = static_cast<ReplayCard*>(reader.setCard(new ReplayCard(records, 0), QSharedPointer<EFCardAccess>()));
+			const auto& worker = CardConnectionWorker::create(&reader);
+
+			const auto& output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray(), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+			QCOMPARE(output.getStatusMseSetAt(), QByteArray::fromHex("9000"));
+			QCOMPARE(output.getCarCurr(), "DECVCAeID00103"_ba);
+
+			QCOMPARE(worker->setEidPin(QByteArray(), 60), ResponseApduResult({CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}));
+			QCOMPARE(worker->destroyPaceChannel(), CardReturnCode::OK);
+			QCOMPARE(card->getRemainingRecords(), 0);
+		}
+
+
+		void replayComfortReaderMismatch()
+		{
+			const QList<ApduRecorder::Record> records {
+				{1000, CardReturnCode::OK, QByteArray(), QByteArray(), ApduRecordOperation::DESTROY_PACE_CHANNEL}
+			};
+
+			MockReader reader;
+			reader.setCard(new ReplayCard(records, 0), QSharedPointer<EFCardAccess>());
+			const auto& worker = CardConnectionWorker::create(&reader);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Command differs from the recording.*"_L1));
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00b0000000"))), ResponseApduResult({CardReturnCode::COMMAND_FAILED}));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ApduRecorder)
+#include "test_ApduRecorder.moc"
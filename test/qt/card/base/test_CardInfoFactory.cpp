@@ -4,6 +4,9 @@
 
 #include "CardInfoFactory.h"
 
+#include "MockCardConnectionWorker.h"
+#include "apdu/FileCommand.h"
+
 #include <QtTest>
 
 using namespace governikus;
@@ -59,6 +62,95 @@ class test_CardInfoFactory
 		}
 
 
+		void test_cache()
+		{
+			CardInfoFactory::clearCache();
+			QVERIFY(!CardInfoFactory::lookupCache(QByteArray("0")).has_value());
+
+			CardInfoFactory::addToCache(QByteArray(), CardInfo(CardType::EID_CARD));
+			QVERIFY(!CardInfoFactory::lookupCache(QByteArray()).has_value());
+
+			for (int i = 0; i < CardInfoFactory::CACHE_SIZE; ++i)
+			{
+				CardInfoFactory::addToCache(QByteArray::number(i), CardInfo(CardType::EID_CARD, FileRef::appEId()));
+			}
+			QVERIFY(CardInfoFactory::lookupCache(QByteArray("0")).has_value());
+
+			CardInfoFactory::addToCache(QByteArray("new"), CardInfo(CardType::SMART_EID));
+			QVERIFY(CardInfoFactory::lookupCache(QByteArray("0")).has_value());
+			QVERIFY(!CardInfoFactory::lookupCache(QByteArray("1")).has_value());
+			QCOMPARE(CardInfoFactory::lookupCache(QByteArray("new"))->getCardType(), CardType::SMART_EID);
+			QCOMPARE(CardInfoFactory::lookupCache(QByteArray("2"))->getApplication(), FileRef::appEId());
+
+			CardInfoFactory::clearCache();
+			QVERIFY(!CardInfoFactory::lookupCache(QByteArray("new")).has_value());
+		}
+
+
+		void test_createCached()
+		{
+			CardInfoFactory::clearCache();
+
+			const auto& efCardAccess = QByteArray::fromHex("3114"
+														   "    3012"
+														   "        060A04007F00070202040202"
+														   "        020102"
+														   "        020108");
+			QSharedPointer<MockCardConnectionWorker> worker(new MockCardConnectionWorker());
+			worker->addResponse(CardReturnCode::OK, efCardAccess + QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("610B4F09E80704007F000703029000"));
+
+			const auto& cardInfo = CardInfoFactory::create(worker);
+			QCOMPARE(cardInfo.getCardType(), CardType::EID_CARD);
+			QCOMPARE(cardInfo.getApplication(), FileRef::appEId());
+			QCOMPARE(cardInfo.getEfCardAccess()->getContentBytes(), efCardAccess);
+			QCOMPARE(worker->getCommands().size(), 2);
+
+			worker->addResponse(CardReturnCode::OK, efCardAccess + QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			const auto& cachedCardInfo = CardInfoFactory::create(worker);
+			QCOMPARE(cachedCardInfo.getCardType(), CardType::EID_CARD);
+			QCOMPARE(cachedCardInfo.getApplication(), FileRef::appEId());
+			QCOMPARE(cachedCardInfo.getEfCardAccess(), cardInfo.getEfCardAccess());
+			QCOMPARE(worker->getCommands().size(), 4);
+			QCOMPARE(worker->getCommands().at(2), CommandApdu(FileCommand(FileRef::appEId())));
+
+			CardInfoFactory::clearCache();
+		}
+
+
+		void test_createCachedOtherApplication()
+		{
+			CardInfoFactory::clearCache();
+
+			const auto& efCardAccess = QByteArray::fromHex("3114"
+														   "    3012"
+														   "        060A04007F00070202040202"
+														   "        020102"
+														   "        020108");
+			CardInfoFactory::addToCache(efCardAccess, CardInfo(CardType::EID_CARD, FileRef::appPersosim()));
+
+			QSharedPointer<MockCardConnectionWorker> worker(new MockCardConnectionWorker());
+			worker->addResponse(CardReturnCode::OK, efCardAccess + QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("6A82"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("9000"));
+			worker->addResponse(CardReturnCode::OK, QByteArray::fromHex("610B4F09E80704007F000703029000"));
+
+			const auto& cardInfo = CardInfoFactory::create(worker);
+			QCOMPARE(cardInfo.getCardType(), CardType::EID_CARD);
+			QCOMPARE(cardInfo.getApplication(), FileRef::appEId());
+			QCOMPARE(worker->getCommands().size(), 3);
+			QCOMPARE(worker->getCommands().at(0), CommandApdu(FileCommand(FileRef::appPersosim())));
+			QCOMPARE(CardInfoFactory::lookupCache(efCardAccess)->getApplication(), FileRef::appEId());
+
+			CardInfoFactory::clearCache();
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_CardInfoFactory)
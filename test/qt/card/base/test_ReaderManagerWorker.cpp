@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref ReaderManagerWorker
+ */
+
+#include "ReaderManagerWorker.h"
+
+#include "MockReaderManagerPlugin.h"
+
+#include <QPointer>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_ReaderManagerWorker
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void cleanup()
+		{
+			qunsetenv("AUSWEISAPP2_READER_THREADS");
+		}
+
+
+		void noThreadedPlugins()
+		{
+			QVERIFY(ReaderManagerWorker::getThreadedPluginTypes().isEmpty());
+		}
+
+
+		void threadedPlugins()
+		{
+			qputenv("AUSWEISAPP2_READER_THREADS", "PCSC, SIMULATOR,,FOO,SMART");
+
+			QTest::ignoreMessage(QtWarningMsg, "Ignoring unknown plugin of AUSWEISAPP2_READER_THREADS: \"FOO\"");
+			QTest::ignoreMessage(QtWarningMsg, "Plugin needs the ReaderManager thread: SMART");
+			QCOMPARE(ReaderManagerWorker::getThreadedPluginTypes(), QList<ReaderManagerPluginType>({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::SIMULATOR}));
+		}
+
+
+		void pluginThread()
+		{
+			ReaderManagerWorker worker;
+			QPointer<MockReaderManagerPlugin> plugin = new MockReaderManagerPlugin();
+			worker.registerPlugin(plugin);
+			worker.moveToPluginThread(plugin, MockReader::cMOCKED_READERMANAGER_TYPE);
+			QVERIFY(plugin->thread() != QThread::currentThread());
+
+			QSignalSpy readerAdded(&worker, &ReaderManagerWorker::fireReaderAdded);
+			QSignalSpy cardInserted(&worker, &ReaderManagerWorker::fireCardInserted);
+
+			auto* reader = plugin->addReader("ThreadedReader"_L1);
+			QTRY_COMPARE(readerAdded.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(reader->thread(), plugin->thread());
+			QCOMPARE(worker.mReaderPlugins.value("ThreadedReader"_L1), plugin.data());
+			QCOMPARE(worker.getReaderInfos().size(), 1);
+
+			worker.insert(ReaderInfo("ThreadedReader"_L1, MockReader::cMOCKED_READERMANAGER_TYPE), QVariant(true));
+			QTRY_COMPARE(cardInserted.size(), 1); // clazy:exclude=qstring-allocations
+
+			QSharedPointer<CardConnectionWorker> cardWorker;
+			connect(&worker, &ReaderManagerWorker::fireCardConnectionWorkerCreated, this, [&cardWorker](const QSharedPointer<CardConnectionWorker>& pWorker){
+					cardWorker = pWorker;
+				});
+			reader->setCard(MockCardConfig());
+			worker.createCardConnectionWorker("ThreadedReader"_L1, nullptr);
+			QVERIFY(cardWorker);
+			QCOMPARE(cardWorker->thread(), plugin->thread());
+			cardWorker.reset();
+
+			QTest::ignoreMessage(QtWarningMsg, "Requested reader does not exist: \"UnknownReader\"");
+			worker.updateReaderInfo("UnknownReader"_L1);
+
+			worker.shutdown();
+			QVERIFY(worker.mPluginThreads.isEmpty());
+			QVERIFY(worker.mReaderPlugins.isEmpty());
+			QVERIFY(plugin.isNull());
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ReaderManagerWorker)
+#include "test_ReaderManagerWorker.moc"
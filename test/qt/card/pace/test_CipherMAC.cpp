@@ -123,6 +123,23 @@ class test_CipherMAC
 		}
 
 
+		void multipleParts()
+		{
+			SecurityProtocol securityProtocol(KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_256);
+			KeyDerivationFunction kdf(securityProtocol);
+			QByteArray key = kdf.mac("123456");
+			CipherMac cipherMac(securityProtocol, key);
+
+			const QByteArray data(DATA);
+			char mac[CipherMac::MAC_SIZE];
+			QVERIFY(cipherMac.generate({data.left(3), QByteArrayView(), data.mid(3)}, mac));
+			QCOMPARE(QByteArray(mac, CipherMac::MAC_SIZE).toHex(), QByteArray("1759c6c914394042"));
+
+			QVERIFY(cipherMac.generate({QByteArrayView(DATA2)}, mac));
+			QCOMPARE(QByteArray(mac, CipherMac::MAC_SIZE).toHex(), QByteArray("70ce88944532f37e"));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_CipherMAC)
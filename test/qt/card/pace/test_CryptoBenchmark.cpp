@@ -0,0 +1,320 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Benchmarks for the PACE and secure messaging crypto stack.
+ *
+ * Besides the time per operation reported by QBENCHMARK each benchmark
+ * logs the heap allocations and allocated bytes per operation. The
+ * allocations of OpenSSL are counted separately by its memory functions.
+ * Copied bytes are not measured on their own, but every copy of a detached
+ * QByteArray shows up as allocated bytes.
+ */
+
+#include "pace/CipherMac.h"
+#include "pace/KeyDerivationFunction.h"
+#include "pace/SecureMessaging.h"
+#include "pace/SymmetricCipher.h"
+#include "pace/ec/EcUtil.h"
+#include "pace/ec/EcdhGenericMapping.h"
+
+#include <QtTest>
+
+#include <openssl/crypto.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+using namespace governikus;
+
+
+namespace
+{
+std::atomic<qint64> cAllocations(0);
+std::atomic<qint64> cAllocatedBytes(0);
+std::atomic<qint64> cCryptoAllocations(0);
+std::atomic<qint64> cCryptoAllocatedBytes(0);
+
+
+void* cryptoMalloc(size_t pSize, const char*, int)
+{
+	++cCryptoAllocations;
+	cCryptoAllocatedBytes += static_cast<qint64>(pSize);
+	return std::malloc(pSize);
+}
+
+
+void* cryptoRealloc(void* pPtr, size_t pSize, const char*, int)
+{
+	++cCryptoAllocations;
+	cCryptoAllocatedBytes += static_cast<qint64>(pSize);
+	return std::realloc(pPtr, pSize);
+}
+
+
+void cryptoFree(void* pPtr, const char*, int)
+{
+	std::free(pPtr);
+}
+
+
+// OpenSSL accepts memory functions only before its first allocation.
+const bool cCryptoAllocationsCounted = CRYPTO_set_mem_functions(cryptoMalloc, cryptoRealloc, cryptoFree) == 1;
+} // namespace
+
+
+void* operator new(std::size_t pSize)
+{
+	++cAllocations;
+	cAllocatedBytes += static_cast<qint64>(pSize);
+	if (void* ptr = std::malloc(pSize == 0 ? 1 : pSize))
+	{
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+
+void operator delete(void* pPtr) noexcept
+{
+	std::free(pPtr);
+}
+
+
+void operator delete(void* pPtr, std::size_t) noexcept
+{
+	std::free(pPtr);
+}
+
+
+class test_CryptoBenchmark
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		const QByteArray SECRET = QByteArrayLiteral("123456");
+
+		template<typename Func>
+		void logAllocations(Func pFunc) const
+		{
+			const int runs = 100;
+			const auto allocations = cAllocations.load();
+			const auto allocatedBytes = cAllocatedBytes.load();
+			const auto cryptoAllocations = cCryptoAllocations.load();
+			const auto cryptoAllocatedBytes = cCryptoAllocatedBytes.load();
+			for (int i = 0; i < runs; ++i)
+			{
+				pFunc();
+			}
+			qInfo().nospace() << "allocations/op: " << static_cast<double>(cAllocations - allocations) / runs
+							  << ", allocated bytes/op: " << static_cast<double>(cAllocatedBytes - allocatedBytes) / runs
+							  << ", OpenSSL allocations/op: " << static_cast<double>(cCryptoAllocations - cryptoAllocations) / runs
+							  << ", OpenSSL allocated bytes/op: " << static_cast<double>(cCryptoAllocatedBytes - cryptoAllocatedBytes) / runs;
+		}
+
+
+		static void addProtocolRows(const QList<int>& pSizes)
+		{
+			QTest::addColumn<KnownOid>("protocol");
+			QTest::addColumn<int>("size");
+
+			const QList<std::pair<const char*, KnownOid>> protocols = {
+				{"AES-128", KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_128},
+				{"AES-192", KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_192},
+				{"AES-256", KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_256}
+			};
+
+			for (const auto& [name, oid] : protocols)
+			{
+				for (int size : pSizes)
+				{
+					QTest::addRow("%s - %d bytes", name, size) << oid << size;
+				}
+			}
+		}
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			QLoggingCategory::setFilterRules(QStringLiteral("*.debug=false"));
+
+			if (!cCryptoAllocationsCounted)
+			{
+				qInfo() << "OpenSSL allocated memory before the benchmark, its allocations are not counted";
+			}
+			qInfo() << "Copied bytes are not measured separately, they are part of the allocated bytes of detached copies";
+		}
+
+
+		void secureMessaging_data()
+		{
+			// SELECT, READ BINARY of a short file, PSO:VERIFY of a CVC, extended READ BINARY
+			addProtocolRows({0, 16, 223, 1024});
+		}
+
+
+		void secureMessaging()
+		{
+			QFETCH(KnownOid, protocol);
+			QFETCH(int, size);
+
+			const SecurityProtocol securityProtocol(protocol);
+			const KeyDerivationFunction kdf(securityProtocol);
+			const QByteArray encKey = kdf.enc(SECRET);
+			const QByteArray macKey = kdf.mac(SECRET);
+			SecureMessaging terminal(securityProtocol, encKey, macKey);
+			SecureMessaging card(securityProtocol, encKey, macKey);
+			QVERIFY(terminal.isInitialized());
+
+			const CommandApdu command(Ins::READ_BINARY, 0, 0, QByteArray(size, 'c'), CommandApdu::SHORT_MAX_LE);
+			const ResponseApdu response(StatusCode::SUCCESS, QByteArray(size, 'r'));
+
+			QCOMPARE(card.decrypt(terminal.encrypt(command)), command);
+			QCOMPARE(terminal.decrypt(card.encrypt(response)), response);
+
+			const auto roundTrip = [&terminal, &card, &command, &response] {
+						card.decrypt(terminal.encrypt(command));
+						terminal.decrypt(card.encrypt(response));
+					};
+
+			QBENCHMARK
+			{
+				roundTrip();
+			}
+			logAllocations(roundTrip);
+		}
+
+
+		void symmetricCipher_data()
+		{
+			addProtocolRows({16, 224, 1024});
+		}
+
+
+		void symmetricCipher()
+		{
+			QFETCH(KnownOid, protocol);
+			QFETCH(int, size);
+
+			const SecurityProtocol securityProtocol(protocol);
+			SymmetricCipher cipher(securityProtocol, KeyDerivationFunction(securityProtocol).enc(SECRET));
+			QVERIFY(cipher.isInitialized());
+
+			const QByteArray data(size, 'd');
+			QCOMPARE(cipher.decrypt(cipher.encrypt(data)), data);
+
+			QByteArray buffer(data);
+			const auto inPlace = [&cipher, &buffer] {
+						cipher.encrypt(buffer, buffer.data());
+						cipher.decrypt(buffer, buffer.data());
+					};
+
+			QBENCHMARK
+			{
+				inPlace();
+			}
+			logAllocations(inPlace);
+		}
+
+
+		void cipherMac_data()
+		{
+			addProtocolRows({16, 240, 1040});
+		}
+
+
+		void cipherMac()
+		{
+			QFETCH(KnownOid, protocol);
+			QFETCH(int, size);
+
+			const SecurityProtocol securityProtocol(protocol);
+			CipherMac cipherMac(securityProtocol, KeyDerivationFunction(securityProtocol).mac(SECRET));
+			QVERIFY(cipherMac.isInitialized());
+
+			const QByteArray data(size, 'm');
+			char mac[CipherMac::MAC_SIZE];
+			const auto generate = [&cipherMac, &data, &mac] {
+						cipherMac.generate({data}, mac);
+					};
+
+			QBENCHMARK
+			{
+				generate();
+			}
+			logAllocations(generate);
+		}
+
+
+		void keyDerivationFunction_data()
+		{
+			addProtocolRows({32});
+		}
+
+
+		void keyDerivationFunction()
+		{
+			QFETCH(KnownOid, protocol);
+			QFETCH(int, size);
+
+			const KeyDerivationFunction kdf((SecurityProtocol(protocol)));
+			QVERIFY(kdf.isInitialized());
+
+			const QByteArray secret(size, 's');
+			const auto derive = [&kdf, &secret] {
+						kdf.enc(secret);
+						kdf.mac(secret);
+					};
+
+			QBENCHMARK
+			{
+				derive();
+			}
+			logAllocations(derive);
+		}
+
+
+		void ecdhGenericMapping_data()
+		{
+			QTest::addColumn<int>("nid");
+
+			QTest::newRow("brainpoolP256r1") << NID_brainpoolP256r1;
+			QTest::newRow("brainpoolP384r1") << NID_brainpoolP384r1;
+			QTest::newRow("brainpoolP512r1") << NID_brainpoolP512r1;
+			QTest::newRow("NIST P-256") << NID_X9_62_prime256v1;
+			QTest::newRow("NIST P-384") << NID_secp384r1;
+			QTest::newRow("NIST P-521") << NID_secp521r1;
+		}
+
+
+		void ecdhGenericMapping()
+		{
+			QFETCH(int, nid);
+
+			const QByteArray nonce(16, 'n');
+			const auto mapping = [nid, &nonce] {
+						EcdhGenericMapping terminal(EcUtil::createCurve(nid));
+						EcdhGenericMapping card(EcUtil::createCurve(nid));
+						const QByteArray terminalMappingData = terminal.generateLocalMappingData();
+						const QByteArray cardMappingData = card.generateLocalMappingData();
+						return terminal.generateEphemeralDomainParameters(cardMappingData, nonce)
+							   && card.generateEphemeralDomainParameters(terminalMappingData, nonce);
+					};
+			QVERIFY(mapping());
+
+			QBENCHMARK
+			{
+				mapping();
+			}
+			logAllocations(mapping);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_CryptoBenchmark)
+#include "test_CryptoBenchmark.moc"
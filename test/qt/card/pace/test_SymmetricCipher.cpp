@@ -153,6 +153,26 @@ class test_SymmetricCipher
 		}
 
 
+		void inPlace()
+		{
+			SecurityProtocol securityProtocol(KnownOid::ID_PACE_ECDH_GM_AES_CBC_CMAC_128);
+			KeyDerivationFunction kdf(securityProtocol);
+			QByteArray key = kdf.pi(PIN);
+			SymmetricCipher sc(securityProtocol, key);
+
+			const QByteArray encryptedData = sc.encrypt(DATA);
+
+			QByteArray buffer(DATA);
+			QVERIFY(sc.encrypt(buffer, buffer.data()));
+			QCOMPARE(buffer, encryptedData);
+
+			QVERIFY(sc.decrypt(buffer, buffer.data()));
+			QCOMPARE(buffer, DATA);
+
+			QVERIFY(!sc.encrypt(QByteArrayView("odd"), buffer.data()));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_SymmetricCipher)
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref PcscMonitor
+ */
+
+#include "PcscMonitor.h"
+
+#if (defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) || defined(Q_OS_FREEBSD)
+	#include "pcscmock.h"
+#endif
+
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_PcscMonitor
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void init()
+		{
+#if !(defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) && !defined(Q_OS_FREEBSD)
+			QSKIP("Using LD_PRELOAD is not supported");
+#else
+			setReaderNames(QStringList());
+#endif
+		}
+
+
+		void startStop()
+		{
+			PcscMonitor monitor;
+			QSignalSpy spyReaders(&monitor, &PcscMonitor::fireReadersChanged);
+
+			QCOMPARE(monitor.startMonitoring(), pcsc::Scard_S_Success);
+			QVERIFY(monitor.isRunning());
+			QTRY_COMPARE(spyReaders.size(), 1); // clazy:exclude=qstring-allocations
+
+			monitor.stopMonitoring();
+			QVERIFY(monitor.isFinished());
+			monitor.stopMonitoring();
+		}
+
+
+		void readersChanged()
+		{
+#if (defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) || defined(Q_OS_FREEBSD)
+			const QString readerName = QStringLiteral("PCSC");
+
+			PcscMonitor monitor;
+			QSignalSpy spyReaders(&monitor, &PcscMonitor::fireReadersChanged);
+			QSignalSpy spyState(&monitor, &PcscMonitor::fireReaderStateChanged);
+
+			QCOMPARE(monitor.startMonitoring(), pcsc::Scard_S_Success);
+			QTRY_COMPARE(spyReaders.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyState.size(), 0);
+
+			setReaderNames({readerName});
+			QTRY_COMPARE(spyReaders.size(), 2); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(spyState.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyState.at(0).at(0).toString(), readerName);
+
+			setReaderState(readerName, SCARD_STATE_PRESENT);
+			QTRY_COMPARE(spyState.size(), 2); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyState.at(1).at(0).toString(), readerName);
+
+			setReaderNames(QStringList());
+			QTRY_COMPARE(spyReaders.size(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyState.size(), 2);
+
+			monitor.stopMonitoring();
+			QVERIFY(monitor.isFinished());
+#endif
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_PcscMonitor)
+#include "test_PcscMonitor.moc"
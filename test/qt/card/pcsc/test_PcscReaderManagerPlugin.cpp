@@ -8,6 +8,10 @@
 
 #include "PcscReaderManagerPlugin.h"
 
+#if (defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) || defined(Q_OS_FREEBSD)
+	#include "pcscmock.h"
+#endif
+
 #include <QtTest>
 
 using namespace governikus;
@@ -39,6 +43,40 @@ class test_PcscReaderManagerPlugin
 		}
 
 
+		void monitorReaders()
+		{
+#if !(defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) && !defined(Q_OS_FREEBSD)
+			QSKIP("Using LD_PRELOAD is not supported");
+#else
+			const QString readerName = QStringLiteral("PCSC");
+			setReaderNames({readerName});
+
+			PcscReaderManagerPlugin plugin;
+			QSignalSpy spyAdded(&plugin, &PcscReaderManagerPlugin::fireReaderAdded);
+			QSignalSpy spyRemoved(&plugin, &PcscReaderManagerPlugin::fireReaderRemoved);
+
+			plugin.startScan(true);
+			QVERIFY(plugin.getInfo().isScanRunning());
+			QTRY_COMPARE(spyAdded.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(plugin.getInfo().getInitialScanState(), ReaderManagerPluginInfo::InitialScan::SUCCEEDED);
+			QCOMPARE(plugin.getReaders().size(), 1);
+
+			setReaderNames({readerName, QStringLiteral("PCSC 2")});
+			QTRY_COMPARE(spyAdded.size(), 2); // clazy:exclude=qstring-allocations
+			QCOMPARE(plugin.getReaders().size(), 2);
+
+			setReaderNames({readerName});
+			QTRY_COMPARE(spyRemoved.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(plugin.getReaders().size(), 1);
+
+			plugin.stopScan();
+			QVERIFY(!plugin.getInfo().isScanRunning());
+			QCOMPARE(spyRemoved.size(), 2);
+			QVERIFY(plugin.getReaders().isEmpty());
+#endif
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_PcscReaderManagerPlugin)
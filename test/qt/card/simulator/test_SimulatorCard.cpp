@@ -5,6 +5,12 @@
 
 #include "SimulatorCard.h"
 
+#include "AppSettings.h"
+#include "CardConnectionWorker.h"
+#include "FileRef.h"
+#include "SimulatorReader.h"
+#include "apdu/FileCommand.h"
+
 #include <QtTest>
 
 
@@ -164,6 +170,145 @@ class test_SimulatorCard
 		}
 
 
+		void basicReaderPace()
+		{
+			Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(true);
+			const auto guard = qScopeGuard([] {
+					Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(false);
+				});
+
+			SimulatorReader reader;
+			QVERIFY(reader.getReaderInfo().isBasicReader());
+			reader.insertCard();
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 3);
+
+			const auto& worker = reader.createCardConnectionWorker();
+			QVERIFY(worker);
+
+			auto output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("111111"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::INVALID_PIN);
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 2);
+
+			output = worker->establishPaceChannel(PacePasswordId::PACE_CAN, QByteArray("654321"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::INVALID_CAN);
+
+			output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+
+			const auto& [returnCode, response] = worker->transmit(FileCommand(FileRef::efCardAccess(), 0, CommandApdu::SHORT_MAX_LE));
+			QCOMPARE(returnCode, CardReturnCode::OK);
+			QCOMPARE(response.getStatusCode(), StatusCode::SUCCESS);
+			QVERIFY(response.getData().startsWith(QByteArray::fromHex("3181C1")));
+
+			worker->stopSecureMessaging();
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 3);
+		}
+
+
+		void basicReaderPinBlocked()
+		{
+			Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(true);
+			const auto guard = qScopeGuard([] {
+					Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(false);
+				});
+
+			SimulatorReader reader;
+			reader.insertCard();
+			const auto& worker = reader.createCardConnectionWorker();
+			QVERIFY(worker);
+
+			const QList<CardReturnCode> returnCodes = {CardReturnCode::INVALID_PIN, CardReturnCode::INVALID_PIN_2};
+			for (const auto returnCode : returnCodes)
+			{
+				const auto& output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("111111"), QByteArray(), QByteArray());
+				QCOMPARE(output.getPaceReturnCode(), returnCode);
+			}
+
+			auto output = worker->establishPaceChannel(PacePasswordId::PACE_CAN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+			output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("111111"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::INVALID_PIN_3);
+
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 0);
+
+			output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::PROTOCOL_ERROR);
+
+			const CommandApdu unblock(Ins::RESET_RETRY_COUNTER, CommandApdu::UNBLOCK, CommandApdu::PIN);
+			QCOMPARE(worker->transmit(unblock).mResponseApdu.getStatusCode(), StatusCode::ACCESS_DENIED);
+
+			output = worker->establishPaceChannel(PacePasswordId::PACE_PUK, QByteArray("1234567890"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+			QCOMPARE(worker->transmit(unblock).mResponseApdu.getStatusCode(), StatusCode::SUCCESS);
+
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 3);
+		}
+
+
+		void basicReaderPinSuspended()
+		{
+			Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(true);
+			const auto guard = qScopeGuard([] {
+					Env::getSingleton<AppSettings>()->getSimulatorSettings().setBasicReader(false);
+				});
+
+			SimulatorReader reader;
+			reader.insertCard();
+			const auto& worker = reader.createCardConnectionWorker();
+			QVERIFY(worker);
+
+			for (int i = 0; i < 2; ++i)
+			{
+				const auto& output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("111111"), QByteArray(), QByteArray());
+				QVERIFY(output.getPaceReturnCode() != CardReturnCode::OK);
+			}
+
+			// Even the correct PIN is rejected without the CAN and the retry counter is kept.
+			auto output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::INVALID_PIN_3);
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 1);
+
+			output = worker->establishPaceChannel(PacePasswordId::PACE_CAN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+			output = worker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray("123456"), QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+
+			QCOMPARE(worker->updateRetryCounter(), CardReturnCode::OK);
+			QCOMPARE(reader.getReaderInfo().getRetryCounter(), 3);
+		}
+
+
+		void apduLatency()
+		{
+			SimulatorCard card((SimulatorFileSystem()));
+			card.setApduLatency(50);
+
+			QElapsedTimer timer;
+			timer.start();
+			const auto& [returnCode, responseApdu] = card.transmit(CommandApdu(QByteArray::fromHex("0084000008")));
+			QCOMPARE(returnCode, CardReturnCode::OK);
+			QVERIFY(timer.elapsed() >= 50);
+		}
+
+
+		void failureRate()
+		{
+			SimulatorCard card((SimulatorFileSystem()));
+			const CommandApdu getChallenge(QByteArray::fromHex("0084000008"));
+
+			card.setFailureRate(1.0);
+			QCOMPARE(card.transmit(getChallenge).mReturnCode, CardReturnCode::COMMAND_FAILED);
+
+			card.setFailureRate(0.0);
+			QCOMPARE(card.transmit(getChallenge).mReturnCode, CardReturnCode::OK);
+		}
+
+
 		void destroyPaceChannel()
 		{
 			SimulatorCard card((SimulatorFileSystem()));
@@ -224,6 +224,32 @@ class test_SimulatorFileSystem
 		}
 
 
+		void passwords()
+		{
+			QFETCH_GLOBAL(SimulatorFileSystem, fileSystem);
+			QCOMPARE(fileSystem.getPassword(PacePasswordId::PACE_PIN), QByteArray("123456"));
+			QCOMPARE(fileSystem.getPassword(PacePasswordId::PACE_CAN), QByteArray("123456"));
+			QCOMPARE(fileSystem.getPassword(PacePasswordId::UNKNOWN), QByteArray());
+
+			QJsonDocument doc = QJsonDocument::fromJson(QByteArray(R"({
+	"passwords": {
+		"PACE_PIN": "654321",
+		"PACE_PUK": "1234567890",
+		"PACE_FOO": "1",
+		"PACE_CAN": ""
+	}
+})"));
+
+			QTest::ignoreMessage(QtWarningMsg, "Skipping password entry. Expected PACE_MRZ, PACE_CAN, PACE_PIN or PACE_PUK with a non-empty string, got \"PACE_CAN\"");
+			QTest::ignoreMessage(QtWarningMsg, "Skipping password entry. Expected PACE_MRZ, PACE_CAN, PACE_PIN or PACE_PUK with a non-empty string, got \"PACE_FOO\"");
+			const SimulatorFileSystem customFileSystem(doc.object());
+			QCOMPARE(customFileSystem.getPassword(PacePasswordId::PACE_PIN), QByteArray("654321"));
+			QCOMPARE(customFileSystem.getPassword(PacePasswordId::PACE_PUK), QByteArray("1234567890"));
+			QCOMPARE(customFileSystem.getPassword(PacePasswordId::PACE_CAN), QByteArray("123456"));
+			QCOMPARE(customFileSystem.getPassword(PacePasswordId::PACE_MRZ), QByteArray("123456"));
+		}
+
+
 		void verify_data()
 		{
 			QTest::addColumn<QByteArray>("authenticatedAuxiliaryData");
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref SimulatorReaderManagerPlugin
+ */
+
+#include "SimulatorReaderManagerPlugin.h"
+
+#include "AppSettings.h"
+#include "VolatileSettings.h"
+
+#include <QPointer>
+#include <QTemporaryFile>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_SimulatorReaderManagerPlugin
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QTemporaryFile mProfiles;
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			QVERIFY(mProfiles.open());
+			QVERIFY(mProfiles.write(R"([{"name": "Fast", "count": 2}, {"name": "Slow", "apduLatency": 5}])"_ba) > 0);
+			QVERIFY(mProfiles.flush());
+		}
+
+
+		void init()
+		{
+			Env::getSingleton<AppSettings>()->getSimulatorSettings().setReaderProfiles(mProfiles.fileName());
+			Env::getSingleton<VolatileSettings>()->setUsedAsSDK(true);
+		}
+
+
+		void cleanup()
+		{
+			Env::getSingleton<VolatileSettings>()->setUsedAsSDK(false);
+			Env::getSingleton<AppSettings>()->getSimulatorSettings().setReaderProfiles(QString());
+		}
+
+
+		void insertByReaderName()
+		{
+			SimulatorReaderManagerPlugin plugin;
+			plugin.init();
+			QSignalSpy spyInserted(&plugin, &SimulatorReaderManagerPlugin::fireCardInserted);
+
+			plugin.startScan(false);
+			QCOMPARE(plugin.getReaders().size(), 3);
+			QCOMPARE(spyInserted.size(), 0);
+
+			plugin.insert(u"Fast 2"_s, QVariant());
+			QCOMPARE(spyInserted.size(), 1);
+			auto info = qvariant_cast<ReaderInfo>(spyInserted.takeFirst().at(0));
+			QCOMPARE(info.getName(), "Fast 2"_L1);
+			QVERIFY(info.hasEid());
+
+			plugin.insert(u"Slow"_s, QVariant());
+			QTRY_COMPARE(spyInserted.size(), 1); // clazy:exclude=qstring-allocations
+			info = qvariant_cast<ReaderInfo>(spyInserted.takeFirst().at(0));
+			QCOMPARE(info.getName(), "Slow"_L1);
+			QVERIFY(info.hasEid());
+
+			plugin.stopScan();
+		}
+
+
+		void insertUnknownReader()
+		{
+			SimulatorReaderManagerPlugin plugin;
+			plugin.init();
+			QSignalSpy spyInserted(&plugin, &SimulatorReaderManagerPlugin::fireCardInserted);
+
+			plugin.insert(u"Fast 1"_s, QVariant());
+			QCOMPARE(spyInserted.size(), 0);
+
+			plugin.startScan(false);
+			QTest::ignoreMessage(QtWarningMsg, "Cannot insert card into unknown reader: \"Unknown\"");
+			plugin.insert(u"Unknown"_s, QVariant());
+			QCOMPARE(spyInserted.size(), 0);
+
+			plugin.stopScan();
+		}
+
+
+		void readerThreads()
+		{
+			SimulatorReaderManagerPlugin plugin;
+			plugin.init();
+			plugin.startScan(false);
+
+			QPointer<QThread> slowThread;
+			const auto& readers = plugin.getReaders();
+			for (const auto* reader : readers)
+			{
+				if (reader->getName() == "Slow"_L1)
+				{
+					slowThread = reader->thread();
+					QVERIFY(slowThread != plugin.thread());
+					QVERIFY(slowThread->isRunning());
+				}
+				else
+				{
+					QCOMPARE(reader->thread(), plugin.thread());
+				}
+			}
+			QVERIFY(slowThread);
+
+			plugin.stopScan();
+			QVERIFY(slowThread.isNull());
+		}
+
+
+		void removeReadersOnStopScan()
+		{
+			SimulatorReaderManagerPlugin plugin;
+			plugin.init();
+			QSignalSpy spyRemoved(&plugin, &SimulatorReaderManagerPlugin::fireReaderRemoved);
+			QSignalSpy spyCardRemoved(&plugin, &SimulatorReaderManagerPlugin::fireCardRemoved);
+
+			plugin.startScan(false);
+			plugin.insert(u"Slow"_s, QVariant());
+			QCOMPARE(plugin.getReaders().size(), 3);
+
+			plugin.stopScan();
+			QVERIFY(!plugin.getInfo().isScanRunning());
+			QVERIFY(plugin.getReaders().isEmpty());
+			QCOMPARE(spyCardRemoved.size(), 1);
+			QCOMPARE(spyRemoved.size(), 3);
+		}
+
+
+		void removeReadersOnDisable()
+		{
+			SimulatorReaderManagerPlugin plugin;
+			plugin.init();
+			QSignalSpy spyRemoved(&plugin, &SimulatorReaderManagerPlugin::fireReaderRemoved);
+
+			plugin.startScan(false);
+			QCOMPARE(plugin.getReaders().size(), 3);
+
+			Env::getSingleton<VolatileSettings>()->setUsedAsSDK(false);
+			QVERIFY(!plugin.getInfo().isEnabled());
+			QVERIFY(plugin.getReaders().isEmpty());
+			QCOMPARE(spyRemoved.size(), 3);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_SimulatorReaderManagerPlugin)
+#include "test_SimulatorReaderManagerPlugin.moc"
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref SimulatorReaderProfile
+ */
+
+#include "SimulatorReaderProfile.h"
+
+#include <QJsonDocument>
+#include <QTemporaryFile>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_SimulatorReaderProfile
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void defaultProfile()
+		{
+			const SimulatorReaderProfile profile;
+			QCOMPARE(profile.getName(), "Simulator"_L1);
+			QVERIFY(profile.getCardData().isEmpty());
+			QCOMPARE(profile.getApduLatency(), 0UL);
+			QCOMPARE(profile.getFailureRate(), 0.0);
+		}
+
+
+		void fromJson()
+		{
+			const auto& json = QJsonDocument::fromJson(R"([
+	{"name": "Farm", "count": 3, "apduLatency": 20, "failureRate": 0.5, "card": {"passwords": {"PACE_PIN": "654321"}}},
+	{"name": "Single"},
+	{"name": "Farm 2"},
+	{"count": 2},
+	{"name": "Broken", "failureRate": 2},
+	[]
+])"_ba).array();
+
+			QTest::ignoreMessage(QtWarningMsg, "Skipping reader profile with duplicate name: \"Farm 2\"");
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Skipping reader profile. Expected JSON object with 'name'.*"_L1));
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Skipping reader profile. Expected JSON object with 'name'.*"_L1));
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Skipping reader profile. Expected JSON object with 'name'.*"_L1));
+			const auto& profiles = SimulatorReaderProfile::fromJson(json, 10);
+			QCOMPARE(profiles.size(), 4);
+
+			QCOMPARE(profiles.at(0).getName(), "Farm 1"_L1);
+			QCOMPARE(profiles.at(1).getName(), "Farm 2"_L1);
+			QCOMPARE(profiles.at(2).getName(), "Farm 3"_L1);
+			for (qsizetype i = 0; i < 3; ++i)
+			{
+				QCOMPARE(profiles.at(i).getApduLatency(), 20UL);
+				QCOMPARE(profiles.at(i).getFailureRate(), 0.5);
+				QCOMPARE(profiles.at(i).getCardData()["passwords"_L1]["PACE_PIN"_L1].toString(), "654321"_L1);
+			}
+
+			QCOMPARE(profiles.at(3).getName(), "Single"_L1);
+			QCOMPARE(profiles.at(3).getApduLatency(), 10UL);
+			QCOMPARE(profiles.at(3).getFailureRate(), 0.0);
+			QVERIFY(profiles.at(3).getCardData().isEmpty());
+		}
+
+
+		void load()
+		{
+			auto profiles = SimulatorReaderProfile::load(QString(), 5);
+			QCOMPARE(profiles.size(), 1);
+			QCOMPARE(profiles.at(0).getName(), "Simulator"_L1);
+			QCOMPARE(profiles.at(0).getApduLatency(), 5UL);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Cannot open reader profiles: .*"_L1));
+			profiles = SimulatorReaderProfile::load(u"/does/not/exist.json"_s);
+			QCOMPARE(profiles.size(), 1);
+			QCOMPARE(profiles.at(0).getName(), "Simulator"_L1);
+
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			QCOMPARE(file.write(R"([{"name": "Load", "count": 2}])"_ba), 30);
+			QVERIFY(file.flush());
+
+			profiles = SimulatorReaderProfile::load(file.fileName());
+			QCOMPARE(profiles.size(), 2);
+			QCOMPARE(profiles.at(0).getName(), "Load 1"_L1);
+			QCOMPARE(profiles.at(1).getName(), "Load 2"_L1);
+
+			QVERIFY(file.resize(0));
+			QVERIFY(file.seek(0));
+			QCOMPARE(file.write("{}"_ba), 2);
+			QVERIFY(file.flush());
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Cannot parse reader profiles: .*"_L1));
+			profiles = SimulatorReaderProfile::load(file.fileName());
+			QCOMPARE(profiles.size(), 1);
+			QCOMPARE(profiles.at(0).getName(), "Simulator"_L1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_SimulatorReaderProfile)
+#include "test_SimulatorReaderProfile.moc"
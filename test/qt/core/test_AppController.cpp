@@ -5,6 +5,7 @@
 #include "controller/AppController.h"
 
 #include "ReaderManager.h"
+#include "VolatileSettings.h"
 #include "context/ChangePinContext.h"
 #include "controller/AuthController.h"
 #include "controller/ChangePinController.h"
@@ -15,6 +16,7 @@
 #include <QDir>
 #include <QSharedPointer>
 #include <QStandardPaths>
+#include <QUuid>
 #include <QtTest>
 
 
@@ -184,6 +186,108 @@ class test_AppController
 		}
 
 
+		void test_ConcurrentWorkflows()
+		{
+			connect(mController.data(), &AppController::fireWorkflowStarted, this, [this](const QSharedPointer<WorkflowRequest> pRequest){
+					pRequest->getContext()->claim(this);
+				});
+
+			const auto maxWorkflows = AppController::cMaxConcurrentWorkflows;
+			const auto guard = qScopeGuard([maxWorkflows] {
+					AppController::cMaxConcurrentWorkflows = maxWorkflows;
+				});
+			AppController::cMaxConcurrentWorkflows = 2;
+
+			const auto session = QVariant::fromValue(WorkflowSession(QUuid::createUuid()));
+			const auto first = ChangePinController::createWorkflowRequest(false, true, session);
+			const auto second = ChangePinController::createWorkflowRequest(false, true, QVariant::fromValue(WorkflowSession(QUuid::createUuid())));
+			const auto third = ChangePinController::createWorkflowRequest(false, true, QVariant::fromValue(WorkflowSession(QUuid::createUuid())));
+			const auto sameSession = ChangePinController::createWorkflowRequest(false, true, session);
+			const auto noSession = ChangePinController::createWorkflowRequest();
+
+			mController->onWorkflowRequested(first);
+			QCOMPARE(mController->mActiveWorkflow, first);
+
+			QTest::ignoreMessage(QtDebugMsg, "Enqueue workflow: PIN");
+			mController->onWorkflowRequested(sameSession);
+			QCOMPARE(mController->mWaitingRequest, sameSession);
+			mController->mWaitingRequest.reset();
+
+			QTest::ignoreMessage(QtInfoMsg, "Run concurrent workflow PIN | Running workflows: 2");
+			mController->onWorkflowRequested(second);
+			QCOMPARE(mController->mConcurrentWorkflows, QList<QSharedPointer<WorkflowRequest>>({second}));
+			QVERIFY(second->getContext()->wasClaimed());
+
+			QTest::ignoreMessage(QtDebugMsg, "Enqueue workflow: PIN");
+			mController->onWorkflowRequested(third);
+			QCOMPARE(mController->mWaitingRequest, third);
+			mController->mWaitingRequest.reset();
+
+			QSignalSpy spyWorkflowFinished(mController.data(), &AppController::fireWorkflowFinished);
+			QTest::ignoreMessage(QtInfoMsg, "Finish workflow PIN");
+			mController->onWorkflowFinished();
+			QCOMPARE(spyWorkflowFinished.count(), 1);
+			QVERIFY(!mController->mActiveWorkflow);
+
+			QTest::ignoreMessage(QtWarningMsg, "Cannot start workflow beside concurrent workflows: PIN");
+			mController->onWorkflowRequested(noSession);
+			QVERIFY(!mController->mActiveWorkflow);
+
+			QTest::ignoreMessage(QtInfoMsg, "Run concurrent workflow PIN | Running workflows: 2");
+			mController->onWorkflowRequested(third);
+			QCOMPARE(mController->mConcurrentWorkflows, QList<QSharedPointer<WorkflowRequest>>({second, third}));
+
+			QTest::ignoreMessage(QtInfoMsg, "Finish concurrent workflow PIN | Running workflows: 1");
+			Q_EMIT second->getController()->fireComplete();
+			QTRY_COMPARE(spyWorkflowFinished.count(), 2); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyWorkflowFinished.at(1).at(0).value<QSharedPointer<WorkflowRequest>>(), second);
+			QCOMPARE(mController->mConcurrentWorkflows, QList<QSharedPointer<WorkflowRequest>>({third}));
+
+			mController->doShutdown();
+			QVERIFY(third->getContext()->isWorkflowKilled());
+		}
+
+
+		void test_ConcurrentWorkflowSettings()
+		{
+			connect(mController.data(), &AppController::fireWorkflowStarted, this, [this](const QSharedPointer<WorkflowRequest> pRequest){
+					pRequest->getContext()->claim(this);
+				});
+
+			const auto maxWorkflows = AppController::cMaxConcurrentWorkflows;
+			const auto guard = qScopeGuard([maxWorkflows] {
+					AppController::cMaxConcurrentWorkflows = maxWorkflows;
+					Env::getSingleton<VolatileSettings>()->setWorkflowSettings(VolatileSettings::WorkflowSettings());
+				});
+			AppController::cMaxConcurrentWorkflows = 2;
+
+			VolatileSettings::WorkflowSettings developerMode;
+			developerMode.setDeveloperMode(true);
+			const auto first = ChangePinController::createWorkflowRequest(false, true, QVariant::fromValue(WorkflowSession(QUuid::createUuid(), developerMode)));
+			const auto second = ChangePinController::createWorkflowRequest(false, true, QVariant::fromValue(WorkflowSession(QUuid::createUuid())));
+			const auto third = ChangePinController::createWorkflowRequest(false, true, QVariant::fromValue(WorkflowSession(QUuid::createUuid(), developerMode)));
+
+			mController->onWorkflowRequested(first);
+			QCOMPARE(mController->mActiveWorkflow, first);
+			QVERIFY(Env::getSingleton<VolatileSettings>()->isDeveloperMode());
+			QVERIFY(!first->getContext()->getConnectionScope().isNull());
+
+			QTest::ignoreMessage(QtDebugMsg, "Enqueue workflow: PIN");
+			mController->onWorkflowRequested(second);
+			QCOMPARE(mController->mWaitingRequest, second);
+			QVERIFY(Env::getSingleton<VolatileSettings>()->isDeveloperMode());
+			mController->mWaitingRequest.reset();
+
+			QTest::ignoreMessage(QtInfoMsg, "Run concurrent workflow PIN | Running workflows: 2");
+			mController->onWorkflowRequested(third);
+			QCOMPARE(mController->mConcurrentWorkflows, QList<QSharedPointer<WorkflowRequest>>({third}));
+			QVERIFY(!third->getContext()->getConnectionScope().isNull());
+			QVERIFY(first->getContext()->getConnectionScope() != third->getContext()->getConnectionScope());
+
+			mController->doShutdown();
+		}
+
+
 		void test_notClaimed()
 		{
 			QTest::ignoreMessage(QtDebugMsg, "New workflow requested: SELF");
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref BinaryLog
+ */
+
+#include "BinaryLog.h"
+
+#include <QDateTime>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_BinaryLog
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		const qint64 mTimestamp = QDateTime(QDate(2024, 5, 17), QTime(13, 37, 42, 123)).toMSecsSinceEpoch();
+
+	private Q_SLOTS:
+		void header()
+		{
+			QVERIFY(BinaryLog::isBinary(BinaryLog::getHeader()));
+			QVERIFY(BinaryLog::isBinary(BinaryLog::getHeader() + "data"_ba));
+			QVERIFY(!BinaryLog::isBinary(QByteArray()));
+			QVERIFY(!BinaryLog::isBinary("card_pcsc     2024.05.17 13:37:42.123 1234   foo(bar.cpp:1) : text"_ba));
+			QVERIFY(BinaryLog::read("plain text"_ba).isEmpty());
+		}
+
+
+		void definitionsOnce()
+		{
+			BinaryLog log;
+			const auto& first = log.encode(mTimestamp, 1234, QtDebugMsg, "card"_ba, "foo(bar.cpp:1)"_ba, u"first"_s);
+			const auto& second = log.encode(mTimestamp, 1234, QtDebugMsg, "card"_ba, "foo(bar.cpp:1)"_ba, u"first"_s);
+			QVERIFY(first.contains("card"));
+			QVERIFY(first.contains("foo(bar.cpp:1)"));
+			QVERIFY(!second.contains("card"));
+			QVERIFY(!second.contains("foo(bar.cpp:1)"));
+			QVERIFY(second.size() < first.size());
+
+			log.reset();
+			QCOMPARE(log.encode(mTimestamp, 1234, QtDebugMsg, "card"_ba, "foo(bar.cpp:1)"_ba, u"first"_s), first);
+		}
+
+
+		void readAndRender()
+		{
+			BinaryLog log;
+			QByteArray data = BinaryLog::getHeader();
+			data += log.encode(mTimestamp, 1234, QtDebugMsg, "card"_ba, "Reader::transmit(card/base/Reader.cpp:42)"_ba, u"Transmit APDU"_s);
+			const auto secondPosition = data.size();
+			data += log.encode(mTimestamp + 1, 5678, QtWarningMsg, "network"_ba, "NetworkManager::get(network/NetworkManager.cpp:7)"_ba, u"Connection failed"_s);
+			data += log.encode(mTimestamp + 2, 1234, QtCriticalMsg, "card"_ba, "Reader::transmit(card/base/Reader.cpp:42)"_ba, u"Ümlaut\nsecond line"_s);
+
+			const auto& entries = BinaryLog::read(data);
+			QCOMPARE(entries.size(), 3);
+
+			const auto& first = entries.at(0);
+			QVERIFY(!first.isText());
+			QCOMPARE(first.getLevel(), "D"_L1);
+			QCOMPARE(first.getCategory(), "card"_L1);
+			QCOMPARE(first.getOrigin(), "card          2024.05.17 13:37:42.123 1234   Reader::transmit(card/base/Reader.cpp:42)"_L1);
+			QCOMPARE(first.getMessage(), "Transmit APDU"_L1);
+			QCOMPARE(first.toString(), "card          2024.05.17 13:37:42.123 1234   Reader::transmit(card/base/Reader.cpp:42)                                  : Transmit APDU"_L1);
+
+			const auto& second = entries.at(1);
+			QCOMPARE(second.getLevel(), "W"_L1);
+			QCOMPARE(second.getCategory(), "network"_L1);
+			QCOMPARE(second.toString(), "network       2024.05.17 13:37:42.124 5678 W NetworkManager::get(network/NetworkManager.cpp:7)                          : Connection failed"_L1);
+
+			const auto& third = entries.at(2);
+			QCOMPARE(third.getLevel(), "C"_L1);
+			QCOMPARE(third.getMessage(), u"Ümlaut\nsecond line"_s);
+
+			const auto& range = BinaryLog::read(data, secondPosition, 1);
+			QCOMPARE(range.size(), 1);
+			QCOMPARE(range.at(0).getMessage(), "Connection failed"_L1);
+
+			const auto& tail = BinaryLog::read(data, secondPosition);
+			QCOMPARE(tail.size(), 2);
+			QCOMPARE(tail.at(1).getCategory(), "card"_L1);
+
+			const auto& text = QString::fromUtf8(BinaryLog::toText(data, secondPosition));
+			QVERIFY(text.startsWith(second.toString()));
+			QVERIFY(text.contains(u"Ümlaut\nsecond line"_s));
+		}
+
+
+		void readEncoded()
+		{
+			BinaryLog log;
+			const auto& first = log.encode(mTimestamp, 1234, QtDebugMsg, "card"_ba, "foo(bar.cpp:1)"_ba, u"first"_s);
+			const auto& second = log.encode(mTimestamp, 1234, QtWarningMsg, "card"_ba, "foo(bar.cpp:1)"_ba, u"second"_s);
+			const auto& third = log.encode(mTimestamp, 1234, QtCriticalMsg, "network"_ba, "foo(bar.cpp:1)"_ba, u"third"_s);
+			QVERIFY(!first.isEmpty());
+
+			// The definitions of the first record are known by the instance.
+			const auto& entries = log.readEncoded(second + third);
+			QCOMPARE(entries.size(), 2);
+			QCOMPARE(entries.at(0).getCategory(), "card"_L1);
+			QCOMPARE(entries.at(0).getMessage(), "second"_L1);
+			QCOMPARE(entries.at(1).getCategory(), "network"_L1);
+			QCOMPARE(entries.at(1).getLevel(), "C"_L1);
+
+			QVERIFY(BinaryLog().readEncoded(second).at(0).getCategory().isEmpty());
+		}
+
+
+		void incompleteRecord()
+		{
+			BinaryLog log;
+			QByteArray data = BinaryLog::getHeader();
+			data += log.encode(mTimestamp, 1, QtInfoMsg, "init"_ba, "main(main.cpp:1)"_ba, u"complete"_s);
+			const auto& incomplete = log.encode(mTimestamp, 1, QtInfoMsg, "init"_ba, "main(main.cpp:1)"_ba, u"incomplete"_s);
+			data += incomplete.left(incomplete.size() - 3);
+
+			const auto& entries = BinaryLog::read(data);
+			QCOMPARE(entries.size(), 1);
+			QCOMPARE(entries.at(0).getMessage(), "complete"_L1);
+			QCOMPARE(entries.at(0).getLevel(), "I"_L1);
+		}
+
+
+		void textEntry()
+		{
+			auto entry = LogEntry::fromText("card_pcsc     2024.05.17 13:37:42.123 1234 W foo(bar.cpp:1) : text"_L1);
+			QVERIFY(entry.isText());
+			QCOMPARE(entry.getLevel(), "W"_L1);
+			QCOMPARE(entry.getCategory(), "card_pcsc"_L1);
+			QCOMPARE(entry.getOrigin(), "card_pcsc     2024.05.17 13:37:42.123 1234 W foo(bar.cpp:1)"_L1);
+			QCOMPARE(entry.getMessage(), "text"_L1);
+
+			entry.appendText("more"_L1);
+			QCOMPARE(entry.toString(), "card_pcsc     2024.05.17 13:37:42.123 1234 W foo(bar.cpp:1) : text\nmore"_L1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_BinaryLog)
+#include "test_BinaryLog.moc"
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref LogFileIndex
+ */
+
+#include "LogFileIndex.h"
+
+#include <QTemporaryFile>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_LogFileIndex
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static void append(QTemporaryFile& pFile, const QByteArray& pData)
+		{
+			QVERIFY(pFile.seek(pFile.size()));
+			QCOMPARE(pFile.write(pData), pData.size());
+			QVERIFY(pFile.flush());
+		}
+
+	private Q_SLOTS:
+		void emptyFile()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+
+			LogFileIndex index;
+			QVERIFY(index.open(file.fileName()));
+			QVERIFY(index.isOpen());
+			QCOMPARE(index.size(), 0);
+			QVERIFY(index.getLevels().isEmpty());
+			QVERIFY(index.getCategories().isEmpty());
+			QVERIFY(!index.update());
+
+			index.close();
+			QVERIFY(!index.isOpen());
+		}
+
+
+		void missingFile()
+		{
+			LogFileIndex index;
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Cannot open logfile: .*"_L1));
+			QVERIFY(!index.open(u"/does/not/exist.log"_s));
+			QVERIFY(!index.isOpen());
+			QCOMPARE(index.size(), 0);
+		}
+
+
+		void entries()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			append(file, "no header\n"
+						 "card_pcsc     2024.05.17 13:37:42.123 1234   foo(bar.cpp:1) : first\n"
+						 "network       2024.05.17 13:37:42.124 5678 W foo(bar.cpp:2) : second\r\n"
+						 "continued\r\n"
+						 "\n"
+						 "card_pcsc     2024.05.17 13:37:42.125 1234 C foo(bar.cpp:3) : third\n"_ba);
+
+			LogFileIndex index;
+			QVERIFY(index.open(file.fileName()));
+			QCOMPARE(index.size(), 4);
+			QCOMPARE(index.getLevels(), QStringList({"D"_L1, "W"_L1, "C"_L1}));
+			QCOMPARE(index.getCategories(), QStringList({"no"_L1, "card_pcsc"_L1, "network"_L1}));
+
+			QCOMPARE(index.getCategory(0), "no"_L1);
+			QCOMPARE(index.at(0).toString(), "no header"_L1);
+
+			QCOMPARE(index.getLevel(1), "D"_L1);
+			QCOMPARE(index.getCategory(1), "card_pcsc"_L1);
+			QCOMPARE(index.at(1).getMessage(), "first"_L1);
+
+			QCOMPARE(index.getLevel(2), "W"_L1);
+			QCOMPARE(index.getCategory(2), "network"_L1);
+			QCOMPARE(index.at(2).toString(), "network       2024.05.17 13:37:42.124 5678 W foo(bar.cpp:2) : second\ncontinued\n"_L1);
+			QCOMPARE(index.at(2).getLevel(), index.getLevel(2));
+
+			QCOMPARE(index.getLevel(3), "C"_L1);
+			QCOMPARE(index.at(3).toString(), "card_pcsc     2024.05.17 13:37:42.125 1234 C foo(bar.cpp:3) : third"_L1);
+		}
+
+
+		void update()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			append(file, "card          2024.05.17 13:37:42.123 1234 I foo(bar.cpp:1) : first\n"
+						 "card          2024.05.17 13:37:42.124 1234 I foo(bar.cpp:1) : sec"_ba);
+
+			LogFileIndex index;
+			QVERIFY(index.open(file.fileName()));
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.at(1).getMessage(), "sec"_L1);
+			QVERIFY(!index.update());
+
+			append(file, "ond\n"
+						 "more"_ba);
+			QVERIFY(index.update());
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.at(1).toString(), "card          2024.05.17 13:37:42.124 1234 I foo(bar.cpp:1) : second\nmore"_L1);
+
+			append(file, "\n"
+						 "network       2024.05.17 13:37:42.125 1234 W foo(bar.cpp:1) : third\n"_ba);
+			QVERIFY(index.update());
+			QCOMPARE(index.size(), 3);
+			QCOMPARE(index.at(1).toString(), "card          2024.05.17 13:37:42.124 1234 I foo(bar.cpp:1) : second\nmore"_L1);
+			QCOMPARE(index.getLevel(2), "W"_L1);
+			QCOMPARE(index.getLevels(), QStringList({"I"_L1, "W"_L1}));
+			QCOMPARE(index.getCategories(), QStringList({"card"_L1, "network"_L1}));
+
+#ifndef Q_OS_WIN // a mapped file cannot be truncated
+			QVERIFY(file.resize(0));
+			append(file, "init          2024.05.17 13:37:42.126 1234 I foo(bar.cpp:1) : rotated\n"_ba);
+			QTest::ignoreMessage(QtDebugMsg, QRegularExpression("^Logfile was truncated, index it again: .*"_L1));
+			QVERIFY(index.update());
+			QCOMPARE(index.size(), 1);
+			QCOMPARE(index.getCategories(), QStringList({"init"_L1}));
+			QCOMPARE(index.at(0).getMessage(), "rotated"_L1);
+#endif
+		}
+
+
+		void resource()
+		{
+			LogFileIndex index;
+			QVERIFY(index.open(u":/logfiles/auth.txt"_s));
+			QCOMPARE(index.size(), 1223);
+			QCOMPARE(index.getLevels().size(), 4);
+			QCOMPARE(index.getCategories().size(), 19);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_LogFileIndex)
+#include "test_LogFileIndex.moc"
@@ -125,6 +125,28 @@ class test_LogHandler
 		}
 
 
+		void fireLogEntry()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLogEntry);
+
+			qDebug() << "hallo";
+			qWarning() << "test nachricht";
+
+			QCOMPARE(logSpy.count(), 2);
+			const auto& entry1 = logSpy.at(0).at(0).value<LogEntry>();
+			const auto& entry2 = logSpy.at(1).at(0).value<LogEntry>();
+
+			QVERIFY(!entry1.isText());
+			QCOMPARE(entry1.getLevel(), QStringLiteral("D"));
+			QCOMPARE(entry1.getCategory(), QStringLiteral("default"));
+			QCOMPARE(entry1.getMessage(), QStringLiteral("hallo"));
+			QVERIFY(entry1.getOrigin().contains(QStringLiteral("test_LogHandler.cpp:")));
+
+			QCOMPARE(entry2.getLevel(), QStringLiteral("W"));
+			QCOMPARE(entry2.getMessage(), QStringLiteral("test nachricht"));
+		}
+
+
 		void otherLogFilesWithoutCurrent()
 		{
 			Env::getSingleton<LogHandler>()->setLogFile(true);
@@ -471,6 +493,125 @@ class test_LogHandler
 		}
 
 
+		void asyncLog()
+		{
+			const auto& logger = Env::getSingleton<LogHandler>();
+			logger->setAsync(true);
+			if (!logger->isAsync())
+			{
+				QSKIP("Asynchronous mode is not supported");
+			}
+			const auto guard = qScopeGuard([logger] {
+					logger->setAsync(false);
+				});
+
+			logger->resetBacklog();
+			logger->setUseHandler(false);
+			logger->setCriticalLogCapacity(10);
+			QSignalSpy logSpy(logger->getEventHandler(), &LogEventHandler::fireLog);
+
+			const int threadCount = 4;
+			const int messageCount = 1000;
+			QList<QThread*> threads;
+			for (int i = 0; i < threadCount; ++i)
+			{
+				threads << QThread::create([i] {
+						for (int j = 0; j < messageCount; ++j)
+						{
+							qDebug() << "async dummy" << i << j;
+						}
+					});
+				threads.last()->start();
+			}
+			for (auto* thread : std::as_const(threads))
+			{
+				QVERIFY(thread->wait());
+				delete thread;
+			}
+
+			const auto& backlog = logger->getBacklog();
+			QCOMPARE(backlog.count("async dummy"), threadCount * messageCount);
+			QVERIFY(backlog.contains("async dummy 3 999"));
+			QCOMPARE(logSpy.count(), threadCount * messageCount);
+
+			QVERIFY(!logger->hasCriticalLog());
+			qCritical() << "critical async dummy";
+			QVERIFY(logger->hasCriticalLog());
+			QVERIFY(logger->getCriticalLogWindow().contains("critical async dummy"));
+
+			logger->setAsync(false);
+			QVERIFY(!logger->isAsync());
+			qDebug() << "sync dummy";
+			QVERIFY(logger->getBacklog().contains("sync dummy"));
+		}
+
+
+		void binaryLog()
+		{
+			const auto& logger = Env::getSingleton<LogHandler>();
+			const auto guard = qScopeGuard([logger] {
+					logger->setBinaryLog(false);
+				});
+
+			qDebug() << "startup dummy";
+			const auto startupLogFile = logger->mLogFile->fileName();
+
+			logger->setBinaryLog(true);
+			QVERIFY(logger->isBinaryLog());
+			QVERIFY(logger->useLogFile());
+			QCOMPARE(logger->getBacklog(), QByteArray());
+
+			QVERIFY(logger->mLogFile->fileName() != startupLogFile);
+			QFile startupLog(startupLogFile);
+			QVERIFY(startupLog.open(QIODevice::ReadOnly));
+			QVERIFY(startupLog.readAll().contains("startup dummy"));
+			startupLog.close();
+
+			logger->setCriticalLogCapacity(10);
+			qDebug() << "binary dummy";
+			qCritical() << "critical binary dummy";
+
+			QFile logFile(logger->mLogFile->fileName());
+			QVERIFY(logFile.open(QIODevice::ReadOnly));
+			const auto& raw = logFile.readAll();
+			QVERIFY(raw.startsWith(BinaryLog::getHeader()));
+			QVERIFY(raw.contains("binary dummy"));
+			QVERIFY(!raw.contains(" : binary dummy"));
+
+			const auto& backlog = logger->getBacklog();
+			QVERIFY(backlog.contains(" : binary dummy"));
+			const QRegularExpression line(QStringLiteral("^default       \\d{4}\\.\\d{2}\\.\\d{2} \\d{2}:\\d{2}:\\d{2}\\.\\d{3} \\d+ C .+ : critical binary dummy$"));
+			QVERIFY(line.match(QString::fromUtf8(backlog.split('\n').at(1)).trimmed()).hasMatch());
+
+			const auto& entries = logger->getBacklogEntries();
+			QCOMPARE(entries.size(), 2);
+			QCOMPARE(entries.at(0).getLevel(), QStringLiteral("D"));
+			QCOMPARE(entries.at(1).getLevel(), QStringLiteral("C"));
+			QCOMPARE(entries.at(1).getCategory(), QStringLiteral("default"));
+			QCOMPARE(entries.at(1).getMessage(), QStringLiteral("critical binary dummy"));
+
+			QVERIFY(logger->hasCriticalLog());
+			QVERIFY(logger->getCriticalLogWindow().contains(" : critical binary dummy"));
+
+			const QString copyFilename = QDir::temp().filePath(QStringLiteral("AusweisApp.binary.txt"));
+			QVERIFY(logger->copy(copyFilename));
+			QFile copyFile(copyFilename);
+			QVERIFY(copyFile.open(QIODevice::ReadOnly));
+			QCOMPARE(copyFile.readAll(), logger->getBacklog(true));
+			copyFile.close();
+			QVERIFY(copyFile.remove());
+
+			logger->resetBacklog();
+			QCOMPARE(logger->getBacklog(), QByteArray());
+			QVERIFY(logger->getBacklogEntries().isEmpty());
+
+			logger->setBinaryLog(false);
+			qDebug() << "text dummy";
+			QVERIFY(!logger->getBacklog(true).startsWith(BinaryLog::getHeader()));
+			QVERIFY(logger->getBacklog().contains("text dummy"));
+		}
+
+
 		void formatFunction_data()
 		{
 			QTest::addColumn<QByteArray>("function");
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref MpscRingBuffer
+ */
+
+#include "MpscRingBuffer.h"
+
+#include <QList>
+#include <QThread>
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_MpscRingBuffer
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void capacity_data()
+		{
+			QTest::addColumn<quintptr>("requested");
+			QTest::addColumn<quintptr>("capacity");
+
+			QTest::newRow("0") << quintptr(0) << quintptr(2);
+			QTest::newRow("2") << quintptr(2) << quintptr(2);
+			QTest::newRow("3") << quintptr(3) << quintptr(4);
+			QTest::newRow("1000") << quintptr(1000) << quintptr(1024);
+			QTest::newRow("4096") << quintptr(4096) << quintptr(4096);
+		}
+
+
+		void capacity()
+		{
+			QFETCH(quintptr, requested);
+			QFETCH(quintptr, capacity);
+
+			const MpscRingBuffer<int> buffer(requested);
+			QCOMPARE(buffer.capacity(), capacity);
+		}
+
+
+		void pushAndPop()
+		{
+			MpscRingBuffer<QString> buffer(4);
+
+			QString value;
+			QVERIFY(!buffer.pop(value));
+
+			for (int round = 0; round < 3; ++round)
+			{
+				QVERIFY(buffer.push(QStringLiteral("a")));
+				QVERIFY(buffer.push(QStringLiteral("b")));
+				QVERIFY(buffer.push(QStringLiteral("c")));
+				QVERIFY(buffer.push(QStringLiteral("d")));
+				QVERIFY(!buffer.push(QStringLiteral("e")));
+
+				QVERIFY(buffer.pop(value));
+				QCOMPARE(value, QStringLiteral("a"));
+				QVERIFY(buffer.push(QStringLiteral("e")));
+
+				for (const auto& expected : {"b", "c", "d", "e"})
+				{
+					QVERIFY(buffer.pop(value));
+					QCOMPARE(value, QLatin1String(expected));
+				}
+				QVERIFY(!buffer.pop(value));
+			}
+		}
+
+
+		void concurrentProducers()
+		{
+			const int producerCount = 4;
+			const int valueCount = 10000;
+			MpscRingBuffer<int> buffer(64);
+
+			QList<QThread*> producers;
+			for (int i = 0; i < producerCount; ++i)
+			{
+				producers << QThread::create([&buffer, i] {
+						for (int j = 0; j < valueCount; ++j)
+						{
+							while (!buffer.push(i * valueCount + j))
+							{
+								QThread::yieldCurrentThread();
+							}
+						}
+					});
+				producers.last()->start();
+			}
+
+			QList<int> lastValues(producerCount, -1);
+			int received = 0;
+			while (received < producerCount * valueCount)
+			{
+				int value = 0;
+				if (!buffer.pop(value))
+				{
+					QThread::yieldCurrentThread();
+					continue;
+				}
+
+				// The values of every producer must arrive in order.
+				const int producer = value / valueCount;
+				QVERIFY(value % valueCount > lastValues.at(producer));
+				lastValues[producer] = value % valueCount;
+				++received;
+			}
+
+			for (auto* producer : std::as_const(producers))
+			{
+				QVERIFY(producer->wait());
+				delete producer;
+			}
+
+			int value = 0;
+			QVERIFY(!buffer.pop(value));
+			QCOMPARE(lastValues, QList<int>(producerCount, valueCount - 1));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_MpscRingBuffer)
+#include "test_MpscRingBuffer.moc"
@@ -33,7 +33,7 @@ class test_Discovery
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			Discovery msg(obj);
@@ -162,7 +162,7 @@ class test_Discovery
 							   })");
 			message.replace("[PAIRING]", json);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 			QVERIFY(!discovery.isIncomplete());
 			QCOMPARE(discovery.getType(), IfdMessageType::UNDEFINED);
@@ -239,7 +239,7 @@ class test_Discovery
 			message.replace("[IFDID]", json_ifdid);
 			message.replace("[PAIRING]", json_pairing);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 			QCOMPARE(discovery.isIncomplete(), incomplete);
 			QCOMPARE(discovery.getPairing(), pairing);
@@ -278,7 +278,7 @@ class test_Discovery
 									"pairing": true,
 									"msg": "%1"
 							   })");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", type)).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", type));
 			const Discovery discovery(obj);
 
 			QVERIFY(discovery.isIncomplete());
@@ -305,7 +305,7 @@ class test_Discovery
 										"port": 24728
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 			QVERIFY(!discovery.isIncomplete());
 			QCOMPARE(discovery.getContextHandle(), QString());
@@ -327,7 +327,7 @@ class test_Discovery
 										"port": "4"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 			QVERIFY(discovery.isIncomplete());
 			QCOMPARE(discovery.getIfdName(), QString());
@@ -362,7 +362,7 @@ class test_Discovery
 										"port": 24728
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 			QVERIFY(discovery.isIncomplete());
 			QCOMPARE(discovery.getSupportedApis(), QList<IfdVersion::Version>({IfdVersion::Version::v0}));
@@ -435,7 +435,7 @@ class test_Discovery
 			message.replace("[IFDID]", json_ifdid);
 			message.replace("[VERSION]", json_version);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const Discovery discovery(obj);
 
 			QCOMPARE(discovery.isIncomplete(), incomplete);
@@ -473,7 +473,7 @@ class test_Discovery
 											"port": 24728
 										 })");
 			messageHash.replace("[IFDID]", json_ifdid);
-			const QJsonObject& objHash = QJsonDocument::fromJson(messageHash).object();
+			const QCborMap& objHash = IfdMessage::parseByteArray(messageHash);
 			const Discovery discoveryHash(objHash);
 			QCOMPARE(logSpy.count(), 0);
 
@@ -502,7 +502,7 @@ class test_Discovery
 											"pairing": true,
 											"port": 24728
 										 })");
-			const QJsonObject& objCert = QJsonDocument::fromJson(messageCert).object();
+			const QCborMap& objCert = IfdMessage::parseByteArray(messageCert);
 			const Discovery discoveryCert(objCert);
 			QCOMPARE(logSpy.count(), 0);
 
@@ -29,7 +29,7 @@ class test_IfdConnect
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdConnect msg(obj);
@@ -94,7 +94,7 @@ class test_IfdConnect
 									 "    \"msg\": \"IFDConnect\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdConnect ifdConnect(obj);
 			QVERIFY(!ifdConnect.isIncomplete());
 			QCOMPARE(ifdConnect.getType(), IfdMessageType::IFDConnect);
@@ -130,7 +130,7 @@ class test_IfdConnect
 							   "    \"exclusive\": true,\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdConnect ifdConnect(obj);
 
 			if (type == IfdMessageType::IFDConnect)
@@ -171,7 +171,7 @@ class test_IfdConnect
 									 "    \"msg\": \"IFDConnect\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdConnect ifdConnect(obj);
 			QVERIFY(ifdConnect.isIncomplete());
 			QCOMPARE(ifdConnect.getType(), IfdMessageType::IFDConnect);
@@ -29,7 +29,7 @@ class test_IfdConnectResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdConnectResponse msg(obj);
@@ -99,7 +99,7 @@ class test_IfdConnectResponse
 									 "    \"msg\": \"IFDConnectResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdConnectResponse ifdConnectResponse(obj);
 			QVERIFY(!ifdConnectResponse.isIncomplete());
 			QCOMPARE(ifdConnectResponse.getType(), IfdMessageType::IFDConnectResponse);
@@ -137,7 +137,7 @@ class test_IfdConnectResponse
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdConnectResponse ifdConnectResponse(obj);
 
 			if (type == IfdMessageType::IFDConnectResponse)
@@ -179,7 +179,7 @@ class test_IfdConnectResponse
 									 "    \"msg\": \"IFDConnectResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdConnectResponse ifdConnectResponse(obj);
 			QVERIFY(ifdConnectResponse.isIncomplete());
 			QCOMPARE(ifdConnectResponse.getType(), IfdMessageType::IFDConnectResponse);
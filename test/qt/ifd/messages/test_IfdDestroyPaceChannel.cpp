@@ -33,7 +33,7 @@ class test_IfdDestroyPaceChannel
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdDestroyPaceChannel msg(obj);
@@ -100,7 +100,7 @@ class test_IfdDestroyPaceChannel
 									"msg": "IFDDestroyPACEChannel"
 								 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDestroyPaceChannel ifdDestroyPaceChannel(obj);
 			QVERIFY(!ifdDestroyPaceChannel.isIncomplete());
 			QCOMPARE(ifdDestroyPaceChannel.getType(), IfdMessageType::IFDDestroyPACEChannel);
@@ -132,7 +132,7 @@ class test_IfdDestroyPaceChannel
 									"SlotHandle": "SlotHandle",
 									"msg": "%1"
 							   })");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdDestroyPaceChannel ifdDestroyPaceChannel(obj);
 
 			if (type == IfdMessageType::IFDDestroyPACEChannel)
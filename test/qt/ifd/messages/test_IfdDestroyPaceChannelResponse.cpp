@@ -45,7 +45,7 @@ class test_IfdDestroyPaceChannelResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdDestroyPaceChannelResponse msg(obj);
@@ -123,7 +123,7 @@ class test_IfdDestroyPaceChannelResponse
 									 })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDestroyPaceChannelResponse ifdDestroyPaceChannelResponse(obj);
 			QVERIFY(!ifdDestroyPaceChannelResponse.isIncomplete());
 			QCOMPARE(ifdDestroyPaceChannelResponse.getType(), IfdMessageType::IFDDestroyPACEChannelResponse);
@@ -161,7 +161,7 @@ class test_IfdDestroyPaceChannelResponse
 							   })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdDestroyPaceChannelResponse ifdDestroyPaceChannelResponse(obj);
 
 			if (type == IfdMessageType::IFDDestroyPACEChannelResponse)
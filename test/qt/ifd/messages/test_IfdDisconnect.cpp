@@ -29,7 +29,7 @@ class test_IfdDisconnect
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdDisconnect msg(obj);
@@ -89,7 +89,7 @@ class test_IfdDisconnect
 									 "    \"msg\": \"IFDDisconnect\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDisconnect ifdDisconnect(obj);
 			QVERIFY(!ifdDisconnect.isIncomplete());
 			QCOMPARE(ifdDisconnect.getType(), IfdMessageType::IFDDisconnect);
@@ -123,7 +123,7 @@ class test_IfdDisconnect
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdDisconnect ifdDisconnect(obj);
 
 			if (type == IfdMessageType::IFDDisconnect)
@@ -163,7 +163,7 @@ class test_IfdDisconnect
 									 "    \"msg\": \"IFDDisconnect\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDisconnect ifdDisconnect(obj);
 			QVERIFY(ifdDisconnect.isIncomplete());
 			QCOMPARE(ifdDisconnect.getType(), IfdMessageType::IFDDisconnect);
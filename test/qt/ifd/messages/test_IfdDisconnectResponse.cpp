@@ -30,7 +30,7 @@ class test_IfdDisconnectResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdDisconnectResponse msg(obj);
@@ -100,7 +100,7 @@ class test_IfdDisconnectResponse
 									 "    \"msg\": \"IFDDisconnectResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDisconnectResponse ifdDisconnectResponse(obj);
 			QVERIFY(!ifdDisconnectResponse.isIncomplete());
 			QCOMPARE(ifdDisconnectResponse.getType(), IfdMessageType::IFDDisconnectResponse);
@@ -138,7 +138,7 @@ class test_IfdDisconnectResponse
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdDisconnectResponse ifdDisconnectResponse(obj);
 
 			if (type == IfdMessageType::IFDDisconnectResponse)
@@ -180,7 +180,7 @@ class test_IfdDisconnectResponse
 									 "    \"msg\": \"IFDDisconnectResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdDisconnectResponse ifdDisconnectResponse(obj);
 			QVERIFY(ifdDisconnectResponse.isIncomplete());
 			QCOMPARE(ifdDisconnectResponse.getType(), IfdMessageType::IFDDisconnectResponse);
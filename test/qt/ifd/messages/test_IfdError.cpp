@@ -30,7 +30,7 @@ class test_IfdError
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdError msg(obj);
@@ -100,7 +100,7 @@ class test_IfdError
 									 "    \"msg\": \"IFDError\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdError ifdError(obj);
 			QVERIFY(!ifdError.isIncomplete());
 			QCOMPARE(ifdError.getType(), IfdMessageType::IFDError);
@@ -138,7 +138,7 @@ class test_IfdError
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdError ifdError(obj);
 
 			if (type == IfdMessageType::IFDError)
@@ -180,7 +180,7 @@ class test_IfdError
 									 "    \"msg\": \"IFDError\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdError ifdError(obj);
 			QVERIFY(ifdError.isIncomplete());
 			QCOMPARE(ifdError.getType(), IfdMessageType::IFDError);
@@ -29,7 +29,7 @@ class test_IfdEstablishContext
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdEstablishContext msg(obj);
@@ -91,7 +91,7 @@ class test_IfdEstablishContext
 									 "    \"msg\": \"IFDEstablishContext\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishContext ifdEstablishContext(obj);
 			QVERIFY(!ifdEstablishContext.isIncomplete());
 			QCOMPARE(ifdEstablishContext.getType(), IfdMessageType::IFDEstablishContext);
@@ -124,7 +124,7 @@ class test_IfdEstablishContext
 							   "    \"UDName\": \"MAC-MINI\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdEstablishContext ifdEstablishContext(obj);
 
 			if (type == IfdMessageType::IFDEstablishContext)
@@ -167,7 +167,7 @@ class test_IfdEstablishContext
 									 "    \"msg\": \"IFDEstablishContext\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishContext ifdEstablishContext(obj);
 			QVERIFY(!ifdEstablishContext.isIncomplete());
 			QCOMPARE(ifdEstablishContext.getContextHandle(), QString());
@@ -186,7 +186,7 @@ class test_IfdEstablishContext
 									 "    \"msg\": \"IFDEstablishContext\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishContext ifdEstablishContext(obj);
 			QVERIFY(ifdEstablishContext.isIncomplete());
 
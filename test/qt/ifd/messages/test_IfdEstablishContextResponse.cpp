@@ -30,7 +30,7 @@ class test_IfdEstablishContextResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdEstablishContextResponse msg(obj);
@@ -100,7 +100,7 @@ class test_IfdEstablishContextResponse
 									 "    \"msg\": \"IFDEstablishContextResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishContextResponse ifdEstablishContextResponse(obj);
 			QVERIFY(!ifdEstablishContextResponse.isIncomplete());
 			QCOMPARE(ifdEstablishContextResponse.getType(), IfdMessageType::IFDEstablishContextResponse);
@@ -138,7 +138,7 @@ class test_IfdEstablishContextResponse
 							   "    \"ResultMinor\": null,\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdEstablishContextResponse ifdEstablishContextResponse(obj);
 
 			if (type == IfdMessageType::IFDEstablishContextResponse)
@@ -180,7 +180,7 @@ class test_IfdEstablishContextResponse
 									 "    \"msg\": \"IFDEstablishContextResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishContextResponse ifdEstablishContextResponse(obj);
 			QVERIFY(ifdEstablishContextResponse.isIncomplete());
 			QCOMPARE(ifdEstablishContextResponse.getType(), IfdMessageType::IFDEstablishContextResponse);
@@ -41,7 +41,7 @@ class test_IfdEstablishPaceChannel
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdEstablishPaceChannel msg(obj);
@@ -149,7 +149,7 @@ class test_IfdEstablishPaceChannel
 								 })");
 			message.replace("[DATA]", inputData);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannel ifdEstablishPaceChannel(obj);
 			QCOMPARE(ifdEstablishPaceChannel.isIncomplete(), incomplete);
 			QCOMPARE(ifdEstablishPaceChannel.getType(), IfdMessageType::IFDEstablishPACEChannel);
@@ -206,7 +206,7 @@ class test_IfdEstablishPaceChannel
 									"SlotHandle": "SlotHandle",
 									"msg": "%1"
 							   })");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdEstablishPaceChannel ifdEstablishPaceChannel(obj);
 
 			if (type == IfdMessageType::IFDEstablishPACEChannel)
@@ -248,7 +248,7 @@ class test_IfdEstablishPaceChannel
 										"msg": "IFDEstablishPACEChannel"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannel ifdEstablishPaceChannel(obj);
 			QVERIFY(ifdEstablishPaceChannel.isIncomplete());
 			QCOMPARE(ifdEstablishPaceChannel.getType(), IfdMessageType::IFDEstablishPACEChannel);
@@ -277,7 +277,7 @@ class test_IfdEstablishPaceChannel
 									"msg": "IFDEstablishPACEChannel"
 							   })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannel ifdEstablishPaceChannel(obj);
 			QVERIFY(ifdEstablishPaceChannel.isIncomplete());
 			QCOMPARE(ifdEstablishPaceChannel.getType(), IfdMessageType::IFDEstablishPACEChannel);
@@ -324,7 +324,7 @@ class test_IfdEstablishPaceChannel
 								 })");
 			message.replace("[JSON]", json);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannel ifdEstablishPaceChannel(obj);
 			QVERIFY(!ifdEstablishPaceChannel.isIncomplete());
 			QCOMPARE(ifdEstablishPaceChannel.getType(), IfdMessageType::IFDEstablishPACEChannel);
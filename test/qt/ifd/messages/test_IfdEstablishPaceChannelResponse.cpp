@@ -46,7 +46,7 @@ class test_IfdEstablishPaceChannelResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdEstablishPaceChannelResponse msg(obj);
@@ -177,7 +177,7 @@ class test_IfdEstablishPaceChannelResponse
 			message.replace("[DATA]", outputData.toHex());
 			message.replace("[RESULT]", withResultCode ? QByteArray(R"("ResultCode": "00000000",)") : QByteArray());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannelResponse ifdEstablishPaceChannelResponse(obj);
 			QCOMPARE(ifdEstablishPaceChannelResponse.isIncomplete(), incomplete);
 			QCOMPARE(ifdEstablishPaceChannelResponse.getType(), IfdMessageType::IFDEstablishPACEChannelResponse);
@@ -238,7 +238,7 @@ class test_IfdEstablishPaceChannelResponse
 			message.replace("[OK]", RESULT_OK());
 			message.replace("[TYPE]", QTest::currentDataTag());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannelResponse ifdEstablishPaceChannelResponse(obj);
 
 			if (type == IfdMessageType::IFDEstablishPACEChannelResponse)
@@ -283,7 +283,7 @@ class test_IfdEstablishPaceChannelResponse
 									 })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannelResponse ifdEstablishPaceChannelResponse(obj);
 			QVERIFY(ifdEstablishPaceChannelResponse.isIncomplete());
 			QCOMPARE(ifdEstablishPaceChannelResponse.getType(), IfdMessageType::IFDEstablishPACEChannelResponse);
@@ -314,7 +314,7 @@ class test_IfdEstablishPaceChannelResponse
 							   })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannelResponse ifdEstablishPaceChannelResponse(obj);
 
 			QVERIFY(ifdEstablishPaceChannelResponse.isIncomplete());
@@ -361,7 +361,7 @@ class test_IfdEstablishPaceChannelResponse
 			message.replace("[OK]", RESULT_OK());
 			message.replace("[RESULT]", withResultCode ? QByteArray(R"("ResultCode": "00000000",)") : QByteArray());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdEstablishPaceChannelResponse ifdEstablishPaceChannelResponse(obj);
 
 			QVERIFY(ifdEstablishPaceChannelResponse.isIncomplete());
@@ -30,7 +30,7 @@ class test_IfdGetStatus
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdGetStatus msg(obj);
@@ -90,7 +90,7 @@ class test_IfdGetStatus
 									 "    \"msg\": \"IFDGetStatus\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdGetStatus ifdGetStatus(obj);
 			QVERIFY(!ifdGetStatus.isIncomplete());
 			QCOMPARE(ifdGetStatus.getType(), IfdMessageType::IFDGetStatus);
@@ -124,7 +124,7 @@ class test_IfdGetStatus
 							   "    \"SlotName\": \"SlotName\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdGetStatus ifdGetStatus(obj);
 
 			if (type == IfdMessageType::IFDGetStatus)
@@ -164,7 +164,7 @@ class test_IfdGetStatus
 									 "    \"msg\": \"IFDGetStatus\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdGetStatus ifdGetStatus(obj);
 			QVERIFY(ifdGetStatus.isIncomplete());
 			QCOMPARE(ifdGetStatus.getType(), IfdMessageType::IFDGetStatus);
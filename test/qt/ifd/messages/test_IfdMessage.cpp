@@ -5,6 +5,8 @@
 #include "messages/IfdMessage.h"
 
 #include "LogHandler.h"
+#include "messages/IfdTransmit.h"
+#include "messages/IfdTransmitResponse.h"
 
 #include <QtTest>
 
@@ -246,6 +248,62 @@ class test_IfdMessage
 		}
 
 
+		void binaryFraming()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			const IfdTransmitResponse message(QStringLiteral("SlotHandle"), QByteArrayList({QByteArray::fromHex("6a82"), QByteArray(200, '\x42') + QByteArray::fromHex("9000")}));
+			const QByteArray& json = message.toByteArray(IfdVersion::Version::v3, QStringLiteral("TestContext"));
+			const QByteArray& cbor = message.toByteArray(IfdVersion::Version::v4, QStringLiteral("TestContext"));
+			QVERIFY(!IfdMessage::isBinary(json));
+			QVERIFY(IfdMessage::isBinary(cbor));
+			QVERIFY(cbor.size() < json.size());
+
+			QVERIFY(!cbor.contains("6a82"));
+			QVERIFY(json.contains("6a82"));
+
+			const auto& obj = IfdMessage::parseByteArray(cbor);
+			QCOMPARE(obj.toVariantMap(), IfdMessage::parseByteArray(json).toVariantMap());
+			QCOMPARE(obj.value("OutputAPDUs"_L1).toArray().at(0).toByteArray(), QByteArray::fromHex("6a82"));
+
+			const IfdTransmitResponse parsed(obj);
+			QVERIFY(!parsed.isIncomplete());
+			QCOMPARE(parsed.getOutputApdus(), message.getOutputApdus());
+			QCOMPARE(logSpy.count(), 0);
+		}
+
+
+		void binaryFramingNested()
+		{
+			InputAPDUInfo inputApduInfo(QByteArray::fromHex("00B0000000"));
+			inputApduInfo.addAcceptableStatusCode("9000");
+			const IfdTransmit message(QStringLiteral("SlotHandle"), {inputApduInfo, inputApduInfo}, QStringLiteral("Text"));
+
+			const auto& obj = IfdMessage::parseByteArray(message.toByteArray(IfdVersion::Version::v4, QStringLiteral("TestContext")));
+			QCOMPARE(obj.toVariantMap(), IfdMessage::parseByteArray(message.toByteArray(IfdVersion::Version::v3, QStringLiteral("TestContext"))).toVariantMap());
+
+			const IfdTransmit parsed(obj);
+			QVERIFY(!parsed.isIncomplete());
+			QCOMPARE(parsed.getInputApduInfos().size(), 2);
+			QCOMPARE(QByteArray(parsed.getInputApduInfos().at(1).getInputApdu()), QByteArray::fromHex("00B0000000"));
+			QCOMPARE(parsed.getInputApduInfos().at(1).getAcceptableStatusCodes(), QByteArrayList({"9000"}));
+			QCOMPARE(parsed.getDisplayText(), QStringLiteral("Text"));
+		}
+
+
+		void invalidCbor()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			const auto& obj = IfdMessage::parseByteArray(QByteArray::fromHex("a2616d"));
+			QVERIFY(obj.isEmpty());
+
+			QCOMPARE(logSpy.count(), 2);
+			QVERIFY(logSpy.at(0).at(0).toString().contains("Cbor parsing failed."_L1));
+			QVERIFY(logSpy.at(1).at(0).toString().contains("Expected object at top level"_L1));
+		}
+
+
 		void contextHandle_data()
 		{
 			QTest::addColumn<IfdMessageType>("type");
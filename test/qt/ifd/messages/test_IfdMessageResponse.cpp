@@ -30,7 +30,7 @@ class test_IfdMessageResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdMessageResponse msg(obj);
@@ -122,7 +122,7 @@ class test_IfdMessageResponse
 
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdMessageResponse ifdMessageResponse(obj);
 			QCOMPARE(ifdMessageResponse.isIncomplete(), isIncomplete);
 			QCOMPARE(ifdMessageResponse.getType(), IfdMessageType::IFDEstablishContextResponse);
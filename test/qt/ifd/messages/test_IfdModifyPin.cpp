@@ -29,7 +29,7 @@ class test_IfdModifyPin
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdModifyPin msg(obj);
@@ -96,7 +96,7 @@ class test_IfdModifyPin
 									 "    \"msg\": \"IFDModifyPIN\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdModifyPin ifdModifyPin(obj);
 			QVERIFY(!ifdModifyPin.isIncomplete());
 			QCOMPARE(ifdModifyPin.getType(), IfdMessageType::IFDModifyPIN);
@@ -132,7 +132,7 @@ class test_IfdModifyPin
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdModifyPin ifdModifyPin(obj);
 
 			if (type == IfdMessageType::IFDModifyPIN)
@@ -173,7 +173,7 @@ class test_IfdModifyPin
 									 "    \"msg\": \"IFDModifyPIN\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdModifyPin ifdModifyPin(obj);
 			QVERIFY(ifdModifyPin.isIncomplete());
 			QCOMPARE(ifdModifyPin.getType(), IfdMessageType::IFDModifyPIN);
@@ -29,7 +29,7 @@ class test_IfdModifyPinResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdModifyPinResponse msg(obj);
@@ -104,7 +104,7 @@ class test_IfdModifyPinResponse
 									 "    \"msg\": \"IFDModifyPINResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdModifyPinResponse ifdModifyPinResponse(obj);
 			QVERIFY(!ifdModifyPinResponse.isIncomplete());
 			QCOMPARE(ifdModifyPinResponse.getType(), IfdMessageType::IFDModifyPINResponse);
@@ -144,7 +144,7 @@ class test_IfdModifyPinResponse
 							   "    \"SlotHandle\": \"SlotHandle\",\n"
 							   "    \"msg\": \"%1\"\n"
 							   "}\n");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdModifyPinResponse ifdModifyPinResponse(obj);
 
 			if (type == IfdMessageType::IFDModifyPINResponse)
@@ -187,7 +187,7 @@ class test_IfdModifyPinResponse
 									 "    \"msg\": \"IFDModifyPINResponse\"\n"
 									 "}\n");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdModifyPinResponse ifdModifyPinResponse(obj);
 			QVERIFY(ifdModifyPinResponse.isIncomplete());
 			QCOMPARE(ifdModifyPinResponse.getType(), IfdMessageType::IFDModifyPINResponse);
@@ -38,7 +38,7 @@ class test_IfdStatus
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdStatus msg(obj);
@@ -199,7 +199,7 @@ class test_IfdStatus
 							   })");
 			message.replace("[PINPAD]", json);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdStatus ifdStatus(obj);
 			QCOMPARE(ifdStatus.isIncomplete(), incomplete);
 			QCOMPARE(ifdStatus.getType(), IfdMessageType::IFDStatus);
@@ -253,7 +253,7 @@ class test_IfdStatus
 									"SlotName": "SlotName",
 									"msg": "%1"
 							   })");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdStatus ifdStatus(obj);
 
 			if (type == IfdMessageType::IFDStatus)
@@ -301,7 +301,7 @@ class test_IfdStatus
 										"msg": "IFDStatus"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdStatus ifdStatus(obj);
 			QVERIFY(ifdStatus.isIncomplete());
 			QCOMPARE(ifdStatus.getType(), IfdMessageType::IFDStatus);
@@ -351,7 +351,7 @@ class test_IfdStatus
 										"msg": "IFDStatus"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdStatus ifdStatus(obj);
 			QVERIFY(ifdStatus.isIncomplete());
 			QCOMPARE(ifdStatus.getType(), IfdMessageType::IFDStatus);
@@ -34,7 +34,7 @@ class test_IfdTransmit
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdTransmit msg(obj);
@@ -89,6 +89,7 @@ class test_IfdTransmit
 																		 "        }\n"
 																		 "    ],\n") << QByteArray();
 			QTest::newRow("v2") << IfdVersion::Version::v2 << QByteArray() << QByteArray("    \"InputAPDU\": \"00a402022f00\",\n");
+			QTest::newRow("v3") << IfdVersion::Version::v3 << QByteArray() << QByteArray("    \"InputAPDU\": \"00a402022f00\",\n");
 		}
 
 
@@ -162,7 +163,7 @@ class test_IfdTransmit
 								 })");
 			message.replace("[APDU]", json);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmit ifdTransmit(obj);
 			QCOMPARE(ifdTransmit.isIncomplete(), incomplete);
 			QCOMPARE(ifdTransmit.getType(), IfdMessageType::IFDTransmit);
@@ -208,7 +209,7 @@ class test_IfdTransmit
 									"SlotHandle": "SlotHandle",
 									"msg": "%1"
 							   })");
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdTransmit ifdTransmit(obj);
 
 			if (type == IfdMessageType::IFDTransmit)
@@ -253,6 +254,8 @@ class test_IfdTransmit
 			QTest::newRow("v2 - Null") << IfdVersion::Version::v2 << QLatin1String() << false;
 			QTest::newRow("v2 - Empty") << IfdVersion::Version::v2 << ""_L1 << true;
 			QTest::newRow("v2 - Text") << IfdVersion::Version::v2 << "Text"_L1 << true;
+			QTest::newRow("v3 - Null") << IfdVersion::Version::v3 << QLatin1String() << false;
+			QTest::newRow("v3 - Text") << IfdVersion::Version::v3 << "Text"_L1 << true;
 		}
 
 
@@ -264,7 +267,7 @@ class test_IfdTransmit
 
 			const IfdTransmit transmit(QStringLiteral("SlotHandle"), QByteArray("00A402022F00"), displayText);
 			const QByteArray message = transmit.toByteArray(version, QStringLiteral("TestContext"));
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 
 			QCOMPARE(obj.contains(QLatin1String("DisplayText")), included);
 			QCOMPARE(obj.value(QLatin1String("DisplayText")).toString(QStringLiteral("FAIL")), included ? displayText : QStringLiteral("FAIL"));
@@ -289,7 +292,7 @@ class test_IfdTransmit
 										"msg": "IFDTransmit"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmit ifdTransmit(obj);
 			QVERIFY(ifdTransmit.isIncomplete());
 			QCOMPARE(ifdTransmit.getType(), IfdMessageType::IFDTransmit);
@@ -325,7 +328,7 @@ class test_IfdTransmit
 										"msg": "IFDTransmit"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmit ifdTransmit(obj);
 			QVERIFY(ifdTransmit.isIncomplete());
 			QCOMPARE(ifdTransmit.getType(), IfdMessageType::IFDTransmit);
@@ -359,7 +362,7 @@ class test_IfdTransmit
 										"msg": "IFDTransmit"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmit ifdTransmit(obj);
 			QVERIFY(ifdTransmit.isIncomplete());
 			QCOMPARE(ifdTransmit.getType(), IfdMessageType::IFDTransmit);
@@ -397,7 +400,7 @@ class test_IfdTransmit
 										"msg": "IFDTransmit"
 									 })");
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmit ifdTransmit(obj);
 			QVERIFY(!ifdTransmit.isIncomplete());
 			QCOMPARE(ifdTransmit.getType(), IfdMessageType::IFDTransmit);
@@ -410,6 +413,102 @@ class test_IfdTransmit
 		}
 
 
+		void batchToJson()
+		{
+			InputAPDUInfo select(QByteArray::fromHex("00A402022F00"));
+			select.addAcceptableStatusCode("9000");
+			InputAPDUInfo read(QByteArray::fromHex("00B0000000"));
+			read.addAcceptableStatusCode("90");
+			read.addAcceptableStatusCode("6282");
+
+			const IfdTransmit ifdTransmit(QStringLiteral("SlotHandle"), {select, read}, QStringLiteral("Test"));
+			QVERIFY(ifdTransmit.isBatch());
+			QCOMPARE(ifdTransmit.getInputApdu(), QByteArray());
+
+			const QByteArray& byteArray = ifdTransmit.toByteArray(IfdVersion::Version::v3, QStringLiteral("TestContext"));
+			QCOMPARE(byteArray,
+					QByteArray("{\n"
+							   "    \"ContextHandle\": \"TestContext\",\n"
+							   "    \"DisplayText\": \"Test\",\n"
+							   "    \"InputAPDUInfos\": [\n"
+							   "        {\n"
+							   "            \"AcceptableStatusCodes\": [\n"
+							   "                \"9000\"\n"
+							   "            ],\n"
+							   "            \"InputAPDU\": \"00a402022f00\"\n"
+							   "        },\n"
+							   "        {\n"
+							   "            \"AcceptableStatusCodes\": [\n"
+							   "                \"90\",\n"
+							   "                \"6282\"\n"
+							   "            ],\n"
+							   "            \"InputAPDU\": \"00b0000000\"\n"
+							   "        }\n"
+							   "    ],\n"
+							   "    \"SlotHandle\": \"SlotHandle\",\n"
+							   "    \"msg\": \"IFDTransmit\"\n"
+							   "}\n"));
+
+			const IfdTransmit parsed(IfdMessage::parseByteArray(byteArray));
+			QVERIFY(!parsed.isIncomplete());
+			QVERIFY(parsed.isBatch());
+			QCOMPARE(parsed.getDisplayText(), QStringLiteral("Test"));
+			const auto& inputApduInfos = parsed.getInputApduInfos();
+			QCOMPARE(inputApduInfos.size(), 2);
+			QCOMPARE(QByteArray(inputApduInfos.at(0).getInputApdu()), QByteArray::fromHex("00A402022F00"));
+			QCOMPARE(inputApduInfos.at(0).getAcceptableStatusCodes(), QByteArrayList({"9000"}));
+			QCOMPARE(QByteArray(inputApduInfos.at(1).getInputApdu()), QByteArray::fromHex("00B0000000"));
+			QCOMPARE(inputApduInfos.at(1).getAcceptableStatusCodes(), QByteArrayList({"90", "6282"}));
+		}
+
+
+		void batchFromJson_data()
+		{
+			QTest::addColumn<QByteArray>("json");
+			QTest::addColumn<int>("count");
+			QTest::addColumn<QLatin1String>("log");
+
+			QTest::newRow("Without codes") << QByteArray(R"("InputAPDUInfos": [ { "InputAPDU": "00A402022F00" }, { "InputAPDU": "00B0000000" } ],)") << 2 << QLatin1String();
+			QTest::newRow("Null codes") << QByteArray(R"("InputAPDUInfos": [ { "AcceptableStatusCodes": null, "InputAPDU": "00A402022F00" } ],)") << 1 << QLatin1String();
+			QTest::newRow("Empty") << QByteArray(R"("InputAPDUInfos": [],)") << 0 << "The value of \"InputAPDUInfos\" should be of type \"non-empty object array\""_L1;
+			QTest::newRow("No array") << QByteArray(R"("InputAPDUInfos": 1,)") << 0 << "The value of \"InputAPDUInfos\" should be of type \"non-empty object array\""_L1;
+			QTest::newRow("No object") << QByteArray(R"("InputAPDUInfos": [ 1 ],)") << 0 << "The value of \"InputAPDUInfos\" should be of type \"object array\""_L1;
+			QTest::newRow("Wrong codes") << QByteArray(R"("InputAPDUInfos": [ { "AcceptableStatusCodes": "9000", "InputAPDU": "00A402022F00" } ],)") << 1 << "The value of \"AcceptableStatusCodes\" should be of type \"string array\""_L1;
+		}
+
+
+		void batchFromJson()
+		{
+			QFETCH(QByteArray, json);
+			QFETCH(int, count);
+			QFETCH(QLatin1String, log);
+
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			QByteArray message(R"({
+									[APDUS]
+									"ContextHandle": "TestContext",
+									"SlotHandle": "SlotHandle",
+									"msg": "IFDTransmit"
+								 })");
+			message.replace("[APDUS]", json);
+
+			const IfdTransmit ifdTransmit(IfdMessage::parseByteArray(message));
+			QCOMPARE(ifdTransmit.isIncomplete(), !log.isNull());
+			QCOMPARE(ifdTransmit.isBatch(), count > 0);
+			if (count > 0)
+			{
+				QCOMPARE(ifdTransmit.getInputApduInfos().size(), count);
+			}
+
+			QCOMPARE(logSpy.count(), log.isNull() ? 0 : 1);
+			if (!log.isNull())
+			{
+				QVERIFY(TestFileHelper::containsLog(logSpy, log));
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_IfdTransmit)
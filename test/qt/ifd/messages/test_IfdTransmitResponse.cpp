@@ -46,7 +46,7 @@ class test_IfdTransmitResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message("FooBar");
-			const auto& obj = QJsonDocument::fromJson(message).object();
+			const auto& obj = IfdMessage::parseByteArray(message);
 			QVERIFY(obj.isEmpty());
 
 			IfdTransmitResponse msg(obj);
@@ -96,6 +96,7 @@ class test_IfdTransmitResponse
 																		 "        \"9000\"\n"
 																		 "    ],\n");
 			QTest::newRow("v2") << IfdVersion::Version::v2 << QByteArray("    \"ResponseAPDU\": \"9000\",\n");
+			QTest::newRow("v3") << IfdVersion::Version::v3 << QByteArray("    \"ResponseAPDU\": \"9000\",\n");
 		}
 
 
@@ -169,7 +170,7 @@ class test_IfdTransmitResponse
 			message.replace("[OK]", RESULT_OK());
 			message.replace("[APDU]", json);
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmitResponse ifdTransmitResponse(obj);
 			QCOMPARE(ifdTransmitResponse.isIncomplete(), incomplete);
 			QCOMPARE(ifdTransmitResponse.getType(), IfdMessageType::IFDTransmitResponse);
@@ -218,7 +219,7 @@ class test_IfdTransmitResponse
 							   })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message.replace("%1", QTest::currentDataTag())).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message.replace("%1", QTest::currentDataTag()));
 			const IfdTransmitResponse ifdTransmitResponse(obj);
 
 			if (type == IfdMessageType::IFDTransmitResponse)
@@ -264,7 +265,7 @@ class test_IfdTransmitResponse
 									 })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmitResponse ifdTransmitResponse(obj);
 			QVERIFY(ifdTransmitResponse.isIncomplete());
 			QCOMPARE(ifdTransmitResponse.getType(), IfdMessageType::IFDTransmitResponse);
@@ -305,7 +306,7 @@ class test_IfdTransmitResponse
 									 })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmitResponse ifdTransmitResponse(obj);
 			QVERIFY(ifdTransmitResponse.isIncomplete());
 			QCOMPARE(ifdTransmitResponse.getType(), IfdMessageType::IFDTransmitResponse);
@@ -342,7 +343,7 @@ class test_IfdTransmitResponse
 									 })");
 			message.replace("[OK]", RESULT_OK());
 
-			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const QCborMap& obj = IfdMessage::parseByteArray(message);
 			const IfdTransmitResponse ifdTransmitResponse(obj);
 			QVERIFY(!ifdTransmitResponse.isIncomplete());
 			QCOMPARE(ifdTransmitResponse.getType(), IfdMessageType::IFDTransmitResponse);
@@ -357,6 +358,64 @@ class test_IfdTransmitResponse
 		}
 
 
+		void batch()
+		{
+			const IfdTransmitResponse ifdTransmitResponse(QStringLiteral("SlotHandle"), QByteArrayList({QByteArray::fromHex("9000"), QByteArray::fromHex("01026282")}), ECardApiResult::Minor::AL_Unknown_Error);
+			QVERIFY(ifdTransmitResponse.isBatch());
+
+			const QByteArray& byteArray = ifdTransmitResponse.toByteArray(IfdVersion::Version::v3, QStringLiteral("TestContext"));
+			const QJsonObject obj = QJsonDocument::fromJson(byteArray).object();
+			QCOMPARE(obj.size(), 6);
+			QVERIFY(!obj.contains(QLatin1String("ResponseAPDU")));
+			const QJsonArray array = obj.value(QLatin1String("OutputAPDUs")).toArray();
+			QCOMPARE(array.size(), 2);
+			QCOMPARE(array.at(0).toString(), QStringLiteral("9000"));
+			QCOMPARE(array.at(1).toString(), QStringLiteral("01026282"));
+
+			const IfdTransmitResponse parsed(IfdMessage::parseByteArray(byteArray));
+			QVERIFY(!parsed.isIncomplete());
+			QVERIFY(parsed.isBatch());
+			QVERIFY(parsed.resultHasError());
+			QCOMPARE(parsed.getResultMinor(), ECardApiResult::Minor::AL_Unknown_Error);
+			QCOMPARE(parsed.getOutputApdus(), QByteArrayList({QByteArray::fromHex("9000"), QByteArray::fromHex("01026282")}));
+		}
+
+
+		void noBatch()
+		{
+			const IfdTransmitResponse ifdTransmitResponse(QStringLiteral("SlotHandle"), QByteArray::fromHex("9000"));
+			QVERIFY(!ifdTransmitResponse.isBatch());
+			QCOMPARE(ifdTransmitResponse.getOutputApdus(), QByteArrayList({QByteArray::fromHex("9000")}));
+		}
+
+
+		void wrongOutputApdusType()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			QByteArray message(R"({
+										"ContextHandle": "TestContext",
+										"OutputAPDUs": [
+											"9000",
+											1
+										],
+										"ResultMajor": "[OK]",
+										"ResultMinor": null,
+										"SlotHandle": "SlotHandle",
+										"msg": "IFDTransmitResponse"
+									 })");
+			message.replace("[OK]", RESULT_OK());
+
+			const IfdTransmitResponse ifdTransmitResponse(IfdMessage::parseByteArray(message));
+			QVERIFY(ifdTransmitResponse.isIncomplete());
+			QVERIFY(ifdTransmitResponse.isBatch());
+			QVERIFY(ifdTransmitResponse.getOutputApdus().isEmpty());
+
+			QCOMPARE(logSpy.count(), 1);
+			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("The value of \"OutputAPDUs\" should be of type \"string array\"")));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_IfdTransmitResponse)
@@ -22,6 +22,8 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_Unknown"_L1), IfdVersion::Version::Unknown);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v0"_L1), IfdVersion::Version::v0);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v2"_L1), IfdVersion::Version::v2);
+			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v3"_L1), IfdVersion::Version::v3);
+			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v4"_L1), IfdVersion::Version::v4);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v9001"_L1), IfdVersion::Version::Unknown);
 		}
 
@@ -31,6 +33,8 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion(IfdVersion::Version::Unknown).isValid(), false);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v0).isValid(), true);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v2).isValid(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v3).isValid(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v4).isValid(), true);
 		}
 
 
@@ -39,12 +43,24 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion(IfdVersion::Version::Unknown).isSupported(), false);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v0).isSupported(), false);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v2).isSupported(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v3).isSupported(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v4).isSupported(), true);
+		}
+
+
+		void isBinaryFraming()
+		{
+			QCOMPARE(IfdVersion(IfdVersion::Version::Unknown).isBinaryFraming(), false);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v0).isBinaryFraming(), false);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v2).isBinaryFraming(), false);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v3).isBinaryFraming(), false);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v4).isBinaryFraming(), true);
 		}
 
 
 		void supportedVersions()
 		{
-			QList<IfdVersion::Version> versions({IfdVersion::Version::v2});
+			QList<IfdVersion::Version> versions({IfdVersion::Version::v2, IfdVersion::Version::v3, IfdVersion::Version::v4});
 			if (IfdVersion(IfdVersion::Version::v0).isSupported())
 			{
 				versions.prepend(IfdVersion::Version::v0);
@@ -77,6 +93,14 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v0, IfdVersion::Version::v2, IfdVersion::Version::Unknown}), IfdVersion::Version::v2);
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::Unknown, IfdVersion::Version::v0}), IfdVersion::Version::v2);
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::v0, IfdVersion::Version::Unknown}), IfdVersion::Version::v2);
+
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v3}), IfdVersion::Version::v3);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::v3}), IfdVersion::Version::v3);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v3, IfdVersion::Version::v2}), IfdVersion::Version::v3);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v0, IfdVersion::Version::v3, IfdVersion::Version::Unknown}), IfdVersion::Version::v3);
+
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v4}), IfdVersion::Version::v4);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::v4, IfdVersion::Version::v3}), IfdVersion::Version::v4);
 		}
 
 
@@ -103,7 +103,7 @@ class test_RemoteReaderAdvertiser
 
 			const auto data = mMock->mList.at(0);
 			advertiser.reset();
-			const auto& offerMsg = Discovery(QJsonDocument::fromJson(data).object());
+			const auto& offerMsg = Discovery(IfdMessage::parseByteArray(data));
 
 			QCOMPARE(offerMsg.getIfdName(), ifdName);
 			QCOMPARE(offerMsg.getIfdId(), ifdId.toLower());
@@ -210,7 +210,7 @@ class test_IfdConnector
 
 			// Device information is null.
 			const QHostAddress hostAddress(QHostAddress::LocalHost);
-			sendRequest(connector, hostAddress, Discovery(QJsonObject()), "secret");
+			sendRequest(connector, hostAddress, Discovery(QCborMap()), "secret");
 			QTRY_COMPARE(spyError.count(), 1); // clazy:exclude=qstring-allocations
 
 			clientThread.exit();
@@ -42,8 +42,8 @@ class test_IfdDescriptor
 			const QHostAddress address1(QStringLiteral("192.168.1.1"));
 			const QHostAddress address2(QHostAddress::LocalHost);
 
-			const IfdDescriptor invalid1(Discovery(QJsonObject()), address1);
-			const IfdDescriptor invalid2(Discovery(QJsonObject()), address2);
+			const IfdDescriptor invalid1(Discovery(QCborMap()), address1);
+			const IfdDescriptor invalid2(Discovery(QCborMap()), address2);
 
 			QVERIFY(invalid1 == invalid2);
 		}
@@ -33,7 +33,7 @@ class IfdDispatcherSpy
 		bool mClosed;
 		GlobalStatus::Code mCloseCode;
 		QList<IfdMessageType> mReceivedMessageTypes;
-		QList<QJsonObject> mReceivedMessages;
+		QList<QCborMap> mReceivedMessages;
 		QList<QString> mReceivedSignalSenders;
 
 	public:
@@ -43,12 +43,12 @@ class IfdDispatcherSpy
 		[[nodiscard]] bool isClosed() const;
 		[[nodiscard]] GlobalStatus::Code getCloseCode() const;
 		[[nodiscard]] const QList<IfdMessageType>& getReceivedMessageTypes() const;
-		[[nodiscard]] const QList<QJsonObject>& getReceivedMessages() const;
+		[[nodiscard]] const QList<QCborMap>& getReceivedMessages() const;
 		[[nodiscard]] const QList<QString>& getReceivedSignalSenders() const;
 
 	private Q_SLOTS:
 		void onClosed(GlobalStatus::Code pCloseCode, const QString& pId);
-		void onReceived(IfdMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void onReceived(IfdMessageType pMessageType, const QCborMap& pMessageObject, const QString& pId);
 };
 
 
@@ -113,7 +113,7 @@ const QList<IfdMessageType>& IfdDispatcherSpy::getReceivedMessageTypes() const
 }
 
 
-const QList<QJsonObject>& IfdDispatcherSpy::getReceivedMessages() const
+const QList<QCborMap>& IfdDispatcherSpy::getReceivedMessages() const
 {
 	return mReceivedMessages;
 }
@@ -133,11 +133,11 @@ void IfdDispatcherSpy::onClosed(GlobalStatus::Code pCloseCode, const QString& pI
 }
 
 
-void IfdDispatcherSpy::onReceived(IfdMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId)
+void IfdDispatcherSpy::onReceived(IfdMessageType pMessageType, const QCborMap& pMessageObject, const QString& pId)
 {
 	qDebug() << "IfdDispatcherSpy::onReceived() -" << pMessageType;
 	mReceivedMessageTypes += pMessageType;
-	mReceivedMessages += pJsonObject;
+	mReceivedMessages += pMessageObject;
 	mReceivedSignalSenders += pId;
 }
 
@@ -231,7 +231,7 @@ class test_IfdDispatcher
 			clientDispatcher->send(QSharedPointer<const IfdMessage>(new IfdDisconnect(QStringLiteral("NFC Reader"))));
 
 			const QList<IfdMessageType> receivedMessageTypes = spy.getReceivedMessageTypes();
-			const QList<QJsonObject> receivedMessages = spy.getReceivedMessages();
+			const QList<QCborMap> receivedMessages = spy.getReceivedMessages();
 			QCOMPARE(receivedMessageTypes.size(), 3);
 			QCOMPARE(receivedMessages.size(), 3);
 
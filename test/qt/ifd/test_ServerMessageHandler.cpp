@@ -88,16 +88,11 @@ class test_ServerMessageHandler
 		}
 
 
-		void ensureContext(QString& pContextHandle)
+		void ensureContext(QString& pContextHandle, IfdVersion::Version pVersion = IfdVersion::Version::v2)
 		{
 			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
 
-			const QByteArray establishContextMsg("{\n"
-												 "    \"msg\": \"IFDEstablishContext\",\n"
-												 "    \"Protocol\": \"IFDInterface_WebSocket_v2\",\n"
-												 "    \"UDName\": \"MAC-MINI\"\n"
-												 "}");
-
+			const QByteArray establishContextMsg = IfdEstablishContext(pVersion, "MAC-MINI"_L1).toByteArray(pVersion, QString());
 			mDataChannel->onReceived(establishContextMsg);
 
 			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
@@ -682,6 +677,47 @@ class test_ServerMessageHandler
 		}
 
 
+		void ifdTransmitBatchWithSingleApdu()
+		{
+			ServerMessageHandlerImpl serverMessageHandler(mDataChannel);
+			QString contextHandle;
+			ensureContext(contextHandle, IfdVersion::Version::v3);
+
+			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
+
+			MockReader* reader = MockReaderManagerPlugin::getInstance().addReader("test-reader"_L1);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			reader->setCard(MockCardConfig({
+						{CardReturnCode::OK, QByteArray("9000")}
+					}));
+			QTRY_COMPARE(sendSpy.count(), 2); // clazy:exclude=qstring-allocations
+			const CardInfo cardInfo(CardType::EID_CARD, FileRef(), QSharedPointer<const EFCardAccess>(), 3, true);
+			ReaderInfo info = reader->getReaderInfo();
+			info.setCardInfo(cardInfo);
+			reader->setReaderInfo(info);
+			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			sendSpy.clear();
+
+			mDataChannel->onReceived(IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::v3, contextHandle));
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			const IfdConnectResponse connectResponse(IfdMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!connectResponse.resultHasError());
+			sendSpy.clear();
+
+			const QList<InputAPDUInfo> inputApduInfos({InputAPDUInfo(QByteArray::fromHex("00a4020c02011c"))});
+			mDataChannel->onReceived(IfdTransmit(connectResponse.getSlotHandle(), inputApduInfos).toByteArray(IfdVersion::Version::v3, contextHandle));
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+
+			const IfdTransmitResponse transmitResponse(IfdMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!transmitResponse.isIncomplete());
+			QVERIFY(!transmitResponse.resultHasError());
+			QVERIFY(transmitResponse.isBatch());
+			QCOMPARE(transmitResponse.getOutputApdus().size(), 1);
+
+			removeReaderAndConsumeMessages(QStringLiteral("test-reader"));
+		}
+
+
 		void ifdEstablishPACEChannelWithBasicReaderNameSendsAL_Unknown_Error()
 		{
 			const bool pinpadModeToSave = Env::getSingleton<AppSettings>()->getRemoteServiceSettings().getPinPadMode();
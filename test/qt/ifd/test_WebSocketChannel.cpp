@@ -111,6 +111,28 @@ class test_WebSocketChannel
 		}
 
 
+		void test_sendBinary()
+		{
+			setupServerConfig({mKeyClient.getCertificate()});
+			setupClientConfig({mKeyClient.getCertificate()}, mKeyClient.getKey());
+			establishConnection();
+
+			QSignalSpy textReceivedSpy(mClient.data(), &QWebSocket::textMessageReceived);
+			QSignalSpy binaryReceivedSpy(mClient.data(), &QWebSocket::binaryMessageReceived);
+			QSignalSpy channelReceivedSpy(mChannel.data(), &DataChannel::fireReceived);
+
+			const auto& data = QByteArray::fromHex("a1006190ff");
+			mChannel->sendBinary(data);
+			QTRY_COMPARE(binaryReceivedSpy.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(binaryReceivedSpy.constFirst().constFirst().value<QByteArray>(), data);
+			QCOMPARE(textReceivedSpy.count(), 0);
+
+			mClient->sendBinaryMessage(data);
+			QTRY_COMPARE(channelReceivedSpy.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(channelReceivedSpy.constFirst().constFirst().value<QByteArray>(), data);
+		}
+
+
 		void test_getId_data()
 		{
 			QTest::addColumn<QList<QSslCertificate>>("certs");
@@ -106,6 +106,180 @@ class test_HttpRequest
 
 			request.triggerSocketBuffer();
 			QCOMPARE(receivedData, data);
+			QVERIFY(!request.mReusable);
+		}
+
+
+		void headerCaseInsensitive()
+		{
+			auto* socket = new MockSocket();
+			socket->mReadBuffer = QByteArray("GET / HTTP/1.1\r\n"
+											 "Host: Dummy.de\r\n"
+											 "X-Dummy: first\r\n"
+											 "x-dummy: second\r\n"
+											 "\r\n");
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QCOMPARE(request.getHeader().size(), 3);
+			QCOMPARE(request.getHeader().at(0), HttpRequest::Header("Host", "Dummy.de"));
+			QCOMPARE(request.getHeader("host"), QByteArray("Dummy.de"));
+			QCOMPARE(request.getHeader("HOST"), QByteArray("Dummy.de"));
+			QCOMPARE(request.getHeader("X-DUMMY"), QByteArray("second"));
+			QCOMPARE(request.getHeader("unknown"), QByteArray());
+		}
+
+
+		void bodyConsumer()
+		{
+			auto* socket = new MockSocket();
+			socket->mReadBuffer = QByteArray("POST /upload HTTP/1.1\r\n"
+											 "Content-Length: 26\r\n"
+											 "\r\n"
+											 "abcdefghijklm");
+
+			HttpRequest request(socket);
+			QByteArrayList chunks;
+			connect(&request, &HttpRequest::fireHeadersComplete, this, [&chunks](HttpRequest* pRequest){
+					QCOMPARE(pRequest->getUrl(), QUrl("/upload"_L1));
+					pRequest->setBodyConsumer([&chunks](QByteArrayView pChunk){
+						chunks += pChunk.toByteArray();
+					});
+				});
+
+			request.triggerSocketBuffer();
+			QVERIFY(!request.mFinished);
+			QCOMPARE(chunks, QByteArrayList({"abcdefghijklm"}));
+			QCOMPARE(request.mMessageSize, static_cast<qint64>(0));
+			QVERIFY(socket->isTransactionStarted());
+
+			socket->mReadBuffer += "nopqrstuvwxyz";
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QVERIFY(request.getBody().isEmpty());
+			QCOMPARE(chunks, QByteArrayList({"abcdefghijklm", "nopqrstuvwxyz"}));
+		}
+
+
+		void bodyConsumerKeepAlivePipelined()
+		{
+			const QByteArray first("POST /first HTTP/1.1\r\n"
+								   "Host: 127.0.0.1\r\n"
+								   "Content-Length: 8\r\n"
+								   "\r\n"
+								   "abcd");
+			const QByteArray second("GET /second HTTP/1.1\r\n"
+									"Host: 127.0.0.1\r\n"
+									"\r\n");
+
+			auto* socket = new MockSocket();
+			socket->setSocketState(QAbstractSocket::ConnectedState);
+			socket->mReadBuffer = first;
+
+			HttpRequest request(socket);
+			QByteArray body;
+			connect(&request, &HttpRequest::fireHeadersComplete, this, [&body](HttpRequest* pRequest){
+					pRequest->setBodyConsumer([&body](QByteArrayView pChunk){
+						body += pChunk.toByteArray();
+					});
+				});
+
+			request.triggerSocketBuffer();
+			QVERIFY(!request.mFinished);
+			QCOMPARE(request.mMessageSize, static_cast<qint64>(0));
+
+			socket->mReadBuffer += "efgh" + second;
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QCOMPARE(body, QByteArray("abcdefgh"));
+			QCOMPARE(request.mMessageSize, static_cast<qint64>(4));
+
+			QVERIFY(request.send(HttpResponse(HTTP_STATUS_OK)));
+			QVERIFY(request.isKeepAlive());
+
+			HttpRequest next(request.takeForNextRequest());
+			next.triggerSocketBuffer();
+			QVERIFY(next.mFinished);
+			QCOMPARE(next.getHttpMethod(), HTTP_GET);
+			QCOMPARE(next.getUrl(), QUrl("/second"_L1));
+		}
+
+
+		void keepAlivePipelined()
+		{
+			const QByteArray first("GET /first HTTP/1.1\r\n"
+								   "Host: 127.0.0.1\r\n"
+								   "\r\n");
+			const QByteArray second("POST /second HTTP/1.1\r\n"
+									"Host: 127.0.0.1\r\n"
+									"Content-Length: 4\r\n"
+									"\r\n"
+									"body");
+
+			auto* socket = new MockSocket();
+			socket->setSocketState(QAbstractSocket::ConnectedState);
+			socket->mReadBuffer = first + second;
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QCOMPARE(request.getUrl(), QUrl("/first"_L1));
+			QCOMPARE(request.mMessageSize, static_cast<qint64>(first.size()));
+			QVERIFY(request.getBody().isEmpty());
+			QVERIFY(!request.isKeepAlive());
+
+			QVERIFY(request.send(HttpResponse(HTTP_STATUS_OK)));
+			QVERIFY(socket->mWriteBuffer.contains("Connection: keep-alive\r\n"));
+			QVERIFY(request.isKeepAlive());
+
+			HttpRequest next(request.takeForNextRequest());
+			QVERIFY(!request.isKeepAlive());
+			next.triggerSocketBuffer();
+			QVERIFY(next.mFinished);
+			QCOMPARE(next.getHttpMethod(), HTTP_POST);
+			QCOMPARE(next.getUrl(), QUrl("/second"_L1));
+			QCOMPARE(next.getBody(), QByteArray("body"));
+		}
+
+
+		void connectionClose_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+
+			QTest::newRow("close") << QByteArray("GET / HTTP/1.1\r\nConnection: close\r\n\r\n");
+			QTest::newRow("http10") << QByteArray("GET / HTTP/1.0\r\n\r\n");
+		}
+
+
+		void connectionClose()
+		{
+			QFETCH(QByteArray, data);
+
+			auto* socket = new MockSocket();
+			socket->setSocketState(QAbstractSocket::ConnectedState);
+			socket->mReadBuffer = data;
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QVERIFY(request.send(HttpResponse(HTTP_STATUS_OK)));
+			QVERIFY(!socket->mWriteBuffer.contains("Connection:"));
+			QVERIFY(!request.isKeepAlive());
+		}
+
+
+		void rawResponse()
+		{
+			auto* socket = new MockSocket();
+			socket->setSocketState(QAbstractSocket::ConnectedState);
+			socket->mReadBuffer = QByteArray("GET / HTTP/1.1\r\n\r\n");
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QVERIFY(request.send(QByteArray("HTTP/1.0 200 OK\r\n\r\n")));
+			QVERIFY(!request.isKeepAlive());
 		}
 
 
@@ -19,6 +19,7 @@
 #include <QNetworkRequest>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QTcpSocket>
 #include <QtTest>
 
 using namespace Qt::Literals::StringLiterals;
@@ -43,6 +44,8 @@ class test_HttpServer
 		void init()
 		{
 			HttpServer::cPort = 0;
+			HttpServer::cKeepAliveTimeout = 5000;
+			HttpServer::cMaxKeepAliveConnections = 10;
 		}
 
 
@@ -156,6 +159,104 @@ class test_HttpServer
 		}
 
 
+		void keepAlivePipelined()
+		{
+			HttpServer server;
+			QVERIFY(server.isListening());
+			QSignalSpy spyServer(&server, &HttpServer::fireNewHttpRequest);
+
+			QTcpSocket client;
+			client.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(client.waitForConnected());
+			client.write("GET /eID-Client?status HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n"
+						 "GET /eID-Client?status=json HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+
+			QTRY_COMPARE(spyServer.count(), 1); // clazy:exclude=qstring-allocations
+			auto httpRequest = qvariant_cast<QSharedPointer<HttpRequest>>(spyServer.takeFirst().at(0));
+			QCOMPARE(httpRequest->getUrl(), QUrl("/eID-Client?status"_L1));
+			QVERIFY(httpRequest->send(HttpResponse(HTTP_STATUS_OK, "first"_ba, "text/plain"_ba)));
+			QVERIFY(httpRequest->isKeepAlive());
+
+			// The next request is handled after the current one was released.
+			QTest::qWait(10);
+			QCOMPARE(spyServer.count(), 0);
+			httpRequest.reset();
+
+			QTRY_COMPARE(spyServer.count(), 1); // clazy:exclude=qstring-allocations
+			httpRequest = qvariant_cast<QSharedPointer<HttpRequest>>(spyServer.takeFirst().at(0));
+			QCOMPARE(httpRequest->getUrl(), QUrl("/eID-Client?status=json"_L1));
+			QVERIFY(httpRequest->send(HttpResponse(HTTP_STATUS_OK, "second"_ba, "text/plain"_ba)));
+			httpRequest.reset();
+
+			QByteArray response;
+			QTRY_VERIFY((response += client.readAll()).endsWith("second")); // clazy:exclude=qstring-allocations
+			QCOMPARE(response.count("Connection: keep-alive"), 2);
+			QVERIFY(response.indexOf("first") < response.indexOf("second"));
+			QCOMPARE(client.state(), QAbstractSocket::ConnectedState);
+		}
+
+
+		void keepAliveIdleTimeout()
+		{
+			HttpServer::cKeepAliveTimeout = 50;
+			HttpServer server;
+			QVERIFY(server.isListening());
+			QSignalSpy spyServer(&server, &HttpServer::fireNewHttpRequest);
+
+			QTcpSocket client;
+			client.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(client.waitForConnected());
+			client.write("GET /eID-Client?status HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+
+			QTRY_COMPARE(spyServer.count(), 1); // clazy:exclude=qstring-allocations
+			auto httpRequest = qvariant_cast<QSharedPointer<HttpRequest>>(spyServer.takeFirst().at(0));
+			QVERIFY(httpRequest->send(HttpResponse(HTTP_STATUS_OK, "first"_ba, "text/plain"_ba)));
+			QVERIFY(httpRequest->isKeepAlive());
+			httpRequest.reset();
+
+			QTRY_COMPARE(client.state(), QAbstractSocket::UnconnectedState); // clazy:exclude=qstring-allocations
+			QVERIFY(client.readAll().contains("Connection: keep-alive"));
+			QCOMPARE(spyServer.count(), 0);
+		}
+
+
+		void keepAliveLimit()
+		{
+			HttpServer::cMaxKeepAliveConnections = 1;
+			HttpServer server;
+			QVERIFY(server.isListening());
+			QSignalSpy spyServer(&server, &HttpServer::fireNewHttpRequest);
+
+			QTcpSocket first;
+			first.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(first.waitForConnected());
+			first.write("GET /first HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+
+			QTRY_COMPARE(spyServer.count(), 1); // clazy:exclude=qstring-allocations
+			auto httpRequest = qvariant_cast<QSharedPointer<HttpRequest>>(spyServer.takeFirst().at(0));
+			QVERIFY(httpRequest->send(HttpResponse(HTTP_STATUS_OK, "first"_ba, "text/plain"_ba)));
+			QVERIFY(httpRequest->isKeepAlive());
+			httpRequest.reset();
+			QTRY_COMPARE(server.mKeptAliveRequests.size(), 1); // clazy:exclude=qstring-allocations
+
+			QTcpSocket second;
+			second.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(second.waitForConnected());
+			second.write("GET /second HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+
+			QTRY_COMPARE(spyServer.count(), 1); // clazy:exclude=qstring-allocations
+			httpRequest = qvariant_cast<QSharedPointer<HttpRequest>>(spyServer.takeFirst().at(0));
+			QVERIFY(httpRequest->send(HttpResponse(HTTP_STATUS_OK, "second"_ba, "text/plain"_ba)));
+			QVERIFY(!httpRequest->isKeepAlive());
+			httpRequest.reset();
+
+			QTRY_COMPARE(second.state(), QAbstractSocket::UnconnectedState); // clazy:exclude=qstring-allocations
+			QVERIFY(!second.readAll().contains("Connection: keep-alive"));
+			QCOMPARE(first.state(), QAbstractSocket::ConnectedState);
+			QCOMPARE(server.mKeptAliveRequests.size(), 1);
+		}
+
+
 		void websocketUpgrade()
 		{
 			HttpServer server;
@@ -180,6 +180,77 @@ class test_NetworkManager
 		}
 
 
+		void resumeSslSession()
+		{
+			MockNetworkManager networkManager;
+			auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig().getConfiguration();
+			cfg.setSessionTicket("ticket"_ba);
+			networkManager.cacheSslSession(QUrl("https://dummy/tctoken"_L1), cfg);
+
+			QNetworkRequest other(QUrl("https://other"_L1));
+			networkManager.resumeSslSession(other);
+			QCOMPARE(other.sslConfiguration(), QSslConfiguration::defaultConfiguration());
+
+			QNetworkRequest request(QUrl("https://dummy/paos"_L1));
+			networkManager.resumeSslSession(request);
+			QCOMPARE(request.sslConfiguration().sessionTicket(), "ticket"_ba);
+			QCOMPARE(request.sslConfiguration().ciphers(), cfg.ciphers());
+
+			QNetworkRequest again(QUrl("https://dummy/paos"_L1));
+			networkManager.resumeSslSession(again);
+			QVERIFY(again.sslConfiguration().sessionTicket().isEmpty());
+		}
+
+
+		void connectionScopes()
+		{
+			MockNetworkManager networkManager;
+			const auto scope = QUuid::createUuid();
+
+			QNetworkRequest shared(QUrl("https://dummy"_L1));
+			QCOMPARE(&networkManager.getAccessManager(shared), &networkManager.mNetAccessManager);
+
+			QNetworkRequest request(QUrl("https://dummy"_L1));
+			NetworkManager::setConnectionScope(request, scope);
+			auto* manager = &networkManager.getAccessManager(request);
+			QVERIFY(manager != &networkManager.mNetAccessManager);
+			QCOMPARE(manager->redirectPolicy(), QNetworkRequest::ManualRedirectPolicy);
+			QCOMPARE(&networkManager.getAccessManager(request), manager);
+
+			QNetworkRequest other(QUrl("https://dummy"_L1));
+			NetworkManager::setConnectionScope(other, QUuid::createUuid());
+			QVERIFY(&networkManager.getAccessManager(other) != manager);
+			QCOMPARE(networkManager.mScopedAccessManagers.size(), 2);
+
+			networkManager.clearConnections(scope);
+			QCOMPARE(networkManager.mScopedAccessManagers.size(), 2);
+
+			networkManager.releaseConnectionScope(scope);
+			QCOMPARE(networkManager.mScopedAccessManagers.size(), 1);
+			QVERIFY(!networkManager.mScopedAccessManagers.contains(scope));
+
+			NetworkManager::setConnectionScope(request, QUuid());
+			QCOMPARE(&networkManager.getAccessManager(request), &networkManager.mNetAccessManager);
+		}
+
+
+		void prefetch()
+		{
+			MockNetworkManager networkManager;
+			networkManager.prefetch(QUrl("file:///tmp/dummy"_L1));
+			QVERIFY(networkManager.mPrefetchingHosts.isEmpty());
+
+			networkManager.prefetch(QUrl("https://localhost/tctoken"_L1));
+			networkManager.prefetch(QUrl("https://localhost:8443/paos"_L1));
+			QCOMPARE(networkManager.mPrefetchingHosts, QSet<QString>({"localhost"_L1}));
+			QTRY_VERIFY(networkManager.mPrefetchingHosts.isEmpty()); // clazy:exclude=qstring-allocations
+
+			networkManager.onShutdown();
+			networkManager.prefetch(QUrl("https://localhost"_L1));
+			QVERIFY(networkManager.mPrefetchingHosts.isEmpty());
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_NetworkManager)
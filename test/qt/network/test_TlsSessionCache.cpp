@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref TlsSessionCache
+ */
+
+#include "TlsSessionCache.h"
+
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_TlsSessionCache
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static QSslConfiguration createConfiguration(const QByteArray& pTicket)
+		{
+			auto cfg = QSslConfiguration::defaultConfiguration();
+			cfg.setSessionTicket(pTicket);
+			return cfg;
+		}
+
+	private Q_SLOTS:
+		void takeOnce()
+		{
+			TlsSessionCache cache;
+			cache.insert(QUrl("https://Example.com/tctoken"_L1), createConfiguration("ticket"_ba));
+			QCOMPARE(cache.size(), 1);
+
+			QCOMPARE(cache.take(QUrl("https://example.com:8443"_L1)), QByteArray());
+			QCOMPARE(cache.take(QUrl("https://example.org"_L1)), QByteArray());
+			QCOMPARE(cache.take(QUrl("https://example.com/paos"_L1)), "ticket"_ba);
+			QCOMPARE(cache.take(QUrl("https://example.com/paos"_L1)), QByteArray());
+			QCOMPARE(cache.size(), 0);
+		}
+
+
+		void replace()
+		{
+			TlsSessionCache cache;
+			cache.insert(QUrl("https://example.com"_L1), createConfiguration("first"_ba));
+			cache.insert(QUrl("https://example.com:443"_L1), createConfiguration("second"_ba));
+			cache.insert(QUrl("https://example.com"_L1), createConfiguration(QByteArray()));
+			QCOMPARE(cache.size(), 1);
+			QCOMPARE(cache.take(QUrl("https://example.com"_L1)), "second"_ba);
+		}
+
+
+		void bounded()
+		{
+			TlsSessionCache cache;
+			for (qsizetype i = 0; i <= TlsSessionCache::cMaxEntries; ++i)
+			{
+				const QUrl url(u"https://host%1.example.com"_s.arg(i));
+				cache.insert(url, createConfiguration(QByteArray::number(i)));
+			}
+
+			QCOMPARE(cache.size(), TlsSessionCache::cMaxEntries);
+			QCOMPARE(cache.take(QUrl("https://host0.example.com"_L1)), QByteArray());
+			QCOMPARE(cache.take(QUrl("https://host1.example.com"_L1)), "1"_ba);
+		}
+
+
+		void expired()
+		{
+			TlsSessionCache cache;
+			cache.insert(QUrl("https://example.com"_L1), createConfiguration("ticket"_ba));
+			cache.insert(QUrl("https://example.org"_L1), createConfiguration("ticket"_ba));
+			QVERIFY(!cache.mEntries.first().mExpiry.hasExpired());
+
+			cache.mEntries.first().mExpiry = QDeadlineTimer(0);
+			QCOMPARE(cache.take(QUrl("https://example.com"_L1)), QByteArray());
+			QCOMPARE(cache.size(), 1);
+
+			cache.mEntries.first().mExpiry = QDeadlineTimer(0);
+			cache.insert(QUrl("https://example.net"_L1), createConfiguration("ticket"_ba));
+			QCOMPARE(cache.size(), 1);
+
+			cache.clear();
+			QCOMPARE(cache.size(), 0);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_TlsSessionCache)
+#include "test_TlsSessionCache.moc"
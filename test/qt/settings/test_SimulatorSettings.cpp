@@ -80,6 +80,32 @@ class test_SimulatorSettings
 		}
 
 
+		void testApduLatency()
+		{
+			auto& settings = Env::getSingleton<AppSettings>()->getSimulatorSettings();
+			QCOMPARE(settings.getApduLatency(), 0UL);
+
+			settings.setApduLatency(25);
+			QCOMPARE(settings.getApduLatency(), 25UL);
+
+			settings.setApduLatency(0);
+			QCOMPARE(settings.getApduLatency(), 0UL);
+		}
+
+
+		void testReaderProfiles()
+		{
+			auto& settings = Env::getSingleton<AppSettings>()->getSimulatorSettings();
+			QCOMPARE(settings.getReaderProfiles(), QString());
+
+			settings.setReaderProfiles(QStringLiteral("/tmp/profiles.json"));
+			QCOMPARE(settings.getReaderProfiles(), QStringLiteral("/tmp/profiles.json"));
+
+			settings.setReaderProfiles(QString());
+			QCOMPARE(settings.getReaderProfiles(), QString());
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_SimulatorSettings)
@@ -604,6 +604,33 @@ class test_MsgHandlerAuth
 		}
 
 
+		void handleDeveloperModeOfSession()
+		{
+			QVERIFY(!Env::getSingleton<UiLoader>()->isLoaded());
+
+			UiLoader::setUserRequest({QStringLiteral("json")});
+			QVERIFY(Env::getSingleton<UiLoader>()->load());
+			auto ui = Env::getSingleton<UiLoader>()->getLoaded<UiPluginJson>();
+			QVERIFY(ui);
+			QSignalSpy spyUi(ui, &UiPlugin::fireWorkflowRequested);
+
+			MessageDispatcher dispatcher(QUuid::createUuid());
+			QByteArray msg(R"({"cmd": "RUN_AUTH", "tcTokenURL": "https://localhost/token", "developerMode": true})");
+			QTest::ignoreMessage(QtDebugMsg, "Using Developer Mode on SDK: true");
+			QCOMPARE(dispatcher.processCommand(msg), QByteArray());
+
+			// Workflows of other sessions may run, the settings are applied when the workflow starts.
+			QCOMPARE(Env::getSingleton<VolatileSettings>()->isDeveloperMode(), false);
+			QCOMPARE(spyUi.count(), 1);
+			const auto workflowRequest = spyUi.takeFirst().at(0).value<QSharedPointer<WorkflowRequest>>();
+			QVERIFY(workflowRequest);
+			QVERIFY(!workflowRequest->getSessionId().isNull());
+			const auto& settings = workflowRequest->getSessionSettings();
+			QVERIFY(settings.has_value());
+			QVERIFY(settings->isDeveloperMode());
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_MsgHandlerAuth)
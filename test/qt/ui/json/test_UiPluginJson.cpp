@@ -90,6 +90,38 @@ class test_UiPluginJson
 		}
 
 
+		void sessions()
+		{
+			UiPluginJson api;
+			api.setEnabled();
+			QSignalSpy spyMessage(&api, &UiPluginJson::fireMessage);
+			QSignalSpy spySessionMessage(&api, &UiPluginJson::fireSessionMessage);
+
+			const auto first = api.openSession();
+			const auto second = api.openSession();
+			QVERIFY(!first.isNull());
+			QVERIFY(first != second);
+
+			api.doSessionMessageProcessing(first, R"({"cmd": "SET_API_LEVEL", "level": 1})");
+			api.doSessionMessageProcessing(second, R"({"cmd": "GET_API_LEVEL"})");
+			QCOMPARE(spyMessage.count(), 0);
+			QCOMPARE(spySessionMessage.count(), 2);
+			QCOMPARE(spySessionMessage.at(0).at(0).toUuid(), first);
+			QVERIFY(spySessionMessage.at(0).at(1).toByteArray().contains(R"("current":1)"));
+			QCOMPARE(spySessionMessage.at(1).at(0).toUuid(), second);
+			QVERIFY(spySessionMessage.at(1).at(1).toByteArray().contains(R"("current":3)"));
+
+			api.closeSession(first);
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"^Message of unknown session: QUuid\\(.*\\)$"_s));
+			api.doSessionMessageProcessing(first, R"({"cmd": "GET_API_LEVEL"})");
+			QCOMPARE(spySessionMessage.count(), 2);
+
+			api.doMessageProcessing(R"({"cmd": "GET_API_LEVEL"})");
+			QCOMPARE(spyMessage.count(), 1);
+			QCOMPARE(spySessionMessage.count(), 2);
+		}
+
+
 		void newCard_data()
 		{
 #if __has_include("SmartManager.h")
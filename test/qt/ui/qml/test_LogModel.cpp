@@ -92,7 +92,7 @@ class test_LogModel
 			QSignalSpy spyCategorie(mModel, &LogModel::fireCategoriesChanged);
 
 			mModel->addLogEntry(input);
-			QCOMPARE(mModel->mLogEntries.at(0), input);
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), input);
 			const QModelIndex index = mModel->index(0);
 			QCOMPARE(mModel->data(index, LogModel::OriginRole), origin);
 			QCOMPARE(mModel->data(index, LogModel::LevelRole), level);
@@ -151,34 +151,34 @@ class test_LogModel
 		{
 			mModel->addLogEntry(QLatin1String("FooBar"));
 			QCOMPARE(mModel->mLogEntries.size(), 1);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar"));
 
 			mModel->addLogEntry(QLatin1String("FooBar"));
 			QCOMPARE(mModel->mLogEntries.size(), 1);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar\nFooBar"));
 
 			mModel->addLogEntry(QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
 			QCOMPARE(mModel->mLogEntries.size(), 2);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->mLogEntries.at(1).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
 
 			mModel->addLogEntry(QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test"));
 			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->mLogEntries.at(1).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->mLogEntries.at(2).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test"));
 
 			mModel->addLogEntry(QLatin1String("BarFoo"));
 			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->mLogEntries.at(1).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->mLogEntries.at(2).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo"));
 
 			mModel->addLogEntry(QLatin1String("cat 0000.00.00 00:00:00.000 000 test"));
 			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo\ncat 0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->mLogEntries.at(0).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->mLogEntries.at(1).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->mLogEntries.at(2).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo\ncat 0000.00.00 00:00:00.000 000 test"));
 		}
 
 
@@ -231,7 +231,39 @@ class test_LogModel
 		}
 
 
-		void test_OnNewLogMsg_data()
+		void test_OtherLogFile()
+		{
+			mModel->mLogFiles = QStringList({QString(), ":/logfiles/auth.txt"_L1, ":/logfiles/empty.txt"_L1});
+
+			QSignalSpy spyLevel(mModel, &LogModel::fireLevelsChanged);
+			QSignalSpy spyCategorie(mModel, &LogModel::fireCategoriesChanged);
+			mModel->setLogFile(1);
+			QVERIFY(mModel->mLogFileIndex.isOpen());
+			QVERIFY(mModel->mLogEntries.isEmpty());
+			QCOMPARE(mModel->rowCount(), 1223);
+			QCOMPARE(spyLevel.size(), 1);
+			QCOMPARE(mModel->getLevels().size(), 4);
+			QCOMPARE(spyCategorie.size(), 1);
+			QCOMPARE(mModel->getCategories().size(), 19);
+
+			for (int row = 0; row < mModel->rowCount(); ++row)
+			{
+				const QModelIndex index = mModel->index(row);
+				const auto& entry = LogEntry::fromText(mModel->data(index, Qt::DisplayRole).toString());
+				QCOMPARE(mModel->data(index, LogModel::CategoryRole).toString(), entry.getCategory());
+				QCOMPARE(mModel->data(index, LogModel::MessageRole).toString(), entry.getMessage());
+			}
+
+			mModel->setLogFile(2);
+			QVERIFY(mModel->mLogFileIndex.isOpen());
+			QCOMPARE(mModel->rowCount(), 0);
+
+			mModel->setLogFile(0);
+			QVERIFY(!mModel->mLogFileIndex.isOpen());
+		}
+
+
+		void test_OnNewLogEntry_data()
 		{
 			QTest::addColumn<QLatin1String>("msg");
 			QTest::addColumn<QLatin1String>("fileName");
@@ -247,7 +279,7 @@ class test_LogModel
 		}
 
 
-		void test_OnNewLogMsg()
+		void test_OnNewLogEntry()
 		{
 			QFETCH(QLatin1String, msg);
 			QFETCH(QLatin1String, fileName);
@@ -266,6 +298,15 @@ class test_LogModel
 			qDebug() << msg;
 			QCOMPARE(spyNewLogMsg.count(), newLogMsgCounter);
 			QCOMPARE(mModel->mLogEntries.size(), oldSize + logEntriesSizeChange);
+
+			if (logEntriesSizeChange > 0)
+			{
+				const auto& entry = mModel->mLogEntries.last();
+				QVERIFY(!entry.isText());
+				QCOMPARE(entry.getLevel(), QStringLiteral("D"));
+				QCOMPARE(entry.getCategory(), QStringLiteral("default"));
+				QVERIFY(entry.getMessage().contains(msg));
+			}
 		}
 
 
@@ -288,6 +329,29 @@ class test_LogModel
 		}
 
 
+		void test_RemoveSelectedOldLogFile()
+		{
+			QString fileName;
+			{
+				QTemporaryFile oldLogFile(LogHandler::getLogFileTemplate());
+				oldLogFile.setAutoRemove(false);
+				QVERIFY(oldLogFile.open());
+				QVERIFY(oldLogFile.write("default       2024.05.17 13:37:42.123 1234 W foo(bar.cpp:1) : text\n") > 0);
+				fileName = oldLogFile.fileName();
+			}
+
+			resetModel(new LogModel());
+			QCOMPARE(mModel->getLogFileNames().size(), 2);
+			mModel->setLogFile(1);
+			QVERIFY(mModel->mLogFileIndex.isOpen());
+
+			mModel->removeOtherLogFiles();
+			QVERIFY(!mModel->mLogFileIndex.isOpen());
+			QVERIFY(!QFile::exists(fileName));
+			QCOMPARE(mModel->getLogFileNames().size(), 1);
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_LogModel)
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Unit tests for \ref WebSocketClient
+ */
+
+#include "WebSocketClient.h"
+
+#include <QSignalSpy>
+#include <QWebSocketServer>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_WebSocketClient
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QScopedPointer<QWebSocketServer> mServer;
+		QScopedPointer<QWebSocket> mPeer;
+		QScopedPointer<WebSocketClient> mClient;
+
+	private Q_SLOTS:
+		void init()
+		{
+			mServer.reset(new QWebSocketServer(QStringLiteral("test"), QWebSocketServer::NonSecureMode));
+			QVERIFY(mServer->listen(QHostAddress::LocalHost));
+			QSignalSpy spyConnection(mServer.data(), &QWebSocketServer::newConnection);
+
+			mPeer.reset(new QWebSocket());
+			mPeer->open(mServer->serverUrl());
+			QTRY_COMPARE(spyConnection.count(), 1); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(mPeer->state(), QAbstractSocket::ConnectedState); // clazy:exclude=qstring-allocations
+
+			mClient.reset(new WebSocketClient(mServer->nextPendingConnection(), QUuid::createUuid()));
+		}
+
+
+		void cleanup()
+		{
+			mClient.reset();
+			mPeer.reset();
+			mServer.reset();
+		}
+
+
+		void receiveAndSend()
+		{
+			QSignalSpy spyReceived(mClient.data(), &WebSocketClient::fireMessageReceived);
+			QSignalSpy spyPeer(mPeer.data(), &QWebSocket::textMessageReceived);
+
+			mPeer->sendTextMessage(u"{\"cmd\": \"GET_INFO\"}"_s);
+			QTRY_COMPARE(spyReceived.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyReceived.at(0).at(0).toByteArray(), "{\"cmd\": \"GET_INFO\"}"_ba);
+
+			mClient->sendMessage("{\"msg\": \"INFO\"}"_ba);
+			QVERIFY(mClient->mBytesToWrite > 0);
+			QTRY_COMPARE(spyPeer.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyPeer.at(0).at(0).toString(), u"{\"msg\": \"INFO\"}"_s);
+			QTRY_COMPARE(mClient->mBytesToWrite, 0); // clazy:exclude=qstring-allocations
+		}
+
+
+		void holdBackWhileCongested()
+		{
+			QSignalSpy spyReceived(mClient.data(), &WebSocketClient::fireMessageReceived);
+			mClient->mBytesToWrite = WebSocketClient::MAX_BYTES_TO_WRITE + 10;
+
+			QTest::ignoreMessage(QtDebugMsg, QRegularExpression("^Client is congested, hold back message:"_L1));
+			mPeer->sendTextMessage(u"first"_s);
+			QTRY_COMPARE(mClient->mReceivedMessages.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyReceived.count(), 0);
+
+			mClient->onBytesWritten(5);
+			QCOMPARE(spyReceived.count(), 0);
+
+			mClient->onBytesWritten(10);
+			QCOMPARE(spyReceived.count(), 1);
+			QCOMPARE(spyReceived.at(0).at(0).toByteArray(), "first"_ba);
+			QVERIFY(mClient->mReceivedMessages.isEmpty());
+
+			mClient->onBytesWritten(WebSocketClient::MAX_BYTES_TO_WRITE * 2);
+			QCOMPARE(mClient->mBytesToWrite, 0);
+		}
+
+
+		void disconnectOnTooManyMessages()
+		{
+			QSignalSpy spyDisconnected(mClient.data(), &WebSocketClient::fireDisconnected);
+			QSignalSpy spyPeerDisconnected(mPeer.data(), &QWebSocket::disconnected);
+			mClient->mBytesToWrite = WebSocketClient::MAX_BYTES_TO_WRITE + 1;
+
+			for (qsizetype i = 0; i < WebSocketClient::MAX_RECEIVED_MESSAGES; ++i)
+			{
+				QTest::ignoreMessage(QtDebugMsg, QRegularExpression("^Client is congested, hold back message:"_L1));
+				mPeer->sendTextMessage(QString::number(i));
+			}
+			QTRY_COMPARE(mClient->mReceivedMessages.size(), WebSocketClient::MAX_RECEIVED_MESSAGES); // clazy:exclude=qstring-allocations
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Too many pending messages, disconnect client:"_L1));
+			mPeer->sendTextMessage(u"overflow"_s);
+			QTRY_COMPARE(spyPeerDisconnected.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(mPeer->closeCode(), QWebSocketProtocol::CloseCodePolicyViolated);
+			QVERIFY(mClient->mReceivedMessages.isEmpty());
+			QTRY_COMPARE(spyDisconnected.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_WebSocketClient)
+#include "test_WebSocketClient.moc"
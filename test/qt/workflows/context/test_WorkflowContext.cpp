@@ -274,6 +274,28 @@ class test_WorkflowContext
 		}
 
 
+		void test_concurrentWorkflows()
+		{
+			const auto& reader = QStringLiteral("reader");
+			TestWorkflowContext other;
+			other.setReaderName(reader);
+			QVERIFY(!mContext->isReaderUsedByOtherWorkflow(reader));
+			QVERIFY(!mContext->hasOtherRunningWorkflows());
+
+			QTest::ignoreMessage(QtDebugMsg, R"(Claim workflow by "test_WorkflowContext")");
+			other.claim(this);
+			QVERIFY(mContext->isReaderUsedByOtherWorkflow(reader));
+			QVERIFY(!mContext->isReaderUsedByOtherWorkflow(QStringLiteral("other reader")));
+			QVERIFY(!other.isReaderUsedByOtherWorkflow(reader));
+			QVERIFY(mContext->hasOtherRunningWorkflows());
+			QVERIFY(!other.hasOtherRunningWorkflows());
+
+			other.setWorkflowFinished(true);
+			QVERIFY(!mContext->isReaderUsedByOtherWorkflow(reader));
+			QVERIFY(!mContext->hasOtherRunningWorkflows());
+		}
+
+
 		void test_setFailureCode()
 		{
 			QVERIFY(!mContext->getFailureCode().has_value());
@@ -60,6 +60,36 @@ class test_ElementParser
 		}
 
 
+		void test_readElementHex()
+		{
+			mParser.initData("<root>"
+							 "	<hex>\n 0102\n\tAbFf </hex>"
+							 "	<empty></empty>"
+							 "</root>");
+
+			QVERIFY(nextElementNameEquals("root"_L1));
+			QVERIFY(nextElementNameEquals("hex"_L1));
+			QCOMPARE(mParser.readElementHex(), QByteArray::fromHex("0102ABFF"));
+			QVERIFY(nextElementNameEquals("empty"_L1));
+			const auto& empty = mParser.readElementHex();
+			QVERIFY(empty.isEmpty());
+			QVERIFY(!empty.isNull());
+		}
+
+
+		void test_readElementHexWithChildElement()
+		{
+			mParser.initData("<root>"
+							 "	<hex>0102<child>0304</child>0506</hex>"
+							 "</root>");
+
+			QVERIFY(nextElementNameEquals("root"_L1));
+			QVERIFY(nextElementNameEquals("hex"_L1));
+			QVERIFY(mParser.readElementHex().isNull());
+			QVERIFY(!mParser.readNextStartElement());
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_ElementParser)
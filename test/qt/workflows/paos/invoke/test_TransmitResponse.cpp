@@ -21,6 +21,14 @@ class test_TransmitResponse
 {
 	Q_OBJECT
 
+	private:
+		static QString marshall(TransmitResponse& pResponse)
+		{
+			auto data = QString::fromLatin1(pResponse.marshall());
+			data.replace(QRegularExpression("<wsa:MessageID>.*</wsa:MessageID>"_L1), "<wsa:MessageID>STRIP ME</wsa:MessageID>"_L1);
+			return data;
+		}
+
 	private Q_SLOTS:
 		void type()
 		{
@@ -58,6 +66,78 @@ class test_TransmitResponse
 		}
 
 
+		void checkTemplateWithoutMessage_data()
+		{
+			QTest::addColumn<bool>("error");
+			QTest::addColumn<QString>("resultElements");
+
+			QTest::newRow("ok") << false
+								<< u"<ResultMajor>http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok</ResultMajor>"_s;
+			QTest::newRow("error") << true
+								   << u"<ResultMajor>http://www.bsi.bund.de/ecard/api/1.1/resultmajor#error</ResultMajor>\n"
+				"                <ResultMinor>http://www.bsi.bund.de/ecard/api/1.1/resultminor/al/common#communicationError</ResultMinor>"_s;
+		}
+
+
+		void checkTemplateWithoutMessage()
+		{
+			QFETCH(bool, error);
+			QFETCH(QString, resultElements);
+
+			const auto& result = error
+					? ECardApiResult(ECardApiResult::Major::Error, ECardApiResult::Minor::AL_Communication_Error)
+					: ECardApiResult::createOk();
+
+			TransmitResponse response;
+			response.setResult(result);
+			response.setOutputApdus(QByteArrayList{"a", "b", "c"});
+			auto data = QString::fromLatin1(response.marshall());
+			data.replace(QRegularExpression("<wsa:MessageID>.*</wsa:MessageID>"_L1), "<wsa:MessageID>STRIP ME</wsa:MessageID>"_L1);
+
+			auto expected = QString::fromLatin1(TestFileHelper::readFile(":/paos/TransmitResponse.xml"_L1));
+			expected.replace(QRegularExpression("<ResultMajor>.*</ResultMessage>"_L1, QRegularExpression::DotMatchesEverythingOption), resultElements);
+			QCOMPARE(data, expected);
+		}
+
+
+		void escapeApdu()
+		{
+			TransmitResponse response;
+			response.setRelatedMessageId(u"<id & more>"_s);
+			response.setOutputApdus(QByteArrayList{"9000", "<&>"});
+			const auto& data = response.marshall();
+
+			QVERIFY(data.contains("<wsa:RelatesTo>&lt;id &amp; more&gt;</wsa:RelatesTo>"));
+			QVERIFY(data.contains("<OutputAPDU>9000</OutputAPDU>"));
+			QVERIFY(data.contains("<OutputAPDU>&lt;&amp;&gt;</OutputAPDU>"));
+		}
+
+
+		void appendOutputApdu()
+		{
+			TransmitResponse appended;
+			appended.appendOutputApdu("a"_ba);
+			appended.appendOutputApdu("<b>"_ba);
+			appended.appendOutputApdu("c"_ba);
+			QCOMPARE(appended.getOutputApdus(), QByteArrayList({"a", "<b>", "c"}));
+
+			TransmitResponse response;
+			response.setOutputApdus(QByteArrayList{"a", "<b>", "c"});
+			QCOMPARE(marshall(appended), marshall(response));
+
+			TransmitResponse set;
+			set.setOutputApdus(QByteArrayList{"a", "b", "c"});
+			TransmitResponse mixed;
+			mixed.setOutputApdus(QByteArrayList{"a"});
+			mixed.appendOutputApdu("b"_ba);
+			mixed.appendOutputApdu("c"_ba);
+			QCOMPARE(mixed.getOutputApdus(), set.getOutputApdus());
+			const auto& data = marshall(mixed);
+			QCOMPARE(data, marshall(set));
+			QVERIFY(data.contains("<OutputAPDU>a</OutputAPDU>\n            <OutputAPDU>b</OutputAPDU>"_L1));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_TransmitResponse)
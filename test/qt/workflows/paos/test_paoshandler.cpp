@@ -9,6 +9,9 @@
 
 #include "TestFileHelper.h"
 #include "paos/PaosHandler.h"
+#include "paos/retrieve/DidAuthenticateEac1.h"
+#include "paos/retrieve/DidAuthenticateEacAdditional.h"
+#include "paos/retrieve/Transmit.h"
 
 
 using namespace Qt::Literals::StringLiterals;
@@ -26,6 +29,14 @@ class test_paoshandler
 			QByteArray initFW = TestFileHelper::readFile(":/paos/DIDAuthenticateEAC1.xml"_L1);
 			PaosHandler handler(initFW);
 			QVERIFY(handler.getDetectedPaosType() == PaosType::DID_AUTHENTICATE_EAC1);
+
+			const auto eac1 = handler.getPaosMessage().staticCast<DIDAuthenticateEAC1>();
+			QVERIFY(eac1);
+			QCOMPARE(eac1->getConnectionHandle().getSlotHandle(), "37343139303333612D616163352D343331352D386464392D656166393664636661653361"_L1);
+			QCOMPARE(eac1->getDidName(), "PIN"_L1);
+			QCOMPARE(eac1->getCvCertificates().size(), 6);
+			QCOMPARE(eac1->getCertificateDescription()->getIssuerName(), "Governikus Test DVCA"_L1);
+			QVERIFY(eac1->getOptionalChat());
 		}
 
 
@@ -51,6 +62,21 @@ class test_paoshandler
 			QByteArray initFW = TestFileHelper::readFile(":/paos/DIDAuthenticateEACAdditionalInput.xml"_L1);
 			PaosHandler handler(initFW);
 			QVERIFY(handler.getDetectedPaosType() == PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE);
+
+			const auto additional = handler.getPaosMessage().staticCast<DIDAuthenticateEACAdditional>();
+			QVERIFY(additional);
+			QVERIFY(!additional->getSignature().isEmpty());
+		}
+
+
+		void parseDIDAuthenticateInvalid()
+		{
+			QByteArray content = TestFileHelper::readFile(":/paos/DIDAuthenticateEACAdditionalInput_noSignature.xml"_L1);
+			QTest::ignoreMessage(QtWarningMsg, "Mandatory element is null: Signature");
+			QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("^Error parsing message. This is not a valid .*DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE"_L1));
+			PaosHandler handler(content);
+			QVERIFY(handler.getDetectedPaosType() == PaosType::UNKNOWN);
+			QVERIFY(handler.getPaosMessage().isNull());
 		}
 
 
@@ -62,6 +88,16 @@ class test_paoshandler
 		}
 
 
+		void parseInitializeFrameworkWithMessageID()
+		{
+			QByteArray initFW = TestFileHelper::readFile(":/paos/InitializeFramework_withMessageID.xml"_L1);
+			PaosHandler handler(initFW);
+			QVERIFY(handler.getDetectedPaosType() == PaosType::INITIALIZE_FRAMEWORK);
+			QCOMPARE(handler.getPaosMessage()->getMessageId(), "urn:uuid:c0f05ac0-1a67-4a0b-acbd-78309fcdb002"_L1);
+			QCOMPARE(handler.getPaosMessage()->getRelatesTo(), QString());
+		}
+
+
 		void parseStartPAOSResponse()
 		{
 			QByteArray initFW = TestFileHelper::readFile(":/paos/StartPAOSResponse1.xml"_L1);
@@ -75,6 +111,45 @@ class test_paoshandler
 			QByteArray initFW = TestFileHelper::readFile(":/paos/Transmit.xml"_L1);
 			PaosHandler handler(initFW);
 			QVERIFY(handler.getDetectedPaosType() == PaosType::TRANSMIT);
+
+			const auto transmit = handler.getPaosMessage().staticCast<Transmit>();
+			QVERIFY(transmit);
+			QCOMPARE(transmit->getSlotHandle(), "34366364653038392D623031322D346664372D386233362D343664346232393537636236"_L1);
+			QCOMPARE(transmit->getInputApduInfos().size(), 7);
+		}
+
+
+		void parseTransmitWithAddressing()
+		{
+			QByteArray content = TestFileHelper::readFile(":/paos/Transmit3.xml"_L1);
+			PaosHandler handler(content);
+			QVERIFY(handler.getDetectedPaosType() == PaosType::TRANSMIT);
+			QCOMPARE(handler.getPaosMessage()->getMessageId(), "urn:uuid:015c4aba-4b51-463d-95e4-df127c94a5ce"_L1);
+			QCOMPARE(handler.getPaosMessage()->getRelatesTo(), "urn:uuid:04b2b166-77ad-42c9-bb7d-0c5e9798d337"_L1);
+		}
+
+
+		void parseUnknown()
+		{
+			QByteArray content = TestFileHelper::readFile(":/paos/DIDAuthenticateResponse.xml"_L1);
+			PaosHandler handler(content);
+			QVERIFY(handler.getDetectedPaosType() == PaosType::UNKNOWN);
+			QVERIFY(handler.getPaosMessage().isNull());
+		}
+
+
+		void parseBrokenXml()
+		{
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Error parsing PAOS message:"_L1));
+			PaosHandler unknown("<Envelope><Body>"_ba);
+			QVERIFY(unknown.getDetectedPaosType() == PaosType::UNKNOWN);
+			QVERIFY(unknown.getPaosMessage().isNull());
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Error parsing PAOS message:"_L1));
+			QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("^Error parsing message. This is not a valid .*TRANSMIT"_L1));
+			PaosHandler truncated("<Envelope><Body><Transmit><SlotHandle>1234</SlotHandle>"_ba);
+			QVERIFY(truncated.getDetectedPaosType() == PaosType::UNKNOWN);
+			QVERIFY(truncated.getPaosMessage().isNull());
 		}
 
 
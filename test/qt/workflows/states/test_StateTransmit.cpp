@@ -77,7 +77,7 @@ class test_StateTransmit
 				context->setTransmitResponse(response);
 
 				stateTransmit.run();
-				QCOMPARE(stateTransmit.mConnections.size(), 1);
+				QCOMPARE(stateTransmit.mConnections.size(), 2);
 			}
 
 			workerThread.quit();
@@ -115,6 +115,25 @@ class test_StateTransmit
 		}
 
 
+		void test_OnOutputApdu()
+		{
+			const QSharedPointer<AuthContext> context(new AuthContext());
+			const QSharedPointer<TransmitResponse> response(new TransmitResponse());
+			context->setTransmitResponse(response);
+			StateTransmit stateTransmit(context);
+
+			stateTransmit.onOutputApdu("9000"_ba);
+			stateTransmit.onOutputApdu("6282"_ba);
+			QCOMPARE(response->getOutputApdus(), QByteArrayList({"9000", "6282"}));
+
+			stateTransmit.setOutputApdus({"9000"_ba, "6282"_ba});
+			QCOMPARE(response->getOutputApdus(), QByteArrayList({"9000", "6282"}));
+
+			stateTransmit.setOutputApdus({"9000"_ba, "6282"_ba, "6a80"_ba});
+			QCOMPARE(response->getOutputApdus(), QByteArrayList({"9000", "6282", "6a80"}));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_StateTransmit)
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "HttpLoadWorker.h"
+
+#include <QDebug>
+#include <QNetworkProxy>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+
+using namespace governikus;
+
+
+HttpLoadWorker::HttpLoadWorker(const QString& pName, const QUrl& pUrl, int pIterations, QObject* pParent)
+	: QObject(pParent)
+	, mManager()
+	, mName(pName)
+	, mUrl(pUrl)
+	, mIterations(pIterations)
+	, mTimer()
+{
+	// The local eID port must not be bypassed by a system proxy.
+	mManager.setProxy(QNetworkProxy::NoProxy);
+	connect(&mManager, &QNetworkAccessManager::finished, this, &HttpLoadWorker::onFinished);
+}
+
+
+void HttpLoadWorker::start()
+{
+	sendRequest();
+}
+
+
+void HttpLoadWorker::sendRequest()
+{
+	if (mIterations <= 0)
+	{
+		Q_EMIT fireFinished();
+		return;
+	}
+
+	--mIterations;
+	QNetworkRequest request(mUrl);
+	request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::ManualRedirectPolicy);
+	mTimer.start();
+	mManager.get(request);
+}
+
+
+void HttpLoadWorker::onFinished(QNetworkReply* pReply)
+{
+	const auto elapsed = mTimer.nsecsElapsed();
+	pReply->deleteLater();
+
+	// ShowUI answers with a redirect or a plain 200, Status with 200.
+	const auto status = pReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+	const bool success = pReply->error() == QNetworkReply::NoError && status >= 200 && status < 400;
+	if (!success)
+	{
+		qWarning() << mName << "failed:" << status << pReply->errorString();
+	}
+
+	Q_EMIT fireMeasured(mName, elapsed, success);
+	sendRequest();
+}
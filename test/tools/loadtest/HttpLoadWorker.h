@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Sends a sequence of HTTP GET requests to the local eID port and measures every response.
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QNetworkAccessManager>
+#include <QObject>
+#include <QUrl>
+
+
+namespace governikus
+{
+
+class HttpLoadWorker
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QNetworkAccessManager mManager;
+		const QString mName;
+		const QUrl mUrl;
+		int mIterations;
+		QElapsedTimer mTimer;
+
+		void sendRequest();
+
+	private Q_SLOTS:
+		void onFinished(QNetworkReply* pReply);
+
+	public:
+		HttpLoadWorker(const QString& pName, const QUrl& pUrl, int pIterations, QObject* pParent = nullptr);
+
+		void start();
+
+	Q_SIGNALS:
+		void fireMeasured(const QString& pName, qint64 pNanoseconds, bool pSuccess);
+		void fireFinished();
+};
+
+} // namespace governikus
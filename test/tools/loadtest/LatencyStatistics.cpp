@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LatencyStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+using namespace governikus;
+
+
+namespace
+{
+double toMilliseconds(qint64 pNanoseconds)
+{
+	return static_cast<double>(pNanoseconds) / 1000000.0;
+}
+
+
+} // namespace
+
+
+LatencyStatistics::LatencyStatistics()
+	: mLatencies()
+	, mErrors(0)
+{
+}
+
+
+void LatencyStatistics::add(qint64 pNanoseconds)
+{
+	mLatencies += pNanoseconds;
+}
+
+
+void LatencyStatistics::addError()
+{
+	++mErrors;
+}
+
+
+qsizetype LatencyStatistics::getCount() const
+{
+	return mLatencies.size();
+}
+
+
+int LatencyStatistics::getErrors() const
+{
+	return mErrors;
+}
+
+
+qint64 LatencyStatistics::getPercentile(const QList<qint64>& pSortedLatencies, int pPercentile)
+{
+	if (pSortedLatencies.isEmpty())
+	{
+		return 0;
+	}
+
+	const auto rank = static_cast<qsizetype>(std::ceil(pPercentile / 100.0 * static_cast<double>(pSortedLatencies.size())));
+	return pSortedLatencies.at(std::clamp<qsizetype>(rank - 1, 0, pSortedLatencies.size() - 1));
+}
+
+
+QJsonObject LatencyStatistics::toJson(qint64 pElapsedNanoseconds) const
+{
+	auto sorted = mLatencies;
+	std::sort(sorted.begin(), sorted.end());
+
+	const double seconds = static_cast<double>(pElapsedNanoseconds) / 1000000000.0;
+	return QJsonObject {
+		{QStringLiteral("count"), static_cast<qint64>(sorted.size())},
+		{QStringLiteral("errors"), mErrors},
+		{QStringLiteral("rps"), seconds > 0 ? static_cast<double>(sorted.size()) / seconds : 0.0},
+		{QStringLiteral("p50"), toMilliseconds(getPercentile(sorted, 50))},
+		{QStringLiteral("p95"), toMilliseconds(getPercentile(sorted, 95))},
+		{QStringLiteral("p99"), toMilliseconds(getPercentile(sorted, 99))},
+		{QStringLiteral("max"), toMilliseconds(sorted.isEmpty() ? 0 : sorted.last())}
+	};
+}
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Collects the latencies of one kind of request of the load test.
+ */
+
+#pragma once
+
+#include <QJsonObject>
+#include <QList>
+
+
+namespace governikus
+{
+
+class LatencyStatistics
+{
+	private:
+		QList<qint64> mLatencies;
+		int mErrors;
+
+	public:
+		LatencyStatistics();
+
+		void add(qint64 pNanoseconds);
+		void addError();
+
+		[[nodiscard]] qsizetype getCount() const;
+		[[nodiscard]] int getErrors() const;
+
+		/*!
+		 * \brief Returns count, errors, requests per second and the p50, p95, p99
+		 * and max latency in milliseconds.
+		 */
+		[[nodiscard]] QJsonObject toJson(qint64 pElapsedNanoseconds) const;
+
+		/*!
+		 * \brief Returns the percentile by the nearest rank of the sorted latencies.
+		 */
+		[[nodiscard]] static qint64 getPercentile(const QList<qint64>& pSortedLatencies, int pPercentile);
+};
+
+} // namespace governikus
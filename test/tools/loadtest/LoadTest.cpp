@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadTest.h"
+
+#include "HttpLoadWorker.h"
+#include "PortFile.h"
+#include "WebSocketLoadWorker.h"
+
+#include <QDeadlineTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <QThread>
+
+#include <algorithm>
+#include <cstdlib>
+
+
+using namespace governikus;
+
+
+LoadTest::LoadTest(const Options& pOptions, QObject* pParent)
+	: QObject(pParent)
+	, mOptions(pOptions)
+	, mApp()
+	, mStatistics()
+	, mTimer()
+	, mRunningWorkers(0)
+{
+}
+
+
+LoadTest::~LoadTest()
+{
+	stopApp();
+}
+
+
+QStringList LoadTest::getScenarios()
+{
+	return {QStringLiteral("status"), QStringLiteral("showui"), QStringLiteral("sdk"), QStringLiteral("changepin")};
+}
+
+
+bool LoadTest::startApp()
+{
+	QStringList args;
+	args << QStringLiteral("--ui") << QStringLiteral("webservice");
+	args << QStringLiteral("--ui") << QStringLiteral("websocket");
+	args << QStringLiteral("--port") << QStringLiteral("0");
+	args << QStringLiteral("--no-logfile");
+#ifndef Q_OS_WIN
+	args << QStringLiteral("-platform") << QStringLiteral("offscreen");
+#endif
+
+	// Every sdk client and the single changepin client need their own connection.
+	auto env = QProcessEnvironment::systemEnvironment();
+	env.insert(QStringLiteral("AUSWEISAPP2_WEBSOCKET_CONNECTIONS"), QString::number(mOptions.mConcurrency + 1));
+
+	mApp.reset(new QProcess());
+	mApp->setProgram(mOptions.mApp);
+	mApp->setArguments(args);
+	mApp->setProcessEnvironment(env);
+	mApp->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+	mApp->setStandardOutputFile(QProcess::nullDevice());
+	mApp->start();
+	if (!mApp->waitForStarted(PROCESS_TIMEOUT))
+	{
+		qCritical() << "Cannot start" << mOptions.mApp << mApp->errorString();
+		return false;
+	}
+
+	return true;
+}
+
+
+void LoadTest::stopApp()
+{
+	if (mApp.isNull() || mApp->state() == QProcess::NotRunning)
+	{
+		return;
+	}
+
+	mApp->terminate();
+	if (!mApp->waitForFinished(PROCESS_TIMEOUT))
+	{
+		mApp->kill();
+		mApp->waitForFinished(PROCESS_TIMEOUT);
+	}
+}
+
+
+quint16 LoadTest::readPort() const
+{
+	QFile portFile(PortFile::getPortFilename(QString(), mApp->processId(), QStringLiteral("AusweisApp")));
+
+	QDeadlineTimer deadline(PROCESS_TIMEOUT);
+	while (!portFile.exists() && !deadline.hasExpired() && mApp->state() == QProcess::Running)
+	{
+		QThread::msleep(100);
+	}
+
+	if (!portFile.open(QIODevice::ReadOnly))
+	{
+		qCritical() << "Cannot read port file:" << portFile.fileName();
+		return 0;
+	}
+
+	quint16 port = 0;
+	QTextStream(&portFile) >> port;
+	return port;
+}
+
+
+void LoadTest::start()
+{
+	quint16 port = mOptions.mPort;
+	if (port == 0)
+	{
+		if (!startApp() || (port = readPort()) == 0)
+		{
+			Q_EMIT fireFinished(EXIT_FAILURE);
+			return;
+		}
+	}
+
+	startWorkers(port);
+}
+
+
+void LoadTest::startWorkers(quint16 pPort)
+{
+	qInfo() << "Run" << mOptions.mScenarios << "on port" << pPort << "with" << mOptions.mConcurrency << "clients and" << mOptions.mIterations << "iterations each";
+
+	const auto& httpUrl = QStringLiteral("http://127.0.0.1:%1/eID-Client?%2").arg(pPort);
+	const QUrl webSocketUrl(QStringLiteral("ws://127.0.0.1:%1/eID-Kernel").arg(pPort));
+
+	QList<QObject*> workers;
+	for (int i = 0; i < mOptions.mConcurrency; ++i)
+	{
+		for (const auto& scenario : mOptions.mScenarios)
+		{
+			if (scenario == QLatin1String("status"))
+			{
+				workers += new HttpLoadWorker(scenario, QUrl(httpUrl.arg(QStringLiteral("Status=json"))), mOptions.mIterations, this);
+			}
+			else if (scenario == QLatin1String("showui"))
+			{
+				workers += new HttpLoadWorker(scenario, QUrl(httpUrl.arg(QStringLiteral("ShowUI=PINManagement"))), mOptions.mIterations, this);
+			}
+			else if (scenario == QLatin1String("changepin") && i > 0)
+			{
+				// Only one workflow can run at a time.
+				continue;
+			}
+			else
+			{
+				workers += new WebSocketLoadWorker(scenario, webSocketUrl, WebSocketLoadWorker::createSteps(scenario), mOptions.mIterations, this);
+			}
+		}
+	}
+
+	mRunningWorkers = static_cast<int>(workers.size());
+	mTimer.start();
+	for (auto* worker : std::as_const(workers))
+	{
+		if (auto* httpWorker = qobject_cast<HttpLoadWorker*>(worker))
+		{
+			connect(httpWorker, &HttpLoadWorker::fireMeasured, this, &LoadTest::onMeasured);
+			connect(httpWorker, &HttpLoadWorker::fireFinished, this, &LoadTest::onWorkerFinished);
+			httpWorker->start();
+		}
+		else if (auto* webSocketWorker = qobject_cast<WebSocketLoadWorker*>(worker))
+		{
+			connect(webSocketWorker, &WebSocketLoadWorker::fireMeasured, this, &LoadTest::onMeasured);
+			connect(webSocketWorker, &WebSocketLoadWorker::fireFinished, this, &LoadTest::onWorkerFinished);
+			webSocketWorker->start();
+		}
+	}
+}
+
+
+void LoadTest::onMeasured(const QString& pName, qint64 pNanoseconds, bool pSuccess)
+{
+	auto& statistics = mStatistics[pName];
+	if (pSuccess)
+	{
+		statistics.add(pNanoseconds);
+	}
+	else
+	{
+		statistics.addError();
+	}
+}
+
+
+void LoadTest::onWorkerFinished()
+{
+	sender()->deleteLater();
+	if (--mRunningWorkers > 0)
+	{
+		return;
+	}
+
+	report();
+	stopApp();
+
+	const bool failed = std::any_of(mStatistics.cbegin(), mStatistics.cend(), [](const auto& pStatistics){
+				return pStatistics.getErrors() > 0;
+			});
+	Q_EMIT fireFinished(failed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+void LoadTest::report()
+{
+	const auto elapsed = mTimer.nsecsElapsed();
+
+	QJsonArray results;
+	QTextStream out(stdout);
+	out << QStringLiteral("%1 %2 %3 %4 %5 %6 %7 %8\n")
+		.arg(QStringLiteral("request"), -28)
+		.arg(QStringLiteral("count"), 8)
+		.arg(QStringLiteral("errors"), 7)
+		.arg(QStringLiteral("rps"), 10)
+		.arg(QStringLiteral("p50 ms"), 9)
+		.arg(QStringLiteral("p95 ms"), 9)
+		.arg(QStringLiteral("p99 ms"), 9)
+		.arg(QStringLiteral("max ms"), 9);
+
+	for (auto iter = mStatistics.cbegin(); iter != mStatistics.cend(); ++iter)
+	{
+		auto result = iter.value().toJson(elapsed);
+		out << QStringLiteral("%1 %2 %3 %4 %5 %6 %7 %8\n")
+			.arg(iter.key(), -28)
+			.arg(result[QLatin1String("count")].toInteger(), 8)
+			.arg(result[QLatin1String("errors")].toInt(), 7)
+			.arg(result[QLatin1String("rps")].toDouble(), 10, 'f', 1)
+			.arg(result[QLatin1String("p50")].toDouble(), 9, 'f', 2)
+			.arg(result[QLatin1String("p95")].toDouble(), 9, 'f', 2)
+			.arg(result[QLatin1String("p99")].toDouble(), 9, 'f', 2)
+			.arg(result[QLatin1String("max")].toDouble(), 9, 'f', 2);
+
+		result[QLatin1String("request")] = iter.key();
+		results += result;
+	}
+	out << QStringLiteral("Elapsed: %1 s\n").arg(static_cast<double>(elapsed) / 1000000000.0, 0, 'f', 2);
+	out.flush();
+
+	if (mOptions.mJsonFile.isEmpty())
+	{
+		return;
+	}
+
+	const QJsonObject json {
+		{QStringLiteral("concurrency"), mOptions.mConcurrency},
+		{QStringLiteral("iterations"), mOptions.mIterations},
+		{QStringLiteral("elapsed"), static_cast<double>(elapsed) / 1000000.0},
+		{QStringLiteral("results"), results}
+	};
+
+	QFile file(mOptions.mJsonFile);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(QJsonDocument(json).toJson()) < 0)
+	{
+		qWarning() << "Cannot write" << mOptions.mJsonFile << file.errorString();
+	}
+}
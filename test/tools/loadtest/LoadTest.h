@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Drives concurrent HTTP and WebSocket clients against the local eID
+ * port of AusweisApp and reports latency percentiles and throughput.
+ *
+ * If no port is given, the AusweisApp binary is started with the webservice
+ * and websocket UI and the port is taken from its port file.
+ */
+
+#pragma once
+
+#include "LatencyStatistics.h"
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QObject>
+#include <QProcess>
+#include <QScopedPointer>
+#include <QStringList>
+
+
+namespace governikus
+{
+
+class LoadTest
+	: public QObject
+{
+	Q_OBJECT
+
+	public:
+		struct Options
+		{
+			QString mApp;
+			quint16 mPort = 0;
+			int mConcurrency = 4;
+			int mIterations = 100;
+			QStringList mScenarios;
+			QString mJsonFile;
+		};
+
+	private:
+		static const int PROCESS_TIMEOUT = 30000;
+
+		const Options mOptions;
+		QScopedPointer<QProcess> mApp;
+		QMap<QString, LatencyStatistics> mStatistics;
+		QElapsedTimer mTimer;
+		int mRunningWorkers;
+
+		[[nodiscard]] bool startApp();
+		void stopApp();
+		[[nodiscard]] quint16 readPort() const;
+		void startWorkers(quint16 pPort);
+		void report();
+
+	private Q_SLOTS:
+		void onMeasured(const QString& pName, qint64 pNanoseconds, bool pSuccess);
+		void onWorkerFinished();
+
+	public:
+		explicit LoadTest(const Options& pOptions, QObject* pParent = nullptr);
+		~LoadTest() override;
+
+		void start();
+
+		[[nodiscard]] static QStringList getScenarios();
+
+	Q_SIGNALS:
+		void fireFinished(int pExitCode);
+};
+
+} // namespace governikus
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "WebSocketLoadWorker.h"
+
+#include <QDebug>
+#include <QJsonDocument>
+#include <QNetworkProxy>
+
+
+using namespace governikus;
+
+
+WebSocketLoadWorker::WebSocketLoadWorker(const QString& pName, const QUrl& pUrl, const QList<Step>& pSteps, int pIterations, QObject* pParent)
+	: QObject(pParent)
+	, mWebSocket()
+	, mName(pName)
+	, mUrl(pUrl)
+	, mSteps(pSteps)
+	, mIterations(pIterations)
+	, mCurrentStep(0)
+	, mStepTimer()
+	, mSequenceTimer()
+	, mTimeout()
+{
+	mWebSocket.setProxy(QNetworkProxy::NoProxy);
+	mTimeout.setSingleShot(true);
+	mTimeout.setInterval(STEP_TIMEOUT);
+
+	connect(&mWebSocket, &QWebSocket::connected, this, &WebSocketLoadWorker::onConnected);
+	connect(&mWebSocket, &QWebSocket::disconnected, this, &WebSocketLoadWorker::onDisconnected);
+	connect(&mWebSocket, &QWebSocket::textMessageReceived, this, &WebSocketLoadWorker::onTextMessageReceived);
+	connect(&mTimeout, &QTimer::timeout, this, &WebSocketLoadWorker::onTimeout);
+}
+
+
+QList<WebSocketLoadWorker::Step> WebSocketLoadWorker::createSteps(const QString& pScenario)
+{
+	const QJsonObject simulator {
+		{QStringLiteral("name"), QStringLiteral("Simulator")}
+	};
+
+	if (pScenario == QLatin1String("sdk"))
+	{
+		return {
+			{QStringLiteral("GET_INFO"), {}, QStringLiteral("INFO")},
+			{QStringLiteral("GET_API_LEVEL"), {}, QStringLiteral("API_LEVEL")},
+			{QStringLiteral("GET_STATUS"), {}, QStringLiteral("STATUS")},
+			{QStringLiteral("GET_READER"), simulator, QStringLiteral("READER")}
+		};
+	}
+
+	if (pScenario == QLatin1String("changepin"))
+	{
+		return {
+			{QStringLiteral("RUN_CHANGE_PIN"), {}, QStringLiteral("CHANGE_PIN")},
+			{QString(), {}, QStringLiteral("INSERT_CARD")},
+			{QStringLiteral("SET_CARD"), simulator, QStringLiteral("ENTER_PIN")},
+			{QStringLiteral("SET_PIN"), {{QStringLiteral("value"), QStringLiteral("123456")}}, QStringLiteral("ENTER_NEW_PIN")},
+			{QStringLiteral("SET_NEW_PIN"), {{QStringLiteral("value"), QStringLiteral("123456")}}, QStringLiteral("CHANGE_PIN")}
+		};
+	}
+
+	return {};
+}
+
+
+void WebSocketLoadWorker::start()
+{
+	mWebSocket.open(mUrl);
+	mTimeout.start();
+}
+
+
+void WebSocketLoadWorker::onConnected()
+{
+	startSequence();
+}
+
+
+void WebSocketLoadWorker::onDisconnected()
+{
+	if (mIterations > 0 || mTimeout.isActive())
+	{
+		fail(QStringLiteral("Disconnected: %1").arg(mWebSocket.errorString()));
+	}
+}
+
+
+void WebSocketLoadWorker::startSequence()
+{
+	if (mIterations <= 0)
+	{
+		finish();
+		return;
+	}
+
+	--mIterations;
+	mCurrentStep = 0;
+	mSequenceTimer.start();
+	startStep();
+}
+
+
+void WebSocketLoadWorker::startStep()
+{
+	const auto& step = mSteps.at(mCurrentStep);
+	mStepTimer.start();
+	mTimeout.start();
+
+	if (!step.mCommand.isEmpty())
+	{
+		auto command = step.mParameter;
+		command[QLatin1String("cmd")] = step.mCommand;
+		mWebSocket.sendTextMessage(QString::fromUtf8(QJsonDocument(command).toJson(QJsonDocument::Compact)));
+	}
+}
+
+
+void WebSocketLoadWorker::onTextMessageReceived(const QString& pMessage)
+{
+	if (mCurrentStep >= mSteps.size() || !mTimeout.isActive())
+	{
+		return;
+	}
+
+	// Unsolicited messages like READER updates are skipped.
+	const auto& step = mSteps.at(mCurrentStep);
+	const auto& message = QJsonDocument::fromJson(pMessage.toUtf8()).object();
+	if (message.value(QLatin1String("msg")).toString() != step.mExpectedMessage)
+	{
+		if (message.contains(QLatin1String("error")))
+		{
+			fail(QStringLiteral("Error on %1: %2").arg(step.mCommand, pMessage));
+		}
+		return;
+	}
+
+	const auto elapsed = mStepTimer.nsecsElapsed();
+	mTimeout.stop();
+
+	const bool success = !message.contains(QLatin1String("error"))
+			&& message.value(QLatin1String("success")).toBool(true);
+	const auto& stepName = step.mCommand.isEmpty() ? step.mExpectedMessage : step.mCommand;
+	Q_EMIT fireMeasured(mName + QLatin1Char('/') + stepName, elapsed, success);
+
+	if (++mCurrentStep < mSteps.size())
+	{
+		startStep();
+		return;
+	}
+
+	Q_EMIT fireMeasured(mName, mSequenceTimer.nsecsElapsed(), true);
+	startSequence();
+}
+
+
+void WebSocketLoadWorker::onTimeout()
+{
+	fail(QStringLiteral("Timeout"));
+}
+
+
+void WebSocketLoadWorker::fail(const QString& pReason)
+{
+	qWarning() << mName << "failed:" << pReason;
+	mTimeout.stop();
+	Q_EMIT fireMeasured(mName, 0, false);
+
+	// A workflow may still be running, so the connection cannot be reused.
+	mIterations = 0;
+	finish();
+}
+
+
+void WebSocketLoadWorker::finish()
+{
+	disconnect(&mWebSocket, nullptr, this, nullptr);
+	mWebSocket.close();
+	Q_EMIT fireFinished();
+}
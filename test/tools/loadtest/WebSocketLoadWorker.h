@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+/*!
+ * \brief Runs a sequence of SDK commands over its own WebSocket connection to
+ * the local eID port and measures every command and the whole sequence.
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+#include <QUrl>
+#include <QWebSocket>
+
+
+namespace governikus
+{
+
+class WebSocketLoadWorker
+	: public QObject
+{
+	Q_OBJECT
+
+	public:
+		struct Step
+		{
+			QString mCommand;
+			QJsonObject mParameter;
+			QString mExpectedMessage;
+		};
+
+	private:
+		static const int STEP_TIMEOUT = 30000;
+
+		QWebSocket mWebSocket;
+		const QString mName;
+		const QUrl mUrl;
+		const QList<Step> mSteps;
+		int mIterations;
+		qsizetype mCurrentStep;
+		QElapsedTimer mStepTimer;
+		QElapsedTimer mSequenceTimer;
+		QTimer mTimeout;
+
+		void startSequence();
+		void startStep();
+		void fail(const QString& pReason);
+		void finish();
+
+	private Q_SLOTS:
+		void onConnected();
+		void onDisconnected();
+		void onTextMessageReceived(const QString& pMessage);
+		void onTimeout();
+
+	public:
+		WebSocketLoadWorker(const QString& pName, const QUrl& pUrl, const QList<Step>& pSteps, int pIterations, QObject* pParent = nullptr);
+
+		void start();
+
+		/*!
+		 * \brief Returns the steps of the scenario "sdk" or "changepin".
+		 */
+		[[nodiscard]] static QList<Step> createSteps(const QString& pScenario);
+
+	Q_SIGNALS:
+		void fireMeasured(const QString& pName, qint64 pNanoseconds, bool pSuccess);
+		void fireFinished();
+};
+
+} // namespace governikus
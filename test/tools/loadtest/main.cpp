@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2024 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadTest.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QTimer>
+
+#include <cstdlib>
+
+
+using namespace governikus;
+
+
+namespace
+{
+int toPositive(const QString& pValue, const QString& pName)
+{
+	bool ok = false;
+	const int value = pValue.toInt(&ok);
+	if (!ok || value <= 0)
+	{
+		qCritical() << "Invalid value for" << pName << pValue;
+		::exit(EXIT_FAILURE);
+	}
+	return value;
+}
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName(QStringLiteral("AusweisAppLoadTest"));
+
+	QString defaultApp = QStringLiteral(AUSWEISAPP_BINARY_DIR "AusweisApp");
+#ifdef Q_OS_WIN
+	defaultApp += QStringLiteral(".exe");
+#endif
+
+	const QCommandLineOption optionApp(QStringLiteral("app"), QStringLiteral("Start given AusweisApp binary."), QStringLiteral("path"), defaultApp);
+	const QCommandLineOption optionPort(QStringLiteral("port"), QStringLiteral("Use already running AusweisApp on given port."), QStringLiteral("port"));
+	const QCommandLineOption optionConcurrency(QStringLiteral("concurrency"), QStringLiteral("Use given count of clients per scenario."), QStringLiteral("count"), QStringLiteral("4"));
+	const QCommandLineOption optionRequests(QStringLiteral("requests"), QStringLiteral("Send given count of requests per client."), QStringLiteral("count"), QStringLiteral("100"));
+	const QCommandLineOption optionScenario(QStringLiteral("scenario"), QStringLiteral("Run given scenarios: %1.").arg(LoadTest::getScenarios().join(QStringLiteral(", "))), QStringLiteral("list"), QStringLiteral("status,showui,sdk"));
+	const QCommandLineOption optionJson(QStringLiteral("json"), QStringLiteral("Write results to given JSON file."), QStringLiteral("file"));
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription(QStringLiteral("Load generator for the local eID HTTP and WebSocket port."));
+	parser.addHelpOption();
+	parser.addOptions({optionApp, optionPort, optionConcurrency, optionRequests, optionScenario, optionJson});
+	parser.process(app);
+
+	LoadTest::Options options;
+	options.mApp = parser.value(optionApp);
+	if (parser.isSet(optionPort))
+	{
+		options.mPort = static_cast<quint16>(toPositive(parser.value(optionPort), optionPort.names().constFirst()));
+	}
+	options.mConcurrency = toPositive(parser.value(optionConcurrency), optionConcurrency.names().constFirst());
+	options.mIterations = toPositive(parser.value(optionRequests), optionRequests.names().constFirst());
+	options.mJsonFile = parser.value(optionJson);
+
+	const auto& scenarios = LoadTest::getScenarios();
+	for (const auto& scenario : parser.value(optionScenario).split(QLatin1Char(','), Qt::SkipEmptyParts))
+	{
+		const auto& name = scenario.trimmed().toLower();
+		if (!scenarios.contains(name))
+		{
+			qCritical() << "Unknown scenario:" << name;
+			return EXIT_FAILURE;
+		}
+		options.mScenarios += name;
+	}
+	options.mScenarios.removeDuplicates();
+
+	LoadTest loadTest(options);
+	QObject::connect(&loadTest, &LoadTest::fireFinished, &app, &QCoreApplication::exit, Qt::QueuedConnection);
+	QTimer::singleShot(0, &loadTest, &LoadTest::start);
+	return QCoreApplication::exec();
+}